@@ -0,0 +1,552 @@
+// Description: Benchmarks of the containers against their standard library counterparts
+//              Reports the time, the number of allocations and the allocated bytes per operation.
+//              Compile with optimizations from the repository root, for example:
+//              g++ -std=c++17 -O2 -DNDEBUG -pthread Benchmarks/ContainerBenchmarks.cpp -o ContainerBenchmarks
+//              An optional argument runs only the cases whose name contains it(e.g. ./ContainerBenchmarks Queue)
+// Date:        October 14, 2026
+// Author:      Caglayan DOKME
+
+#include "../Containers/ArrayContainer.h"
+#include "../Containers/ConcurrentQueueContainer.h"
+#include "../Containers/CopyOnWriteContainer.h"
+#include "../Containers/FlatHashMapContainer.h"
+#include "../Containers/ListContainer.h"
+#include "../Containers/QueueContainer.h"
+#include "../Containers/UnrolledListContainer.h"
+#include "../Containers/VectorContainer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <new>
+#include <queue>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/*** Allocation Counting ***/
+// Every allocation of the program passes through the replaced global operators below, multithreaded cases included
+static std::atomic<std::size_t> allocationCount{0};
+static std::atomic<std::size_t> allocatedBytes{0};
+
+static void* countedAllocation(std::size_t bytes, std::size_t alignment)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+
+    void* address = nullptr;
+
+    if(alignment <= alignof(std::max_align_t))
+        address = std::malloc((0 == bytes) ? 1 : bytes);
+    else    // aligned_alloc(..) requires the size to be a multiple of the alignment
+        address = std::aligned_alloc(alignment, ((bytes + alignment - 1) / alignment) * alignment);
+
+    if(nullptr == address)
+        throw std::bad_alloc();
+
+    return address;
+}
+
+void* operator new(std::size_t bytes)                                   { return countedAllocation(bytes, alignof(std::max_align_t));   }
+void* operator new[](std::size_t bytes)                                 { return countedAllocation(bytes, alignof(std::max_align_t));   }
+void* operator new(std::size_t bytes, std::align_val_t alignment)       { return countedAllocation(bytes, std::size_t(alignment));      }
+void* operator new[](std::size_t bytes, std::align_val_t alignment)     { return countedAllocation(bytes, std::size_t(alignment));      }
+// Temporary buffers(e.g. of std::stable_sort) are taken with the nothrow forms, they are counted too
+void* operator new(std::size_t bytes, const std::nothrow_t&) noexcept   { try { return operator new(bytes);   } catch(...) { return nullptr; } }
+void* operator new[](std::size_t bytes, const std::nothrow_t&) noexcept { try { return operator new[](bytes); } catch(...) { return nullptr; } }
+void operator delete(void* address) noexcept                            { std::free(address); }
+void operator delete[](void* address) noexcept                          { std::free(address); }
+void operator delete(void* address, std::size_t) noexcept               { std::free(address); }
+void operator delete[](void* address, std::size_t) noexcept             { std::free(address); }
+void operator delete(void* address, std::align_val_t) noexcept          { std::free(address); }
+void operator delete[](void* address, std::align_val_t) noexcept        { std::free(address); }
+void operator delete(void* address, std::size_t, std::align_val_t) noexcept     { std::free(address); }
+void operator delete[](void* address, std::size_t, std::align_val_t) noexcept   { std::free(address); }
+void operator delete(void* address, const std::nothrow_t&) noexcept             { std::free(address); }
+void operator delete[](void* address, const std::nothrow_t&) noexcept           { std::free(address); }
+
+/*** Element Types ***/
+// Trivially copyable element of the given size, ordered and compared by its key
+template<std::size_t BYTES>
+struct Payload {
+    static_assert(BYTES >= sizeof(std::uint32_t), "Payload cannot be smaller than its key!");
+
+    Payload() = default;
+    explicit Payload(std::uint32_t key) : key(key) { /* No operation */ }
+
+    bool operator==(const Payload& other) const { return (key == other.key); }
+    bool operator<(const Payload& other) const  { return (key < other.key);  }
+
+    std::uint32_t   key = 0;
+    char            padding[BYTES - sizeof(std::uint32_t)] = {};
+};
+
+template<>
+struct Payload<sizeof(std::uint32_t)> {
+    Payload() = default;
+    explicit Payload(std::uint32_t key) : key(key) { /* No operation */ }
+
+    bool operator==(const Payload& other) const { return (key == other.key); }
+    bool operator<(const Payload& other) const  { return (key < other.key);  }
+
+    std::uint32_t key = 0;
+};
+
+/*** Harness ***/
+struct Measurement {
+    double      nanosecondsPerOperation = 0;
+    double      allocationsPerOperation = 0;
+    double      bytesPerOperation       = 0;
+};
+
+static const char*  caseFilter  = nullptr;
+static const int    REPETITIONS = 5;
+
+// Keeps the compiler from removing the computations leading to the given object
+template<class T>
+static void doNotOptimize(const T& value)
+{
+#if defined(__GNUC__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static const volatile void* sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * @brief   Measures the body over fresh fixtures and keeps the fastest repetition
+ * @param   operations  Number of operations done by a single call of the body
+ * @param   setup       Callable object returning a fixture, not measured
+ * @param   body        Callable object taking a reference to the fixture, measured
+ * @return  Measurement normalized by the number of operations
+ */
+template<class Setup, class Body>
+static Measurement measure(const std::size_t operations, Setup setup, Body body)
+{
+    Measurement best;
+    best.nanosecondsPerOperation = 1e300;
+
+    for(int repetition = 0; repetition < REPETITIONS; ++repetition)
+    {
+        auto fixture = setup();
+
+        const std::size_t allocationsBefore = allocationCount.load();
+        const std::size_t bytesBefore       = allocatedBytes.load();
+        const auto start                    = std::chrono::steady_clock::now();
+
+        body(fixture);
+        doNotOptimize(fixture);
+
+        const auto stop = std::chrono::steady_clock::now();
+        const double nanoseconds = double(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+
+        if(nanoseconds / double(operations) < best.nanosecondsPerOperation)
+        {
+            best.nanosecondsPerOperation = nanoseconds / double(operations);
+            best.allocationsPerOperation = double(allocationCount.load() - allocationsBefore) / double(operations);
+            best.bytesPerOperation       = double(allocatedBytes.load() - bytesBefore) / double(operations);
+        }
+    }
+
+    return best;
+}
+
+static bool isSelected(const std::string& caseName)
+{
+    return (nullptr == caseFilter) || (std::string::npos != caseName.find(caseFilter));
+}
+
+static void report(const std::string& caseName, const char* containerName, const Measurement& measurement)
+{
+    std::printf("%-44s %-18s %12.2f %12.3f %14.1f\n", caseName.c_str(), containerName,
+                measurement.nanosecondsPerOperation, measurement.allocationsPerOperation, measurement.bytesPerOperation);
+}
+
+template<class OwnSetup, class OwnBody, class StdSetup, class StdBody>
+static void compare(const std::string& caseName, const std::size_t operations,
+                    const char* ownName, OwnSetup ownSetup, OwnBody ownBody,
+                    const char* stdName, StdSetup stdSetup, StdBody stdBody)
+{
+    if(!isSelected(caseName))
+        return;
+
+    report(caseName, ownName, measure(operations, ownSetup, ownBody));
+    report("", stdName, measure(operations, stdSetup, stdBody));
+}
+
+static std::vector<std::uint32_t> randomKeys(const std::size_t count)
+{
+    std::mt19937 generator(2026);
+    std::vector<std::uint32_t> keys(count);
+
+    for(std::uint32_t& key : keys)
+        key = std::uint32_t(generator());
+
+    return keys;
+}
+
+/*** Cases ***/
+template<std::size_t BYTES>
+static void benchmarkVector()
+{
+    using T = Payload<BYTES>;
+
+    const std::string   suffix  = "/" + std::to_string(BYTES) + "B";
+    const std::size_t   N       = 100000;
+    const std::size_t   M       = 1000;     // Number of insertions/erasures in the middle
+
+    compare("Vector::push_back" + suffix, N,
+        "Vector",      [] { return Vector<T>(); },      [&](Vector<T>& v)       { for(std::size_t i = 0; i < N; ++i) v.push_back(T(std::uint32_t(i))); },
+        "std::vector", [] { return std::vector<T>(); }, [&](std::vector<T>& v)  { for(std::size_t i = 0; i < N; ++i) v.push_back(T(std::uint32_t(i))); });
+
+    compare("Vector::emplace_back" + suffix, N,
+        "Vector",      [] { return Vector<T>(); },      [&](Vector<T>& v)       { for(std::size_t i = 0; i < N; ++i) v.emplace_back(std::uint32_t(i)); },
+        "std::vector", [] { return std::vector<T>(); }, [&](std::vector<T>& v)  { for(std::size_t i = 0; i < N; ++i) v.emplace_back(std::uint32_t(i)); });
+
+    compare("Vector::insert(middle)" + suffix, M,
+        "Vector",      [&] { return Vector<T>(M, T(1)); },      [&](Vector<T>& v)       { for(std::size_t i = 0; i < M; ++i) v.insert(v.begin() + (v.size() / 2), T(std::uint32_t(i))); },
+        "std::vector", [&] { return std::vector<T>(M, T(1)); }, [&](std::vector<T>& v)  { for(std::size_t i = 0; i < M; ++i) v.insert(v.begin() + (v.size() / 2), T(std::uint32_t(i))); });
+
+    compare("Vector::erase(middle)" + suffix, M,
+        "Vector",      [&] { return Vector<T>(2 * M, T(1)); },      [&](Vector<T>& v)       { for(std::size_t i = 0; i < M; ++i) v.erase(v.begin() + (v.size() / 2)); },
+        "std::vector", [&] { return std::vector<T>(2 * M, T(1)); }, [&](std::vector<T>& v)  { for(std::size_t i = 0; i < M; ++i) v.erase(v.begin() + (v.size() / 2)); });
+
+    // Half of the elements are erased at random positions
+    const auto keys     = randomKeys(N);
+    auto isOdd          = [](const T& element) { return (0 != (element.key & 1)); };
+    auto randomVector   = [&] { Vector<T> v; for(std::uint32_t key : keys) v.push_back(T(key)); return v; };
+    auto randomStd      = [&] { std::vector<T> v; for(std::uint32_t key : keys) v.push_back(T(key)); return v; };
+
+    compare("Vector::erase_if" + suffix, N,
+        "Vector",      randomVector, [&](Vector<T>& v)      { v.erase_if(isOdd); },
+        "std::vector", randomStd,    [&](std::vector<T>& v) { v.erase(std::remove_if(v.begin(), v.end(), isOdd), v.end()); });
+
+    compare("Vector::remove_all" + suffix, N,
+        "Vector",      [&] { Vector<T> v; for(std::uint32_t key : keys) v.push_back(T(key & 1)); return v; },
+                       [&](Vector<T>& v)      { v.remove_all(T(1)); },
+        "std::vector", [&] { std::vector<T> v; for(std::uint32_t key : keys) v.push_back(T(key & 1)); return v; },
+                       [&](std::vector<T>& v) { v.erase(std::remove(v.begin(), v.end(), T(1)), v.end()); });
+}
+
+// Empty insertions into a vector of a non-trivially relocatable type must leave the elements untouched
+static void benchmarkVectorOfStrings()
+{
+    const std::size_t       M       = 1000;
+    const std::string       element(32, 'x');
+    const Vector<std::string>       noneVector;
+    const std::vector<std::string>  noneStd;
+
+    auto verify = [&](const auto& v) {
+        if((v.size() != M) || (v[1] != element) || (v[M - 1] != element))
+        {
+            std::fprintf(stderr, "Empty insertion modified the elements!\n");
+            std::abort();
+        }
+    };
+
+    compare("Vector::insert(empty)/string", 2 * M,
+        "Vector",      [&] { Vector<std::string> v(M, element); v.reserve(2 * M); return v; },
+                       [&](Vector<std::string>& v)       { for(std::size_t i = 0; i < M; ++i) { v.insert(v.begin() + 1, noneVector.begin(), noneVector.end()); v.insert(v.begin() + 1, 0, element); } verify(v); },
+        "std::vector", [&] { std::vector<std::string> v(M, element); v.reserve(2 * M); return v; },
+                       [&](std::vector<std::string>& v)  { for(std::size_t i = 0; i < M; ++i) { v.insert(v.begin() + 1, noneStd.begin(), noneStd.end()); v.insert(v.begin() + 1, 0, element); } verify(v); });
+}
+
+template<std::size_t BYTES>
+static void benchmarkList()
+{
+    using T = Payload<BYTES>;
+
+    const std::string   suffix  = "/" + std::to_string(BYTES) + "B";
+    const std::size_t   N       = 20000;
+    const auto          keys    = randomKeys(N);
+
+    auto randomList = [&] { List<T> l; for(std::uint32_t key : keys) l.Append(T(key)); return l; };
+    auto randomStd  = [&] { std::list<T> l; for(std::uint32_t key : keys) l.push_back(T(key)); return l; };
+
+    compare("List::Append" + suffix, N,
+        "List",      [] { return List<T>(); },      [&](List<T>& l)         { for(std::size_t i = 0; i < N; ++i) l.Append(T(std::uint32_t(i))); },
+        "std::list", [] { return std::list<T>(); }, [&](std::list<T>& l)    { for(std::size_t i = 0; i < N; ++i) l.push_back(T(std::uint32_t(i))); });
+
+    compare("List::Sort" + suffix, N,
+        "List",      randomList, [](List<T>& l)         { l.Sort(); },
+        "std::list", randomStd,  [](std::list<T>& l)    { l.sort(); });
+
+    // Two sorted halves of the keys are merged
+    auto sortedHalves = [&](auto makeList, auto sortList) {
+        auto halves = std::make_pair(makeList(), makeList());
+        sortList(halves.first);
+        sortList(halves.second);
+        return halves;
+    };
+
+    compare("List::Merge" + suffix, N,
+        "List",      [&] { return sortedHalves([&] { List<T> l; for(std::size_t i = 0; i < N / 2; ++i) l.Append(T(keys[i])); return l; }, [](List<T>& l) { l.Sort(); }); },
+                     [](std::pair<List<T>, List<T>>& halves) { halves.first.Merge(halves.second); },
+        "std::list", [&] { return sortedHalves([&] { std::list<T> l; for(std::size_t i = 0; i < N / 2; ++i) l.push_back(T(keys[i])); return l; }, [](std::list<T>& l) { l.sort(); }); },
+                     [](std::pair<std::list<T>, std::list<T>>& halves) { halves.first.merge(halves.second); });
+
+    compare("List::RemoveIf" + suffix, N,
+        "List",      randomList, [](List<T>& l)         { l.RemoveIf([](const T& element) { return (0 != (element.key & 1)); }); },
+        "std::list", randomStd,  [](std::list<T>& l)    { l.remove_if([](const T& element) { return (0 != (element.key & 1)); }); });
+}
+
+// Compared against List, as the unrolled nodes are meant to replace its node per element layout
+template<std::size_t BYTES>
+static void benchmarkUnrolledList()
+{
+    using T = Payload<BYTES>;
+    using U = UnrolledList<T>;
+
+    const std::string   suffix  = "/" + std::to_string(BYTES) + "B";
+    const std::size_t   N       = 20000;
+    const auto          keys    = randomKeys(N);
+
+    auto randomUnrolled = [&] { U l; for(std::uint32_t key : keys) l.Append(T(key)); return l; };
+    auto randomList     = [&] { List<T> l; for(std::uint32_t key : keys) l.Append(T(key)); return l; };
+    auto isOdd          = [](const T& element) { return (0 != (element.key & 1)); };
+
+    compare("UnrolledList::Append" + suffix, N,
+        "UnrolledList", [] { return U(); },         [&](U& l)           { for(std::size_t i = 0; i < N; ++i) l.Append(T(std::uint32_t(i))); },
+        "List",         [] { return List<T>(); },   [&](List<T>& l)     { for(std::size_t i = 0; i < N; ++i) l.Append(T(std::uint32_t(i))); });
+
+    std::uint64_t keySum = 0;
+
+    compare("UnrolledList::traverse" + suffix, N,
+        "UnrolledList", randomUnrolled, [&](U& l)           { for(const T& element : l) keySum += element.key; },
+        "List",         randomList,     [&](List<T>& l)     { for(const T& element : l) keySum += element.key; });
+
+    doNotOptimize(keySum);
+
+    compare("UnrolledList::RemoveIf" + suffix, N,
+        "UnrolledList", randomUnrolled, [&](U& l)           { l.RemoveIf(isOdd); },
+        "List",         randomList,     [&](List<T>& l)     { l.RemoveIf(isOdd); });
+
+    compare("UnrolledList::ReplaceAllWith" + suffix, N,
+        "UnrolledList", randomUnrolled, [&](U& l)           { l.ReplaceAllWith(T(keys[N / 2]), T(0)); },
+        "List",         randomList,     [&](List<T>& l)     { l.ReplaceAllWith(T(keys[N / 2]), T(0)); });
+
+    compare("UnrolledList::Sort" + suffix, N,
+        "UnrolledList", randomUnrolled, [](U& l)            { l.Sort(); },
+        "List",         randomList,     [](List<T>& l)      { l.Sort(); });
+}
+
+template<std::size_t BYTES, std::size_t C_SIZE>
+static void benchmarkQueue()
+{
+    using T = Payload<BYTES>;
+
+    const std::string   suffix  = "/" + std::to_string(BYTES) + "B/C_SIZE=" + std::to_string(C_SIZE);
+    const std::size_t   N       = 100000;
+    const std::size_t   DEPTH   = 1000;     // Number of elements kept in the queue in the steady state
+
+    compare("Queue::push+pop(throughput)" + suffix, 2 * N,
+        "Queue",      [] { return Queue<T, C_SIZE>(); },    [&](Queue<T, C_SIZE>& q)    { for(std::size_t i = 0; i < N; ++i) q.push(T(std::uint32_t(i))); for(std::size_t i = 0; i < N; ++i) q.pop(); },
+        "std::queue", [] { return std::queue<T>(); },       [&](std::queue<T>& q)       { for(std::size_t i = 0; i < N; ++i) q.push(T(std::uint32_t(i))); for(std::size_t i = 0; i < N; ++i) q.pop(); });
+
+    // A push and a pop per operation at a constant depth, the allocations should vanish
+    compare("Queue::push+pop(steady)" + suffix, N,
+        "Queue",      [&] { Queue<T, C_SIZE> q; for(std::size_t i = 0; i < DEPTH; ++i) q.push(T(std::uint32_t(i))); return q; },
+                      [&](Queue<T, C_SIZE>& q) { for(std::size_t i = 0; i < N; ++i) { q.push(T(std::uint32_t(i))); q.pop(); } },
+        "std::queue", [&] { std::queue<T> q; for(std::size_t i = 0; i < DEPTH; ++i) q.push(T(std::uint32_t(i))); return q; },
+                      [&](std::queue<T>& q) { for(std::size_t i = 0; i < N; ++i) { q.push(T(std::uint32_t(i))); q.pop(); } });
+
+    std::uint64_t keySum = 0;
+
+    // std::queue has no iterators, its underlying std::deque is traversed instead
+    compare("Queue::traverse" + suffix, N,
+        "Queue",      [&] { Queue<T, C_SIZE> q; for(std::size_t i = 0; i < N; ++i) q.push(T(std::uint32_t(i))); return q; },
+                      [&](Queue<T, C_SIZE>& q) { for(const T& element : q) keySum += element.key; },
+        "std::deque", [&] { std::deque<T> d; for(std::size_t i = 0; i < N; ++i) d.push_back(T(std::uint32_t(i))); return d; },
+                      [&](std::deque<T>& d) { for(const T& element : d) keySum += element.key; });
+
+    doNotOptimize(keySum);
+}
+
+// Mutex guarded counterpart of ConcurrentQueue
+template<class T>
+struct LockedQueue {
+    void push(T&& value)            { std::lock_guard<std::mutex> lock(mutex); queue.push(std::move(value)); }
+    bool try_pop(T& destination)    { std::lock_guard<std::mutex> lock(mutex); if(queue.empty()) return false; destination = std::move(queue.front()); queue.pop(); return true; }
+
+    std::mutex      mutex;
+    std::queue<T>   queue;
+};
+
+// Each of the producers pushes its share of the elements while as many consumers pop all of them
+template<class T, class SharedQueue>
+static void pushPopContended(SharedQueue& queue, const std::size_t producers, const std::size_t elements)
+{
+    std::atomic<std::size_t> popped{0};
+    std::vector<std::thread> threads;
+
+    for(std::size_t producer = 0; producer < producers; ++producer)
+    {
+        threads.emplace_back([&, producer] {
+            for(std::size_t i = producer; i < elements; i += producers)
+                queue.push(T(std::uint32_t(i)));
+        });
+
+        threads.emplace_back([&] {
+            T element;
+
+            while(popped.load(std::memory_order_relaxed) < elements)
+            {
+                if(queue.try_pop(element))
+                    popped.fetch_add(1, std::memory_order_relaxed);
+                else
+                    std::this_thread::yield();  // Let the producers run on an oversubscribed machine
+            }
+        });
+    }
+
+    for(std::thread& thread : threads)
+        thread.join();
+}
+
+// Producer and consumer pairs up to the number of hardware threads, the scaling cannot be seen on fewer cores
+template<std::size_t BYTES>
+static void benchmarkConcurrentQueue()
+{
+    using T = Payload<BYTES>;
+
+    const std::size_t N             = 200000;
+    const std::size_t maxThreads    = std::max<std::size_t>(2, std::thread::hardware_concurrency());
+
+    for(std::size_t producers = 1; 2 * producers <= maxThreads; producers *= 2)
+    {
+        const std::string suffix = "/" + std::to_string(BYTES) + "B/threads=" + std::to_string(2 * producers);
+
+        compare("ConcurrentQueue::push+pop" + suffix, N,
+            "ConcurrentQueue",      [] { return ConcurrentQueue<T>(); },    [&](ConcurrentQueue<T>& q) { pushPopContended<T>(q, producers, N); },
+            "mutex+std::queue",     [] { return LockedQueue<T>(); },        [&](LockedQueue<T>& q)     { pushPopContended<T>(q, producers, N); });
+    }
+}
+
+template<std::size_t BYTES>
+static void benchmarkArray()
+{
+    using T = Payload<BYTES>;
+
+    const std::string   suffix  = "/" + std::to_string(BYTES) + "B";
+    const std::size_t   N       = 100000;
+
+    auto filledArray = [&] { Array<T> a(N); for(std::size_t i = 0; i < N; ++i) a[i] = T(std::uint32_t(i)); return a; };
+    auto filledStd   = [&] { std::vector<T> v(N); for(std::size_t i = 0; i < N; ++i) v[i] = T(std::uint32_t(i)); return v; };
+
+    compare("Array::copy" + suffix, N,
+        "Array",       [&] { return std::make_pair(filledArray(), Array<T>()); },
+                       [](std::pair<Array<T>, Array<T>>& arrays) { arrays.second = arrays.first; },
+        "std::vector", [&] { return std::make_pair(filledStd(), std::vector<T>()); },
+                       [](std::pair<std::vector<T>, std::vector<T>>& vectors) { vectors.second = vectors.first; });
+
+    /* A shared copy followed by a read, the same contents are cloned in full by std::vector.
+     * Reported per copy, a single shared copy is too short for the clock so many distinct copies are timed. */
+    if(isSelected("CowArray::copy" + suffix))
+    {
+        const std::size_t COPIES = 1000;
+
+        report("CowArray::copy" + suffix, "CowArray",
+            measure(COPIES, [&] { return std::make_pair(CowArray<T>(filledArray()), std::vector<CowArray<T>>(COPIES)); },
+                            [](std::pair<CowArray<T>, std::vector<CowArray<T>>>& arrays) {
+                                for(CowArray<T>& copy : arrays.second)
+                                {
+                                    copy = arrays.first;
+                                    doNotOptimize(copy[0]);
+                                }
+                            }));
+
+        report("", "std::vector",
+            measure(1, [&] { return std::make_pair(filledStd(), std::vector<T>()); },
+                       [](std::pair<std::vector<T>, std::vector<T>>& vectors) { vectors.second = vectors.first; doNotOptimize(vectors.second[0]); }));
+    }
+
+    std::size_t equalCount = 0;
+
+    compare("Array::operator==" + suffix, N,
+        "Array",       [&] { return std::make_pair(filledArray(), filledArray()); },
+                       [&](std::pair<Array<T>, Array<T>>& arrays) { equalCount += (arrays.first == arrays.second); },
+        "std::vector", [&] { return std::make_pair(filledStd(), filledStd()); },
+                       [&](std::pair<std::vector<T>, std::vector<T>>& vectors) { equalCount += (vectors.first == vectors.second); });
+
+    doNotOptimize(equalCount);
+}
+
+template<std::size_t BYTES>
+static void benchmarkFlatHashMap()
+{
+    using T = Payload<BYTES>;
+    using M = FlatHashMap<std::uint32_t, T>;
+    using S = std::unordered_map<std::uint32_t, T>;
+
+    const std::string   suffix  = "/" + std::to_string(BYTES) + "B";
+    const std::size_t   N       = 100000;
+    const auto          keys    = randomKeys(N);
+    const auto          misses  = randomKeys(2 * N);    // The second half is independent of the keys
+
+    auto filledFlat = [&] { M m; for(std::uint32_t key : keys) m.try_emplace(key, T(key)); return m; };
+    auto filledStd  = [&] { S m; for(std::uint32_t key : keys) m.try_emplace(key, T(key)); return m; };
+
+    compare("FlatHashMap::try_emplace" + suffix, N,
+        "FlatHashMap",        [] { return M(); },       [&](M& m)   { for(std::uint32_t key : keys) m.try_emplace(key, T(key)); },
+        "std::unordered_map", [] { return S(); },       [&](S& m)   { for(std::uint32_t key : keys) m.try_emplace(key, T(key)); });
+
+    // Without rehashing, large entries are moved only by the insertion itself
+    compare("FlatHashMap::try_emplace(reserved)" + suffix, N,
+        "FlatHashMap",        [&] { M m; m.reserve(N); return m; },     [&](M& m)   { for(std::uint32_t key : keys) m.try_emplace(key, T(key)); },
+        "std::unordered_map", [&] { S m; m.reserve(N); return m; },     [&](S& m)   { for(std::uint32_t key : keys) m.try_emplace(key, T(key)); });
+
+    std::uint64_t keySum = 0;
+
+    compare("FlatHashMap::find(hit)" + suffix, N,
+        "FlatHashMap",        filledFlat,   [&](M& m)   { for(std::uint32_t key : keys) keySum += m.find(key)->second.key; },
+        "std::unordered_map", filledStd,    [&](S& m)   { for(std::uint32_t key : keys) keySum += m.find(key)->second.key; });
+
+    compare("FlatHashMap::contains(miss)" + suffix, N,
+        "FlatHashMap",        filledFlat,   [&](M& m)   { for(std::size_t i = N; i < 2 * N; ++i) keySum += m.contains(misses[i]); },
+        "std::unordered_map", filledStd,    [&](S& m)   { for(std::size_t i = N; i < 2 * N; ++i) keySum += (m.find(misses[i]) != m.end()); });
+
+    doNotOptimize(keySum);
+
+    compare("FlatHashMap::erase" + suffix, N,
+        "FlatHashMap",        filledFlat,   [&](M& m)   { for(std::uint32_t key : keys) m.erase(key); },
+        "std::unordered_map", filledStd,    [&](S& m)   { for(std::uint32_t key : keys) m.erase(key); });
+}
+
+template<std::size_t BYTES>
+static void benchmarkAll()
+{
+    benchmarkVector<BYTES>();
+    benchmarkList<BYTES>();
+    benchmarkUnrolledList<BYTES>();
+    benchmarkQueue<BYTES, 16>();
+    benchmarkQueue<BYTES, 128>();
+    benchmarkQueue<BYTES, 1024>();
+    benchmarkConcurrentQueue<BYTES>();
+    benchmarkArray<BYTES>();
+    benchmarkFlatHashMap<BYTES>();
+}
+
+int main(int argc, char const *argv[])
+{
+    if(argc > 1)
+        caseFilter = argv[1];
+
+    std::printf("%-44s %-18s %12s %12s %14s\n", "case", "container", "ns/op", "allocs/op", "bytes/op");
+
+    benchmarkVectorOfStrings();
+    benchmarkAll<4>();
+    benchmarkAll<32>();
+    benchmarkAll<256>();
+
+    return 0;
+}
@@ -0,0 +1,51 @@
+// Example usage of constexpr containers for lookup tables built at compile time
+// Date:        October 14, 2026
+// Author:      Caglayan DOKME, caglayandokme@gmail.com
+
+/** Libraries **/
+#include <iostream>
+#include <cstdint>
+#include "Containers/StaticArrayContainer.h"    // StaticArray, GenerateStaticArray
+
+// CRC-32 of a single byte with the reflected polynomial 0xEDB88320
+constexpr uint32_t crcOfByte(std::size_t byte)
+{
+    uint32_t crc = uint32_t(byte);
+
+    for(int bit = 0; bit < 8; ++bit)
+        crc = (crc & 1u) ? ((crc >> 1) ^ 0xEDB88320u) : (crc >> 1);
+
+    return crc;
+}
+
+// Both tables are computed by the compiler, the program only reads them
+constexpr auto CRC_TABLE    = GenerateStaticArray<uint32_t, 256>(crcOfByte);
+constexpr auto SQUARES      = GenerateStaticArray<int, 10>([](std::size_t index) { return int(index * index); });
+
+// Checked at compile time, the program would not compile with a wrong table
+static_assert(CRC_TABLE[0]      == 0x00000000u, "CRC table is wrong!");
+static_assert(CRC_TABLE[1]      == 0x77073096u, "CRC table is wrong!");
+static_assert(CRC_TABLE[255]    == 0x2D02EF8Du, "CRC table is wrong!");
+static_assert(SQUARES.Last() == 81 && SQUARES.Contains(49) && !SQUARES.Contains(50), "Squares are wrong!");
+static_assert(SQUARES.Count(4) == 1, "Squares are wrong!");
+
+// CRC-32 of a string by the table
+uint32_t crc32(const char* text)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+
+    for( ; *text != '\0'; ++text)
+        crc = CRC_TABLE[(crc ^ uint8_t(*text)) & 0xFFu] ^ (crc >> 8);
+
+    return ~crc;
+}
+
+int main()
+{
+    std::cout << "Squares: " << SQUARES << std::endl;
+    std::cout << "CRC-32 of \"123456789\": 0x" << std::hex << crc32("123456789") << std::dec << std::endl;   // Check value is 0xcbf43926
+
+    std::cout << "Program finished." << std::endl << std::endl;
+
+    return 0;
+}
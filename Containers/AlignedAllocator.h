@@ -0,0 +1,80 @@
+/**
+ * @file        AlignedAllocator.h
+ * @details     A stateless allocator returning storage aligned to a given boundary.
+ *              Useful for containers holding the operands of vectorized kernels(e.g. 64 bytes for AVX-512).
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstddef>              // std::size_t
+#include <limits>               // std::numeric_limits
+#include <new>                  // operator new, std::align_val_t, std::bad_array_new_length
+#include <type_traits>          // std::true_type
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Allocator Class ***/
+template<class T, std::size_t ALIGNMENT = 64>
+class AlignedAllocator {
+    static_assert((ALIGNMENT & (ALIGNMENT - 1)) == 0, "Alignment must be a power of 2!");
+    static_assert(ALIGNMENT >= alignof(T), "Alignment cannot be weaker than the natural alignment of the type!");
+
+public:
+    using value_type                                = T;
+    using is_always_equal                           = std::true_type;
+    using propagate_on_container_move_assignment    = std::true_type;
+
+    static constexpr std::size_t alignment = ALIGNMENT;
+
+    // Rebinding must be explicit because of the non-type template parameter
+    template<class U>
+    struct rebind { using other = AlignedAllocator<U, ALIGNMENT>; };
+
+    AlignedAllocator() noexcept = default;
+
+    template<class U>
+    AlignedAllocator(const AlignedAllocator<U, ALIGNMENT>&) noexcept { }
+
+    /**
+     * @brief   Allocates aligned space for given number of elements
+     * @param   n   Number of elements
+     * @return  Address of the uninitialized space
+     * @throws  std::bad_array_new_length   If the requested size overflows
+     * @throws  std::bad_alloc              If the space cannot be allocated
+     */
+    NODISCARD T* allocate(std::size_t n)
+    {
+        if(n > (std::numeric_limits<std::size_t>::max() / sizeof(T)))
+            throw std::bad_array_new_length();
+
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(ALIGNMENT)));
+    }
+
+    /**
+     * @brief   Releases the space allocated by allocate(..)
+     * @param   ptr Address of the space
+     */
+    void deallocate(T* ptr, std::size_t) noexcept
+    {
+        ::operator delete(static_cast<void*>(ptr), std::align_val_t(ALIGNMENT));
+    }
+
+    template<class U>
+    NODISCARD bool operator==(const AlignedAllocator<U, ALIGNMENT>&) const noexcept { return true; }
+
+    template<class U>
+    NODISCARD bool operator!=(const AlignedAllocator<U, ALIGNMENT>&) const noexcept { return false; }
+};
@@ -0,0 +1,273 @@
+/**
+ * @file        ArenaAllocator.h
+ * @details     A monotonic arena and a stateful allocator handle referring to it.
+ *              Allocations bump a pointer inside the current block, deallocations are no-ops except for the latest one.
+ *              All the memory is given back in a single step by releasing the arena, without visiting the containers.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *                               -> Allocators refer to an explicitly given arena only.
+ *
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstddef>              // std::size_t, std::max_align_t
+#include <cstdint>              // std::uintptr_t
+#include <limits>               // std::numeric_limits
+#include <new>                  // operator new, std::align_val_t, std::bad_array_new_length
+#include <type_traits>          // std::false_type
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Arena Resource ***/
+/* Blocks are taken from the upstream arena if one is given, from the global heap otherwise. An optional initial buffer
+ * (e.g. on the stack) is used before any block. Each new block is twice as large as the previous one.
+ * An arena is not thread safe, it shall be used by a single thread at a time(see threadLocal()). */
+class MonotonicArena {
+public:
+    explicit MonotonicArena(std::size_t initialBlockSize = 4096, MonotonicArena* upstream = nullptr) noexcept;
+    MonotonicArena(void* buffer, std::size_t bufferSize, MonotonicArena* upstream = nullptr) noexcept;
+    ~MonotonicArena() { release(); }
+
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    NODISCARD static MonotonicArena& threadLocal();     // Arena of the calling thread, e.g. ArenaAllocator<T>(MonotonicArena::threadLocal())
+
+    NODISCARD void* allocate(std::size_t size, std::size_t alignment);
+    void deallocate(void* ptr, std::size_t size) noexcept;      // Reclaims only the latest allocation
+    void release() noexcept;                                    // Returns all blocks to the upstream at once
+
+    NODISCARD std::size_t blockCount() const noexcept       { return numberOfBlocks;    }   // Number of blocks taken from the upstream
+    NODISCARD std::size_t bytesAllocated() const noexcept   { return allocatedBytes;    }   // Bytes handed out since the last release
+
+private:
+    struct BlockHeader {
+        BlockHeader*    next;
+        std::size_t     size;   // Total size including the header
+    };
+
+    void allocateBlock(std::size_t size, std::size_t alignment);
+
+    MonotonicArena* const   upstream;
+    unsigned char* const    initialBuffer;
+    const std::size_t       initialBufferSize;
+    const std::size_t       initialBlockSize;
+    std::size_t             nextBlockSize;
+    std::size_t             numberOfBlocks  = 0;
+    std::size_t             allocatedBytes  = 0;
+    BlockHeader*            blocks          = nullptr;  // All blocks, the newest one is the first
+    unsigned char*          cursor          = nullptr;  // Start of the free space in the current block
+    unsigned char*          blockEnd        = nullptr;
+    unsigned char*          lastAllocation  = nullptr;  // Start of the latest allocation, reclaimable by deallocate(..)
+};
+
+/**
+ * @brief   Constructs an arena taking its blocks from the upstream
+ * @param   initialBlockSize    Size of the first block in bytes, the following ones are doubled
+ * @param   upstream            Arena providing the blocks, nullptr for the global heap
+ * @note    Nothing is allocated until the first request.
+ */
+inline MonotonicArena::MonotonicArena(std::size_t initialBlockSize, MonotonicArena* upstream) noexcept
+: upstream(upstream), initialBuffer(nullptr), initialBufferSize(0),
+  initialBlockSize((initialBlockSize < 2 * sizeof(BlockHeader)) ? 2 * sizeof(BlockHeader) : initialBlockSize),
+  nextBlockSize(this->initialBlockSize)
+{ /* No operation */ }
+
+/**
+ * @brief   Constructs an arena serving from a given buffer first
+ * @param   buffer      Initial buffer, not owned by the arena
+ * @param   bufferSize  Size of the initial buffer in bytes, also the size of the first block
+ * @param   upstream    Arena providing the blocks after the buffer is exhausted, nullptr for the global heap
+ */
+inline MonotonicArena::MonotonicArena(void* buffer, std::size_t bufferSize, MonotonicArena* upstream) noexcept
+: upstream(upstream), initialBuffer(static_cast<unsigned char*>(buffer)), initialBufferSize(bufferSize),
+  initialBlockSize((bufferSize < 2 * sizeof(BlockHeader)) ? 2 * sizeof(BlockHeader) : bufferSize),
+  nextBlockSize(initialBlockSize), cursor(initialBuffer), blockEnd(initialBuffer + bufferSize)
+{ /* No operation */ }
+
+/**
+ * @brief   Returns the arena of the calling thread
+ * @return  lValue reference to the arena, created at the first call of each thread
+ * @note    No synchronization is needed as each thread has its own arena.
+ */
+inline MonotonicArena& MonotonicArena::threadLocal()
+{
+    thread_local MonotonicArena arena;
+
+    return arena;
+}
+
+/**
+ * @brief   Allocates space from the current block
+ * @param   size        Size of the requested space in bytes
+ * @param   alignment   Alignment of the requested space, a power of 2
+ * @return  Address of an uninitialized space
+ * @throws  std::bad_alloc  If a new block cannot be allocated
+ */
+inline void* MonotonicArena::allocate(std::size_t size, std::size_t alignment)
+{
+    // Padding needed to align the cursor, computed on integers so that no pointer is formed beyond the block
+    auto paddingOf = [alignment](const unsigned char* address) {
+        const std::uintptr_t value = reinterpret_cast<std::uintptr_t>(address);
+
+        return std::size_t(((value + alignment - 1) & ~std::uintptr_t(alignment - 1)) - value);
+    };
+
+    std::size_t padding = paddingOf(cursor);
+
+    if((nullptr == cursor) || (padding > std::size_t(blockEnd - cursor)) || ((std::size_t(blockEnd - cursor) - padding) < size))
+    {
+        allocateBlock(size, alignment);
+        padding = paddingOf(cursor);
+    }
+
+    unsigned char* const start = cursor + padding;
+
+    cursor          = start + size;
+    lastAllocation  = start;
+    allocatedBytes += size;
+
+    return static_cast<void*>(start);
+}
+
+/**
+ * @brief   Reclaims the given space if it is the latest allocation, does nothing otherwise
+ * @param   ptr     Address returned by allocate(..)
+ * @param   size    Size given to allocate(..)
+ * @note    Temporaries released in the reverse order of their allocation do not consume the arena.
+ */
+inline void MonotonicArena::deallocate(void* ptr, std::size_t size) noexcept
+{
+    unsigned char* const start = static_cast<unsigned char*>(ptr);
+
+    if((nullptr != start) && (start == lastAllocation) && ((start + size) == cursor))
+    {
+        cursor          = start;
+        lastAllocation  = nullptr;
+        allocatedBytes -= size;
+    }
+}
+
+/**
+ * @brief   Returns all blocks to the upstream and restarts from the initial buffer
+ * @note    Objects living in the arena must have been destroyed or must not need destruction.
+ * @note    Blocks taken from an upstream arena are reclaimed when that arena is released.
+ */
+inline void MonotonicArena::release() noexcept
+{
+    while(nullptr != blocks)
+    {
+        BlockHeader* next = blocks->next;
+
+        if(nullptr != upstream)
+            upstream->deallocate(static_cast<void*>(blocks), blocks->size);
+        else
+            ::operator delete(static_cast<void*>(blocks), blocks->size);
+
+        blocks = next;
+    }
+
+    numberOfBlocks  = 0;
+    allocatedBytes  = 0;
+    nextBlockSize   = initialBlockSize;
+    cursor          = initialBuffer;
+    blockEnd        = initialBuffer + initialBufferSize;
+    lastAllocation  = nullptr;
+}
+
+/**
+ * @brief   Takes a new block from the upstream, large enough for the given request
+ * @param   size        Size of the request to be served from the new block
+ * @param   alignment   Alignment of the request to be served from the new block
+ * @throws  std::bad_alloc  If the block cannot be allocated
+ */
+inline void MonotonicArena::allocateBlock(std::size_t size, std::size_t alignment)
+{
+    if(size > (std::numeric_limits<std::size_t>::max() / 2) - alignment - sizeof(BlockHeader))
+        throw std::bad_array_new_length();
+
+    const std::size_t requiredSize  = sizeof(BlockHeader) + alignment + size;
+    const std::size_t blockSize     = (requiredSize > nextBlockSize) ? requiredSize : nextBlockSize;
+
+    void* block = (nullptr != upstream) ? upstream->allocate(blockSize, alignof(std::max_align_t)) : ::operator new(blockSize);
+
+    blocks      = ::new(block) BlockHeader{blocks, blockSize};
+    cursor      = static_cast<unsigned char*>(block) + sizeof(BlockHeader);
+    blockEnd    = static_cast<unsigned char*>(block) + blockSize;
+
+    if(nextBlockSize <= (std::numeric_limits<std::size_t>::max() / 2))
+        nextBlockSize *= 2;
+
+    ++numberOfBlocks;
+}
+
+/*** Allocator Class ***/
+/* A handle to an arena, copies and rebound copies refer to the same arena and compare equal.
+ * The arena is always given explicitly, so that a container cannot silently bind to the arena of whichever
+ * thread happens to construct it. Containers therefore need the allocator in their constructors.
+ * Handles are not propagated on assignment or swap, so that a container never leaves its arena
+ * and the whole arena can be released at once. Elements are moved one by one between different arenas. */
+template<class T>
+class ArenaAllocator {
+    template<class U> friend class ArenaAllocator;
+
+public:
+    using value_type                                = T;
+    using propagate_on_container_copy_assignment    = std::false_type;
+    using propagate_on_container_move_assignment    = std::false_type;
+    using propagate_on_container_swap               = std::false_type;
+    using is_always_equal                           = std::false_type;
+
+    ArenaAllocator() = delete;
+    explicit ArenaAllocator(MonotonicArena& arena) noexcept : arena(&arena) { }
+
+    template<class U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena(other.arena) { }
+
+    /**
+     * @brief   Allocates space for given number of elements from the arena
+     * @param   n   Number of elements
+     * @return  Address of the uninitialized space
+     * @throws  std::bad_array_new_length   If the requested size overflows
+     * @throws  std::bad_alloc              If the arena cannot grow
+     */
+    NODISCARD T* allocate(std::size_t n)
+    {
+        if(n > (std::numeric_limits<std::size_t>::max() / sizeof(T)))
+            throw std::bad_array_new_length();
+
+        return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    /**
+     * @brief   Gives the space back to the arena, reclaimed only if it is the latest allocation
+     * @param   ptr Address of the space
+     * @param   n   Number of elements given to allocate(..)
+     */
+    void deallocate(T* ptr, std::size_t n) noexcept
+    {
+        arena->deallocate(static_cast<void*>(ptr), n * sizeof(T));
+    }
+
+    NODISCARD MonotonicArena& get_arena() const noexcept { return *arena; }
+
+    template<class U>
+    NODISCARD bool operator==(const ArenaAllocator<U>& other) const noexcept { return (arena == other.arena); }
+
+    template<class U>
+    NODISCARD bool operator!=(const ArenaAllocator<U>& other) const noexcept { return (arena != other.arena); }
+
+private:
+    MonotonicArena* arena;
+};
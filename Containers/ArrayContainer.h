@@ -23,6 +23,12 @@
  *                                -> Iterators simplified.
  *                                -> Non-zero initial size requirement removed.
  *                                -> [[nodiscard]] attribute added to related functions.
+ *              October 14, 2026  -> Array comparison vectorized for arithmetic types.
+ *                                -> Find(..), Count(..) and Contains(..) added.
+ *                                -> Allocator support added, elements are constructed in place from the source.
+ *                                -> Trivially copyable elements are copied in bulk.
+ *                                -> Opt-in copy statistics added, see ContainerStats.h.
+ *                                -> Assignments and Swap(..) follow the propagation traits of the allocator.
  *
  *  @note       Feel free to contact for questions, bugs or any other thing.
  *  @copyright  No copyright.
@@ -39,6 +45,13 @@
 #include <stdexcept>            // For exceptions
 #include <initializer_list>     // For initializer list
 #include <cassert>              // For assertions
+#include <memory>               // For allocators
+#include <iterator>             // For move iterators
+#include <utility>              // For std::swap
+#include <cstring>              // For bulk copies
+#include <type_traits>          // For type traits
+#include "SimdKernels.h"        // For vectorized comparisons
+#include "ContainerStats.h"     // For opt-in statistics
 
 /*** Special definitions ***/
 // If the C++ version is greater or equal to 2017xx
@@ -49,15 +62,17 @@
 #endif
 
 /*** Container Class ***/
-template<class T>
+/* Elements are allocated through the Allocator, an aligned allocator(e.g. AlignedAllocator<T, 64>)
+ * can be used to control the alignment of the storage. */
+template<class T, class Allocator = std::allocator<T>>
 class Array{
 public:
     /*** Constructors and Destructors ***/
-    Array(const size_t arraySize = 0) noexcept;         // Construct by size
-    Array(const Array& copyArr) noexcept;               // Copy constructor
-    Array(Array&& moveArr) noexcept;                    // Move constructor
-    Array(const T* const source, const size_t size);    // Construct via C-Style array
-    Array(std::initializer_list<T> initializerList);    // Construct with initializer list
+    Array(const size_t arraySize = 0, const Allocator& alloc = Allocator()) noexcept;         // Construct by size
+    Array(const Array& copyArr) noexcept;                                                       // Copy constructor
+    Array(Array&& moveArr) noexcept;                                                            // Move constructor
+    Array(const T* const source, const size_t size, const Allocator& alloc = Allocator());    // Construct via C-Style array
+    Array(std::initializer_list<T> initializerList, const Allocator& alloc = Allocator());    // Construct with initializer list
 
     virtual ~Array(); // Destructor defined virtual to support efficient polymorphism
 
@@ -69,7 +84,7 @@ public:
     NODISCARD bool operator!=(const Array& rightArr) const noexcept;           // Array comparison by inequality
 
     Array& operator=(const Array& rightArr) noexcept;   // Copy assignment
-    Array& operator=(Array&& rightArr) noexcept;  // Move assignment
+    Array& operator=(Array&& rightArr) noexcept(isStealingAlwaysPossible());    // Move assignment
 
     /*** Element Access ***/
     NODISCARD T& at(const size_t position) noexcept               { return (*this)[position]; }    // Invoke subscript operator
@@ -81,10 +96,20 @@ public:
 
     /*** Modifiers ***/
     Array& Fill(const T& fillValue) noexcept;
-    Array& Swap(Array& anotherArray) noexcept;
+    Array& Swap(Array& anotherArray) noexcept;          // Allocators must be equal unless they propagate on swap
+
+    /*** Lookup ***/
+    NODISCARD T* Find(const T& value)                   { return data + SimdKernels::find(data, size, value); }  // First equal element or end()
+    NODISCARD const T* Find(const T& value) const       { return data + SimdKernels::find(data, size, value); }  // First equal element or end()
+    NODISCARD size_t Count(const T& value) const        { return SimdKernels::count(data, size, value); }        // Number of equal elements
+    NODISCARD bool Contains(const T& value) const       { return (Find(value) != end()); }                       // Has an equal element or not
 
     /*** Status Checkers ***/
     NODISCARD size_t getSize() const noexcept  { return size; }
+    NODISCARD Allocator getAllocator() const noexcept { return allocator; }
+
+    /*** Statistics ***/
+    NODISCARD static ContainerStats::Snapshot stats() noexcept { return ContainerStats::snapshotOf<Array>(); }   // Zeros unless enabled
 
     /*** Iterators ***/
     /* Pointers can be used as iterator as the data structure of the container is completely linear */
@@ -99,9 +124,25 @@ public:
     const_iterator cend()   const   { return data + size;   }
 
 private:
+    using AllocTraits = std::allocator_traits<Allocator>;
+
+    // Storage of an rvalue can always be taken over if the allocator follows it or cannot differ
+    NODISCARD static constexpr bool isStealingAlwaysPossible() noexcept
+    {
+        return AllocTraits::propagate_on_container_move_assignment::value || AllocTraits::is_always_equal::value;
+    }
+
     /*** Members ***/
     size_t size = 0;        // Size will be initialized at constructor
     T* data     = nullptr;  // Pointer will be used for addressing the allocated area
+    Allocator allocator;    // Allocator policy for storing the data
+
+    /*** Helper Functions ***/
+    NODISCARD T* allocateStorage(const size_t numberOfElements);
+    void constructDefault();                            // Default initializes all elements
+    template<class InputIterator>
+    void constructCopies(InputIterator source);         // Copy constructs all elements from the source
+    void destroyStorage() noexcept;                     // Destroys all elements and releases the storage
 };
 
 /**
@@ -109,11 +150,12 @@ private:
  * @param   arraySize Allocation size
  * @throws  std::logic_error When size is zero
  */
-template<class T>
-Array<T>::Array(const size_t arraySize) noexcept
-    : size(arraySize), data(new T[size])
+template<class T, class Allocator>
+Array<T, Allocator>::Array(const size_t arraySize, const Allocator& alloc) noexcept
+    : size(arraySize), allocator(alloc)
 {
-    /* No operation required */
+    data = allocateStorage(size);
+    constructDefault();
 }
 
 /**
@@ -121,21 +163,21 @@ Array<T>::Array(const size_t arraySize) noexcept
  * @param   copyArr     Source array
  * @throws  std::logic_error When size is zero
  */
-template<class T>
-Array<T>::Array(const Array<T>& copyArr) noexcept
-: size(copyArr.getSize()), data(new T[size])
+template<class T, class Allocator>
+Array<T, Allocator>::Array(const Array<T, Allocator>& copyArr) noexcept
+: size(copyArr.getSize()), allocator(AllocTraits::select_on_container_copy_construction(copyArr.allocator))
 {
-    for(size_t index = 0; index < size; ++index)    // Element wise copy
-        data[index] = copyArr[index];
+    data = allocateStorage(size);
+    constructCopies(copyArr.data);
 }
 
 /**
  * @brief   Move constructor
  * @param   moveArr     Source array, created locally
  */
-template<class T>
-Array<T>::Array(Array<T>&& moveArr) noexcept
-: size(moveArr.getSize()), data(moveArr.data)
+template<class T, class Allocator>
+Array<T, Allocator>::Array(Array<T, Allocator>&& moveArr) noexcept
+: size(moveArr.getSize()), data(moveArr.data), allocator(std::move(moveArr.allocator))
 {
     /* No need to make an element wise copy as the source is
        a constant array. Assigning a nullptr to moveArr's container
@@ -149,39 +191,40 @@ Array<T>::Array(Array<T>&& moveArr) noexcept
  * @brief   Construct with C-Style array
  * @param   source  Source array
  * @param   size    Source array size
+ * @param   alloc   Allocator object
  * @throws  std::logic_error When source is invalid
  */
-template<class T>
-Array<T>::Array(const T* const source, const size_t size)
-: size(size), data(new T[size])
+template<class T, class Allocator>
+Array<T, Allocator>::Array(const T* const source, const size_t size, const Allocator& alloc)
+: size(size), allocator(alloc)
 {
     if(source == nullptr)
         throw std::logic_error("Invalid source!");
 
-    for(size_t index = 0; index < size; ++index)    // Element wise copy
-        data[index] = source[index];
+    data = allocateStorage(size);
+    constructCopies(source);
 }
 
 /**
  * @brief   Construction with initializer list
  * @param   initializerList   Initializer list
+ * @param   alloc             Allocator object
  */
-template<class T>
-Array<T>::Array(std::initializer_list<T> initializerList)
-: size(initializerList.size()), data(new T[size])
+template<class T, class Allocator>
+Array<T, Allocator>::Array(std::initializer_list<T> initializerList, const Allocator& alloc)
+: size(initializerList.size()), allocator(alloc)
 {
-    size_t index = 0;   // Element wise copy
-    for(const T& element : initializerList)
-        data[index++] = element;
+    data = allocateStorage(size);
+    constructCopies(initializerList.begin());
 }
 
 /**
  * @brief Destructor
  */
-template<class T>
-Array<T>::~Array()
+template<class T, class Allocator>
+Array<T, Allocator>::~Array()
 {
-    delete [] data;        // Deleting a nullptr is safe, don't worry
+    destroyStorage();       // Releasing a nullptr is safe, don't worry
 }
 
 /**
@@ -190,8 +233,8 @@ Array<T>::~Array()
  * @return  rValue reference to the data at given index
  * @throws  std::range_error When given index is out of container range
  */
-template<class T>
-const T& Array<T>::operator[](const size_t index) const
+template<class T, class Allocator>
+const T& Array<T, Allocator>::operator[](const size_t index) const
 {
     if(index < size)    // Check for out-of-range random access
         return data[index];
@@ -207,8 +250,8 @@ const T& Array<T>::operator[](const size_t index) const
  * @return  lValue reference to the data at given index
  * @throws  std::range_error When given index is out of container range
  */
-template<class T>
-T& Array<T>::operator[](const size_t index)
+template<class T, class Allocator>
+T& Array<T, Allocator>::operator[](const size_t index)
 {
     if(index < size)    // Check for out-of-range random access
         return data[index];
@@ -224,8 +267,8 @@ T& Array<T>::operator[](const size_t index)
  * @return  true     If arrays are equal.
  *          false    If any difference is detected.
  */
-template<class T>
-bool Array<T>::operator==(const Array<T>& rightArr) const noexcept
+template<class T, class Allocator>
+bool Array<T, Allocator>::operator==(const Array<T, Allocator>& rightArr) const noexcept
 {
     if(this == &rightArr) // Self comparison
         return true;
@@ -233,11 +276,8 @@ bool Array<T>::operator==(const Array<T>& rightArr) const noexcept
     if(rightArr.size != size) // Size should be the same to make a proper comparison
         return false;
 
-    for(size_t index = 0; index < size; ++index)    // Iterate on both arrays
-        if((*this)[index] != rightArr[index])       // operator== must have been overloaded for non-built-in types
-            return false;                           // Return false in case of an inequal element
-
-    return true;    // Arrays are the same
+    // Vectorized for arithmetic types, operator== must have been overloaded for non-built-in types
+    return SimdKernels::equal(data, rightArr.data, size);
 }
 
 /**
@@ -246,8 +286,8 @@ bool Array<T>::operator==(const Array<T>& rightArr) const noexcept
  * @return  true        If arrays are not equal
  *          false       If arrays are equal
  */
-template<class T>
-bool Array<T>::operator!=(const Array<T>& right) const noexcept
+template<class T, class Allocator>
+bool Array<T, Allocator>::operator!=(const Array<T, Allocator>& right) const noexcept
 {   // Inequality operator returns the opposite of equality operator
     return !(*this == right);   // Invokes Array::operator==
 }
@@ -259,19 +299,42 @@ bool Array<T>::operator!=(const Array<T>& right) const noexcept
  *
  * @note    The content of left array will be deleted. So, be careful.
  */
-template<class T>
-Array<T>& Array<T>::operator=(const Array<T>& rightArr) noexcept
+template<class T, class Allocator>
+Array<T, Allocator>& Array<T, Allocator>::operator=(const Array<T, Allocator>& rightArr) noexcept
 {
     if(rightArr.data == data) // Check self assignment
         return *this;
 
-    delete [] data;                     // Destroy left array
-    data = new T[rightArr.getSize()];   // Allocate space for incoming elements
-    size = rightArr.getSize();          // Determine new array size
+    if constexpr(AllocTraits::propagate_on_container_copy_assignment::value)
+    {
+        if(allocator != rightArr.allocator)     // Storage owned by the current allocator must be returned to it
+            destroyStorage();
+
+        allocator = rightArr.allocator;
+    }
+
+    if((rightArr.size == size) && (nullptr != data))  // Reuse the storage, elements are assigned in place
+    {
+        if constexpr(std::is_trivially_copyable_v<T>)
+        {
+            if(0 != size)   // Null pointers shall not be passed to std::memcpy
+                std::memcpy(static_cast<void*>(data), static_cast<const void*>(rightArr.data), size * sizeof(T));
+        }
+        else
+        {
+            for(size_t index = 0; index < size; ++index)
+                data[index] = rightArr.data[index];
+        }
+
+        CONTAINER_STATS_RECORD(Array, bytesCopied, size * sizeof(T));
 
-    // Element wise copy
-    for(size_t index = 0; index < rightArr.getSize(); ++index)
-        data[index] = rightArr[index];
+        return *this;
+    }
+
+    destroyStorage();                       // Destroy left array
+    size = rightArr.getSize();              // Determine new array size
+    data = allocateStorage(size);           // Allocate space for incoming elements
+    constructCopies(rightArr.data);         // Copy construct in place
 
     return *this;
 }
@@ -280,20 +343,38 @@ Array<T>& Array<T>::operator=(const Array<T>& rightArr) noexcept
  * @brief   Move assignment operator
  * @param   rightArr    Source array
  * @return  lValue reference to resulting array to support cascaded assignments(e.g. arr = arr1 = arr2)
+ * @note    If the allocators differ and do not propagate, the elements are moved one by one into a new storage
+ *          of the left allocator and the right array keeps its storage.
  */
-template<class T>
-Array<T>& Array<T>::operator=(Array&& rightArr) noexcept
+template<class T, class Allocator>
+Array<T, Allocator>& Array<T, Allocator>::operator=(Array&& rightArr) noexcept(isStealingAlwaysPossible())
 {
     if(this == &rightArr)
         return *this;
 
+    if constexpr(!isStealingAlwaysPossible())
+    {
+        if(allocator != rightArr.allocator)     // Storage of the right allocator cannot be released by the left one
+        {
+            destroyStorage();
+            size = rightArr.size;
+            data = allocateStorage(size);
+            constructCopies(std::make_move_iterator(rightArr.data));
+
+            return *this;
+        }
+    }
+
     // Release the allocated resource
-    delete [] data;
+    destroyStorage();
 
     // Steal the resource of the right array
     data = rightArr.data;
     size = rightArr.size;
 
+    if constexpr(AllocTraits::propagate_on_container_move_assignment::value)
+        allocator = std::move(rightArr.allocator);  // Storage must be released by its own allocator
+
     // Prevent destrutcion of the stolen resource
     rightArr.data = nullptr;
 
@@ -305,8 +386,8 @@ Array<T>& Array<T>::operator=(Array&& rightArr) noexcept
  * @param   fillValue Value to be used to fill the array
  * @return  lValue reference to support cascaded calls
  */
-template<class T>
-Array<T>& Array<T>::Fill(const T& fillValue) noexcept
+template<class T, class Allocator>
+Array<T, Allocator>& Array<T, Allocator>::Fill(const T& fillValue) noexcept
 {
     for (size_t index = 0; index < size; ++index)
         data[index] = fillValue;
@@ -318,9 +399,10 @@ Array<T>& Array<T>::Fill(const T& fillValue) noexcept
  * @brief   Swaps the content of two different array
  * @param   anotherArray Array to be swapped with this
  * @return  lValue reference to support cascaded calls
+ * @note    Unless the allocators propagate on swap, they must be equal, as for the standard containers.
  */
-template<class T>
-Array<T>& Array<T>::Swap(Array<T>& anotherArray) noexcept
+template<class T, class Allocator>
+Array<T, Allocator>& Array<T, Allocator>::Swap(Array<T, Allocator>& anotherArray) noexcept
 {
     if(anotherArray.data == data)
         return *this;
@@ -334,6 +416,16 @@ Array<T>& Array<T>::Swap(Array<T>& anotherArray) noexcept
     anotherArray.data = tempPtr;    // Assign to right container
     anotherArray.size = tempSize;   // Assign to right size
 
+    if constexpr(AllocTraits::propagate_on_container_swap::value)
+    {
+        using std::swap;
+        swap(allocator, anotherArray.allocator);    // Storages must be released by their own allocators
+    }
+    else
+    {
+        assert(allocator == anotherArray.allocator);
+    }
+
     return *this;
 }
 
@@ -346,8 +438,8 @@ Array<T>& Array<T>::Swap(Array<T>& anotherArray) noexcept
  * @note    Stream operators must be declared global as the left objects
  *          of them will always be members of type ostream or istream.
  */
-template<class T>
-std::ostream& operator<<(std::ostream& stream, const Array<T>& array) noexcept
+template<class T, class Allocator>
+std::ostream& operator<<(std::ostream& stream, const Array<T, Allocator>& array) noexcept
 {
     for(size_t index = 0; index < array.getSize(); ++index)
         stream << array[index] << " ";
@@ -364,8 +456,8 @@ std::ostream& operator<<(std::ostream& stream, const Array<T>& array) noexcept
  * @note    Stream operators must be declared global as the left objects
  *          of them will always be members of type ostream or istream.
  */
-template<class T>
-std::istream& operator>>(std::istream& stream, Array<T>& array) noexcept
+template<class T, class Allocator>
+std::istream& operator>>(std::istream& stream, Array<T, Allocator>& array) noexcept
 {
     for(size_t index = 0; index < array.getSize(); ++index)
         stream >> array[index];
@@ -373,4 +465,96 @@ std::istream& operator>>(std::istream& stream, Array<T>& array) noexcept
     return stream;  // Return reference to support cascade streaming
 }
 
+/**
+ * @brief   Allocates uninitialized space for the given number of elements
+ * @param   numberOfElements    Number of elements
+ * @return  Address of the space, nullptr for an empty array
+ */
+template<class T, class Allocator>
+T* Array<T, Allocator>::allocateStorage(const size_t numberOfElements)
+{
+    if(0 == numberOfElements)
+        return nullptr;
+
+    return AllocTraits::allocate(allocator, numberOfElements);
+}
+
+/**
+ * @brief   Default initializes the elements, the same way as new T[size] does
+ * @note    Trivial elements are left uninitialized, which makes the array usable as scratch space.
+ */
+template<class T, class Allocator>
+void Array<T, Allocator>::constructDefault()
+{
+    if constexpr(!std::is_trivially_default_constructible_v<T>)
+    {
+        size_t index = 0;
+
+        try {
+            for( ; index < size; ++index)
+                ::new(static_cast<void*>(data + index)) T;
+        }catch(...){
+            for( ; index > 0; --index)
+                AllocTraits::destroy(allocator, data + index - 1);
+
+            AllocTraits::deallocate(allocator, data, size);
+            data = nullptr;
+
+            throw;  // Propagate exception
+        }
+    }
+}
+
+/**
+ * @brief   Copy constructs the elements from the source in place
+ * @param   source  Starting point of a source holding at least size elements
+ * @note    Trivially copyable elements are copied in bulk when the source is a pointer.
+ */
+template<class T, class Allocator>
+template<class InputIterator>
+void Array<T, Allocator>::constructCopies(InputIterator source)
+{
+    if constexpr(std::is_trivially_copyable_v<T> && std::is_pointer_v<InputIterator>)
+    {
+        if(0 != size)   // Null pointers shall not be passed to std::memcpy
+            std::memcpy(static_cast<void*>(data), static_cast<const void*>(source), size * sizeof(T));
+    }
+    else
+    {
+        size_t index = 0;
+
+        try {
+            for( ; index < size; ++index, ++source)
+                AllocTraits::construct(allocator, data + index, *source);
+        }catch(...){
+            for( ; index > 0; --index)
+                AllocTraits::destroy(allocator, data + index - 1);
+
+            AllocTraits::deallocate(allocator, data, size);
+            data = nullptr;
+
+            throw;  // Propagate exception
+        }
+    }
+
+    CONTAINER_STATS_RECORD(Array, bytesCopied, size * sizeof(T));
+}
+
+/**
+ * @brief   Destroys the elements and releases the storage
+ */
+template<class T, class Allocator>
+void Array<T, Allocator>::destroyStorage() noexcept
+{
+    if(nullptr == data)
+        return;
+
+    if constexpr(!std::is_trivially_destructible_v<T>)
+        for(size_t index = 0; index < size; ++index)
+            AllocTraits::destroy(allocator, data + index);
+
+    AllocTraits::deallocate(allocator, data, size);
+    data = nullptr;
+}
+
 #endif  // Recursive inclusion preventer endif
@@ -0,0 +1,461 @@
+/**
+ * @file        BinarySerialization.h
+ * @details     Binary snapshots of Vector and Array containers of trivially copyable elements.
+ *              A snapshot is a fixed header followed by the raw bytes of the elements, written in a single step.
+ *              Snapshots can be loaded back into containers or viewed in place through a read-only memory mapping.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *                               -> Element count checked against the remaining length of the stream before allocating.
+ *
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstddef>              // std::size_t
+#include <cstdint>              // Fixed width integers
+#include <cstring>              // std::memcmp, std::memcpy
+#include <istream>              // std::istream
+#include <limits>               // std::numeric_limits
+#include <ostream>              // std::ostream
+#include <stdexcept>            // std::runtime_error, std::out_of_range
+#include <type_traits>          // std::is_trivially_copyable_v, std::is_trivial_v
+#include <utility>              // std::move, std::swap
+#include "ArrayContainer.h"     // Array
+#include "VectorContainer.h"    // Vector
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>              // open
+#include <sys/mman.h>           // mmap, munmap
+#include <sys/stat.h>           // fstat
+#include <unistd.h>             // close
+#define BINARY_SERIALIZATION_MMAP
+#endif
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+namespace BinarySerialization {
+    inline constexpr std::uint32_t FORMAT_VERSION   = 1;
+    inline constexpr std::uint32_t ENDIAN_MARKER    = 0x01020304;  // Read back in another order on a machine of different endianness
+
+    /*** Snapshot Header ***/
+    /* Elements start at the data offset, which is a multiple of their alignment.
+     * Snapshots are only portable between machines with the same endianness and the same layout of the element type. */
+    struct Header {
+        char            magic[8]            = {'C', 'P', 'X', 'S', 'N', 'A', 'P', '\0'};
+        std::uint32_t   version             = FORMAT_VERSION;
+        std::uint32_t   endianMarker        = ENDIAN_MARKER;
+        std::uint64_t   elementSize         = 0;
+        std::uint64_t   elementAlignment    = 0;
+        std::uint64_t   count               = 0;    // Number of elements
+        std::uint64_t   dataOffset          = 0;    // Distance of the first element from the beginning of the header
+    };
+
+    namespace Detail {
+        template<class T>
+        NODISCARD constexpr std::uint64_t dataOffsetOf() noexcept
+        {
+            return ((sizeof(Header) + alignof(T) - 1) / alignof(T)) * alignof(T);
+        }
+
+        /**
+         * @brief   Checks whether the header describes a snapshot of the given element type
+         * @param   header  Header read from a snapshot
+         * @return  Size of the element data in bytes
+         * @throws  std::runtime_error  If the header does not belong to a compatible snapshot
+         */
+        template<class T>
+        std::uint64_t validate(const Header& header)
+        {
+            const Header reference;
+
+            if(0 != std::memcmp(header.magic, reference.magic, sizeof(header.magic)))
+                throw std::runtime_error("Not a container snapshot!");
+
+            if(header.version != FORMAT_VERSION)
+                throw std::runtime_error("Unsupported snapshot version!");
+
+            if(header.endianMarker != ENDIAN_MARKER)
+                throw std::runtime_error("Snapshot was written with a different endianness!");
+
+            if((header.elementSize != sizeof(T)) || (header.elementAlignment != alignof(T)))
+                throw std::runtime_error("Snapshot element type does not match!");
+
+            if((header.dataOffset < sizeof(Header)) || (0 != (header.dataOffset % alignof(T))))
+                throw std::runtime_error("Invalid snapshot data offset!");
+
+            if(header.count > (std::numeric_limits<std::uint64_t>::max() - header.dataOffset) / sizeof(T))
+                throw std::runtime_error("Invalid snapshot element count!");
+
+            return header.count * sizeof(T);
+        }
+
+        /**
+         * @brief   Writes a header and the elements in a single bulk write
+         * @param   stream  Binary output stream
+         * @param   first   Address of the first element
+         * @param   count   Number of elements
+         * @throws  std::runtime_error  If the stream fails
+         */
+        template<class T>
+        void write(std::ostream& stream, const T* first, const std::size_t count)
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable elements can be saved as bytes!");
+
+            Header header;
+            header.elementSize      = sizeof(T);
+            header.elementAlignment = alignof(T);
+            header.count            = count;
+            header.dataOffset       = dataOffsetOf<T>();
+
+            const char padding[alignof(T) > 1 ? alignof(T) : 1] = {};
+
+            stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            stream.write(padding, std::streamsize(header.dataOffset - sizeof(header)));
+
+            if(0 != count)
+                stream.write(reinterpret_cast<const char*>(first), std::streamsize(count * sizeof(T)));
+
+            if(!stream)
+                throw std::runtime_error("Snapshot could not be written!");
+        }
+
+        /**
+         * @brief   Checks that the stream still holds the given number of bytes, if it can tell its length
+         * @param   stream          Binary input stream
+         * @param   requiredBytes   Number of bytes expected after the current position
+         * @throws  std::runtime_error  If the stream is shorter or cannot be repositioned
+         * @note    Non-seekable streams(e.g. pipes) cannot tell their length, they are not checked.
+         */
+        inline void checkRemaining(std::istream& stream, const std::uint64_t requiredBytes)
+        {
+            const std::istream::pos_type position = stream.tellg();
+
+            if(std::istream::pos_type(-1) == position)
+                return;
+
+            const std::istream::pos_type endPosition = stream.seekg(0, std::ios_base::end).tellg();
+
+            stream.clear();
+            if(!stream.seekg(position))
+                throw std::runtime_error("Snapshot could not be read!");
+
+            if((std::istream::pos_type(-1) != endPosition) && (std::uint64_t(endPosition - position) < requiredBytes))
+                throw std::runtime_error("Snapshot is truncated!");
+        }
+
+        /**
+         * @brief   Reads and validates a header, then skips to the first element
+         * @param   stream  Binary input stream
+         * @return  Header of the snapshot
+         * @throws  std::runtime_error  If the stream fails, the snapshot is not compatible or shorter than its header claims
+         * @note    The element count is checked before the caller allocates, so a corrupt count cannot exhaust the memory.
+         */
+        template<class T>
+        Header readHeader(std::istream& stream)
+        {
+            Header header;
+
+            if(!stream.read(reinterpret_cast<char*>(&header), sizeof(header)))
+                throw std::runtime_error("Snapshot header could not be read!");
+
+            const std::uint64_t dataSize = validate<T>(header);
+
+            if(!stream.ignore(std::streamsize(header.dataOffset - sizeof(header))))
+                throw std::runtime_error("Snapshot could not be read!");
+
+            checkRemaining(stream, dataSize);
+
+            return header;
+        }
+
+        /**
+         * @brief   Reads the elements of a snapshot in a single bulk read
+         * @param   stream      Binary input stream positioned at the first element
+         * @param   destination Address of the space for the elements
+         * @param   count       Number of elements
+         * @throws  std::runtime_error  If the stream ends before all elements are read
+         */
+        template<class T>
+        void readElements(std::istream& stream, T* destination, const std::size_t count)
+        {
+            if((0 != count) && !stream.read(reinterpret_cast<char*>(destination), std::streamsize(count * sizeof(T))))
+                throw std::runtime_error("Snapshot is truncated!");
+        }
+    }
+
+    /**
+     * @brief   Saves the elements of a vector as a binary snapshot
+     * @param   stream  Output stream opened in binary mode
+     * @param   vector  Vector to be saved
+     * @throws  std::runtime_error  If the stream fails
+     */
+    template<class T, class Allocator, class GrowthPolicy>
+    void save(std::ostream& stream, const Vector<T, Allocator, GrowthPolicy>& vector)
+    {
+        Detail::write(stream, vector.begin(), vector.size());
+    }
+
+    /**
+     * @brief   Saves the elements of an array as a binary snapshot
+     * @param   stream  Output stream opened in binary mode
+     * @param   array   Array to be saved
+     * @throws  std::runtime_error  If the stream fails
+     */
+    template<class T, class Allocator>
+    void save(std::ostream& stream, const Array<T, Allocator>& array)
+    {
+        Detail::write(stream, array.begin(), array.getSize());
+    }
+
+    /**
+     * @brief   Replaces the elements of a vector with the ones of a binary snapshot
+     * @param   stream  Input stream opened in binary mode, positioned at a snapshot
+     * @param   vector  Destination vector
+     * @throws  std::runtime_error  If the stream fails or the snapshot is not compatible
+     * @note    Trivial elements are read directly into the storage without being initialized first.
+     * @note    The vector is left empty if the snapshot is truncated.
+     */
+    template<class T, class Allocator, class GrowthPolicy>
+    void load(std::istream& stream, Vector<T, Allocator, GrowthPolicy>& vector)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable elements can be loaded from bytes!");
+
+        const Header header = Detail::readHeader<T>(stream);
+
+        vector.clear();
+
+        try {
+            if constexpr(std::is_trivial_v<T>)
+            {
+                vector.resize_and_overwrite(std::size_t(header.count), [&stream](T* destination, std::size_t count) {
+                    Detail::readElements(stream, destination, count);
+
+                    return count;
+                });
+            }
+            else
+            {
+                vector.resize(std::size_t(header.count));
+                Detail::readElements(stream, vector.begin(), vector.size());
+            }
+        }catch(...){
+            vector.clear();
+
+            throw;  // Propagate exception
+        }
+    }
+
+    /**
+     * @brief   Replaces an array with the elements of a binary snapshot
+     * @param   stream  Input stream opened in binary mode, positioned at a snapshot
+     * @param   array   Destination array, resized to the snapshot
+     * @throws  std::runtime_error  If the stream fails or the snapshot is not compatible
+     * @note    The array is not modified if loading fails.
+     */
+    template<class T, class Allocator>
+    void load(std::istream& stream, Array<T, Allocator>& array)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable elements can be loaded from bytes!");
+
+        const Header header = Detail::readHeader<T>(stream);
+        Array<T, Allocator> loaded(std::size_t(header.count), array.getAllocator());
+
+        Detail::readElements(stream, loaded.begin(), loaded.getSize());
+
+        array = std::move(loaded);
+    }
+}
+
+/*** Mapped View ***/
+/* Read-only view of a snapshot file saved from a Vector or an Array, the elements are not copied.
+ * Pages are loaded by the operating system on the first access, so opening a large snapshot takes constant time.
+ * Only available on POSIX systems, the constructor throws elsewhere. */
+template<class T>
+class MappedArray {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable elements can be mapped!");
+
+public:
+    using value_type        = T;
+    using size_type         = std::size_t;
+    using const_reference   = const T&;
+    using const_iterator    = const T*;
+
+    /*** Constructors and Destructor ***/
+    explicit MappedArray(const char* path);
+    MappedArray(const MappedArray&) = delete;               // A mapping has a single owner
+    MappedArray(MappedArray&& moveArray) noexcept;
+    ~MappedArray();
+
+    MappedArray& operator=(const MappedArray&) = delete;
+    MappedArray& operator=(MappedArray&& moveArray) noexcept;
+
+    /*** Element Access ***/
+    NODISCARD const_reference operator[](const size_type index) const noexcept  { return elements[index]; }
+    NODISCARD const_reference at(const size_type index) const;
+    NODISCARD const T* data() const noexcept                                    { return elements;          }
+
+    /*** Iterators ***/
+    NODISCARD const_iterator begin()  const noexcept { return elements;         }
+    NODISCARD const_iterator end()    const noexcept { return elements + count; }
+    NODISCARD const_iterator cbegin() const noexcept { return elements;         }
+    NODISCARD const_iterator cend()   const noexcept { return elements + count; }
+
+    /*** Size Checkers ***/
+    NODISCARD bool empty()      const noexcept { return (count == 0);  }
+    NODISCARD size_type size()  const noexcept { return count;         }
+
+private:
+    void unmap() noexcept;
+
+    /*** Members ***/
+    void*           mapping         = nullptr;  // Start of the mapped file
+    std::size_t     mappingLength   = 0;
+    const T*        elements        = nullptr;
+    std::size_t     count           = 0;
+};
+
+template<class T>
+using MappedVector = MappedArray<T>;    // Vector and Array snapshots share the same format
+
+/**
+ * @brief   Maps a snapshot file into the memory
+ * @param   path    Path of a snapshot file saved with BinarySerialization::save(..)
+ * @throws  std::runtime_error  If the file cannot be mapped or it is not a compatible snapshot
+ */
+template<class T>
+MappedArray<T>::MappedArray(const char* path)
+{
+#if defined(BINARY_SERIALIZATION_MMAP)
+    const int descriptor = ::open(path, O_RDONLY);
+
+    if(descriptor < 0)
+        throw std::runtime_error("Snapshot file cannot be opened!");
+
+    struct stat status;
+
+    if((0 != ::fstat(descriptor, &status)) || (std::uint64_t(status.st_size) < sizeof(BinarySerialization::Header)))
+    {
+        ::close(descriptor);
+        throw std::runtime_error("Snapshot file is too small!");
+    }
+
+    mappingLength   = std::size_t(status.st_size);
+    mapping         = ::mmap(nullptr, mappingLength, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+    ::close(descriptor);    // The mapping stays valid after closing the file
+
+    if(MAP_FAILED == mapping)
+    {
+        mapping = nullptr;
+        throw std::runtime_error("Snapshot file cannot be mapped!");
+    }
+
+    try {
+        BinarySerialization::Header header;
+        std::memcpy(&header, mapping, sizeof(header));
+
+        const std::uint64_t dataSize = BinarySerialization::Detail::validate<T>(header);
+
+        if((header.dataOffset + dataSize) > mappingLength)
+            throw std::runtime_error("Snapshot is truncated!");
+
+        // Mappings are page aligned and the data offset is a multiple of the alignment
+        elements    = reinterpret_cast<const T*>(static_cast<const unsigned char*>(mapping) + header.dataOffset);
+        count       = std::size_t(header.count);
+    }catch(...){
+        unmap();
+
+        throw;  // Propagate exception
+    }
+#else
+    (void)path;
+
+    throw std::runtime_error("Memory mapping is not supported on this platform!");
+#endif
+}
+
+/**
+ * @brief   Move constructor, takes over the mapping
+ * @param   moveArray   Source view, left empty
+ */
+template<class T>
+MappedArray<T>::MappedArray(MappedArray&& moveArray) noexcept
+: mapping(moveArray.mapping), mappingLength(moveArray.mappingLength), elements(moveArray.elements), count(moveArray.count)
+{
+    moveArray.mapping       = nullptr;
+    moveArray.mappingLength = 0;
+    moveArray.elements      = nullptr;
+    moveArray.count         = 0;
+}
+
+/**
+ * @brief   Destructor, unmaps the file
+ */
+template<class T>
+MappedArray<T>::~MappedArray()
+{
+    unmap();
+}
+
+/**
+ * @brief   Move assignment operator, releases the current mapping and takes over the other one
+ * @param   moveArray   Source view, left empty
+ * @return  lValue reference to the current view
+ */
+template<class T>
+MappedArray<T>& MappedArray<T>::operator=(MappedArray&& moveArray) noexcept
+{
+    if(this != &moveArray)
+    {
+        unmap();
+
+        std::swap(mapping,          moveArray.mapping);
+        std::swap(mappingLength,    moveArray.mappingLength);
+        std::swap(elements,         moveArray.elements);
+        std::swap(count,            moveArray.count);
+    }
+
+    return *this;
+}
+
+/**
+ * @brief   Random access with range check
+ * @param   index   Index of the element
+ * @return  Constant lValue reference to the element
+ * @throws  std::out_of_range   If the index is not smaller than the size
+ */
+template<class T>
+const T& MappedArray<T>::at(const size_type index) const
+{
+    if(index >= count)
+        throw std::out_of_range("Index is out-of-range!");
+
+    return elements[index];
+}
+
+/**
+ * @brief   Releases the mapping and leaves the view empty
+ */
+template<class T>
+void MappedArray<T>::unmap() noexcept
+{
+#if defined(BINARY_SERIALIZATION_MMAP)
+    if(nullptr != mapping)
+        ::munmap(mapping, mappingLength);
+#endif
+
+    mapping         = nullptr;
+    mappingLength   = 0;
+    elements        = nullptr;
+    count           = 0;
+}
@@ -0,0 +1,359 @@
+/**
+ * @file        ConcurrentQueueContainer.h
+ * @details     An unbounded lock-free multi producer multi consumer queue.
+ *              Elements are stored in chunks of C_SIZE elements like Queue, producers and consumers
+ *              claim slots with atomic fetch-add, consumed chunks are reclaimed via hazard pointers.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *                               -> Unlinking of the consumed chunks made sequentially consistent with the hazard publication.
+ *
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include "HazardPointers.h"     // HazardDomain
+#include <atomic>               // std::atomic
+#include <cstddef>              // std::size_t
+#include <memory>               // std::allocator, std::allocator_traits
+#include <new>                  // std::launder
+#include <optional>             // std::optional
+#include <type_traits>          // std::is_move_constructible_v
+#include <utility>              // std::move, std::forward
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Container Class ***/
+/* Chunks are linked from the front to the back. Each chunk has a push and a pop index,
+ * the slot claimed by a fetch-add on the push index is filled by exactly one producer and
+ * the slot claimed by a fetch-add on the pop index is read by exactly one consumer.
+ * A consumer arriving before its producer abandons the slot, the producer retries with a new slot.
+ * The allocator must be safe to be used from multiple threads. */
+template<class T, std::size_t C_SIZE = 128, class Allocator = std::allocator<T>, std::size_t MAX_THREADS = 128>
+class ConcurrentQueue {
+    static_assert(C_SIZE != 0, "Chunk size cannot be 0!");
+    static_assert(std::is_move_constructible_v<T>, "Elements must be move constructible to be moved out of abandoned slots!");
+
+    struct Chunk;
+
+public:
+    /*** C++ Standard Named Requirements for Containers ***/
+    using value_type        = T;
+    using reference         = T&;
+    using const_reference   = const T&;
+    using size_type         = std::size_t;
+    using allocator_type    = Allocator;
+
+    /*** Constructors and Destructor ***/
+    explicit ConcurrentQueue(const Allocator& alloc = Allocator());
+    ConcurrentQueue(const ConcurrentQueue&) = delete;   // Chunks are shared with other threads, the queue cannot be copied
+    ConcurrentQueue(ConcurrentQueue&&) = delete;        // Chunks are shared with other threads, the queue cannot be moved
+    ~ConcurrentQueue();
+
+    ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;
+    ConcurrentQueue& operator=(ConcurrentQueue&&) = delete;
+
+    /*** Modifiers ***/
+    template<class... Args>
+    void emplace(Args&&... args);
+    void push(const value_type& value)  { emplace(value);               }
+    void push(value_type&& value)       { emplace(std::move(value));    }
+
+    NODISCARD bool try_pop(value_type& destination);
+
+    /*** Status Checkers ***/
+    NODISCARD bool empty();     // The result is only a snapshot when other threads are active
+
+private:
+    static constexpr std::size_t CACHE_LINE_SIZE    = 64;
+    static constexpr std::size_t SPIN_LIMIT         = 128;  // Number of checks before abandoning a slot that is not filled yet
+
+    enum SlotState : unsigned char { EMPTY, READY, ABANDONED };
+
+    struct Slot {
+        std::atomic<unsigned char>  state{EMPTY};
+        alignas(T) unsigned char    storage[sizeof(T)];
+
+        NODISCARD void* raw()       noexcept { return static_cast<void*>(storage); }
+        NODISCARD T*    element()   noexcept { return std::launder(reinterpret_cast<T*>(storage)); }
+    };
+
+    struct Chunk {
+        alignas(CACHE_LINE_SIZE) std::atomic<size_type> pushIdx{0};
+        alignas(CACHE_LINE_SIZE) std::atomic<size_type> popIdx{0};
+        alignas(CACHE_LINE_SIZE) std::atomic<Chunk*>    next{nullptr};
+        Slot slots[C_SIZE];
+    };
+
+    using ChunkAllocator    = typename std::allocator_traits<Allocator>::template rebind_alloc<Chunk>;
+    using ChunkTraits       = std::allocator_traits<ChunkAllocator>;
+
+    struct ChunkReclaimer {
+        ChunkAllocator allocator;
+
+        void operator()(Chunk* chunk) { ChunkTraits::destroy(allocator, chunk); ChunkTraits::deallocate(allocator, chunk, 1); }
+    };
+
+    using Domain = HazardDomain<Chunk, ChunkReclaimer, MAX_THREADS>;
+
+    NODISCARD Chunk* createChunk();
+    NODISCARD Chunk* appendChunk(Chunk* backChunk);
+    void advanceFront(Chunk* frontChunk, Chunk* nextChunk, typename Domain::Guard& guard);
+
+    /*** Members ***/
+    ChunkAllocator  chunkAllocator;
+    Domain          domain;
+    alignas(CACHE_LINE_SIZE) std::atomic<Chunk*> head{nullptr};     // Front chunk, moved by the consumers
+    alignas(CACHE_LINE_SIZE) std::atomic<Chunk*> tail{nullptr};     // Back chunk, moved by the producers
+};
+
+/**
+ * @brief   Allocator constructor
+ * @param   alloc   Allocator object
+ */
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t MAX_THREADS>
+ConcurrentQueue<T, C_SIZE, Allocator, MAX_THREADS>::ConcurrentQueue(const Allocator& alloc)
+: chunkAllocator(alloc), domain(ChunkReclaimer{ChunkAllocator(alloc)})
+{
+    Chunk* firstChunk = createChunk();
+
+    head.store(firstChunk, std::memory_order_relaxed);
+    tail.store(firstChunk, std::memory_order_relaxed);
+}
+
+/**
+ * @brief   Destroys the remaining elements and all chunks
+ * @note    Must not be called while other threads are still using the queue.
+ */
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t MAX_THREADS>
+ConcurrentQueue<T, C_SIZE, Allocator, MAX_THREADS>::~ConcurrentQueue()
+{
+    Chunk* chunk = head.load(std::memory_order_acquire);
+
+    while(nullptr != chunk)
+    {
+        for(Slot& slot : chunk->slots)
+            if(READY == slot.state.load(std::memory_order_acquire))
+                slot.element()->~T();
+
+        Chunk* nextChunk = chunk->next.load(std::memory_order_acquire);
+
+        ChunkTraits::destroy(chunkAllocator, chunk);
+        ChunkTraits::deallocate(chunkAllocator, chunk, 1);
+        chunk = nextChunk;
+    }
+}
+
+/**
+ * @brief   Pushes the element by constructing it in-place with the given arguments
+ * @param   args    Arguments to be forwarded to the constructor of the new element
+ * @note    If the slot is abandoned by a consumer, the element is moved to another slot.
+ * @note    No element is pushed if the constructor throws.
+ */
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t MAX_THREADS>
+template<class... Args>
+void ConcurrentQueue<T, C_SIZE, Allocator, MAX_THREADS>::emplace(Args&&... args)
+{
+    typename Domain::Guard guard(domain);
+    std::optional<T> pending;   // Element taken back from an abandoned slot
+
+    for(;;)
+    {
+        Chunk* chunk = guard.protect(tail);
+        const size_type index = chunk->pushIdx.fetch_add(1, std::memory_order_relaxed);
+
+        if(index >= C_SIZE) // Back chunk is full, link a new one
+        {
+            Chunk* nextChunk = appendChunk(chunk);
+
+            tail.compare_exchange_strong(chunk, nextChunk, std::memory_order_release, std::memory_order_relaxed);
+            continue;
+        }
+
+        Slot& slot = chunk->slots[index];
+
+        // The arguments are only consumed by the first attempt
+        if(pending)
+            ::new(slot.raw()) T(std::move(*pending));
+        else
+            ::new(slot.raw()) T(std::forward<Args>(args)...);
+
+        unsigned char expected = EMPTY;
+
+        if(slot.state.compare_exchange_strong(expected, READY, std::memory_order_release, std::memory_order_relaxed))
+            return;
+
+        // A consumer has given up on this slot, take the element back and retry
+        T* element = slot.element();
+
+        pending.emplace(std::move(*element));
+        element->~T();
+    }
+}
+
+/**
+ * @brief   Moves the front element out and destroys it
+ * @param   destination Object to be assigned with the front element
+ * @return  false   If the queue was empty
+ * @note    The element is lost if the assignment throws.
+ */
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t MAX_THREADS>
+bool ConcurrentQueue<T, C_SIZE, Allocator, MAX_THREADS>::try_pop(value_type& destination)
+{
+    typename Domain::Guard guard(domain);
+
+    for(;;)
+    {
+        Chunk* chunk = guard.protect(head);
+
+        // Check the emptiness first, so that slots are not abandoned needlessly
+        const size_type popIdx  = chunk->popIdx.load(std::memory_order_acquire);
+        const size_type pushIdx = chunk->pushIdx.load(std::memory_order_acquire);
+
+        if((popIdx >= pushIdx) || (popIdx >= C_SIZE))
+        {
+            Chunk* nextChunk = chunk->next.load(std::memory_order_acquire);
+
+            if((nullptr == nextChunk) || (popIdx < C_SIZE))
+                return false;
+
+            advanceFront(chunk, nextChunk, guard);
+            continue;
+        }
+
+        const size_type index = chunk->popIdx.fetch_add(1, std::memory_order_acq_rel);
+
+        if(index >= C_SIZE) // Another consumer took the last slot
+            continue;
+
+        Slot& slot = chunk->slots[index];
+        unsigned char state = slot.state.load(std::memory_order_acquire);
+
+        // The producer of the slot may be about to publish the element
+        for(std::size_t spin = 0; (EMPTY == state) && (spin < SPIN_LIMIT); ++spin)
+            state = slot.state.load(std::memory_order_acquire);
+
+        if((EMPTY == state) && slot.state.compare_exchange_strong(state, ABANDONED, std::memory_order_acquire, std::memory_order_acquire))
+            continue;   // Producer will retry with another slot
+
+        // Element is ready, the abandonment has failed if the state was empty
+        T* element = slot.element();
+
+        try {
+            destination = std::move(*element);
+        }catch(...){
+            element->~T();
+            slot.state.store(ABANDONED, std::memory_order_relaxed);
+
+            throw;  // Propagate exception
+        }
+
+        element->~T();
+        slot.state.store(ABANDONED, std::memory_order_relaxed); // Consumed, not to be destroyed again by the destructor
+
+        return true;
+    }
+}
+
+/**
+ * @brief   Checks whether the queue has any element to be popped
+ * @return  true    If no published or claimed slot was found at the time of the call
+ * @note    Consumed front chunks are unlinked on the way, like try_pop(..) does.
+ */
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t MAX_THREADS>
+bool ConcurrentQueue<T, C_SIZE, Allocator, MAX_THREADS>::empty()
+{
+    typename Domain::Guard guard(domain);
+
+    for(;;)
+    {
+        Chunk* chunk = guard.protect(head);
+
+        const size_type popIdx  = chunk->popIdx.load(std::memory_order_acquire);
+        const size_type pushIdx = chunk->pushIdx.load(std::memory_order_acquire);
+
+        if(popIdx < C_SIZE)
+            return (popIdx >= pushIdx);
+
+        // Front chunk is consumed, the next one must be checked
+        Chunk* nextChunk = chunk->next.load(std::memory_order_acquire);
+
+        if(nullptr == nextChunk)
+            return true;
+
+        advanceFront(chunk, nextChunk, guard);
+    }
+}
+
+/**
+ * @brief   Allocates and constructs an empty chunk
+ * @return  Address of the new chunk
+ */
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t MAX_THREADS>
+typename ConcurrentQueue<T, C_SIZE, Allocator, MAX_THREADS>::Chunk* ConcurrentQueue<T, C_SIZE, Allocator, MAX_THREADS>::createChunk()
+{
+    Chunk* chunk = ChunkTraits::allocate(chunkAllocator, 1);
+
+    ChunkTraits::construct(chunkAllocator, chunk);
+
+    return chunk;
+}
+
+/**
+ * @brief   Links a new chunk after the given back chunk unless another producer has already done it
+ * @param   backChunk   Full back chunk, protected by the caller
+ * @return  Address of the chunk linked after the back chunk
+ */
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t MAX_THREADS>
+typename ConcurrentQueue<T, C_SIZE, Allocator, MAX_THREADS>::Chunk* ConcurrentQueue<T, C_SIZE, Allocator, MAX_THREADS>::appendChunk(Chunk* backChunk)
+{
+    Chunk* nextChunk = backChunk->next.load(std::memory_order_acquire);
+
+    if(nullptr != nextChunk)
+        return nextChunk;
+
+    Chunk* newChunk = createChunk();
+
+    if(backChunk->next.compare_exchange_strong(nextChunk, newChunk, std::memory_order_acq_rel, std::memory_order_acquire))
+        return newChunk;
+
+    // Another producer has won, the new chunk was never shared
+    ChunkTraits::destroy(chunkAllocator, newChunk);
+    ChunkTraits::deallocate(chunkAllocator, newChunk, 1);
+
+    return nextChunk;
+}
+
+/**
+ * @brief   Unlinks the consumed front chunk and retires it
+ * @param   frontChunk  Consumed front chunk, protected by the guard
+ * @param   nextChunk   Chunk linked after the front chunk
+ * @param   guard       Guard of the calling thread
+ * @note    The tail is moved first, so that the retired chunk cannot be reached from either end.
+ * @note    Both exchanges are sequentially consistent like the hazard publication in HazardDomain::Guard::protect(..),
+ *          so either the retiring scan sees the hazard or the protecting thread sees the unlinked chunk.
+ */
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t MAX_THREADS>
+void ConcurrentQueue<T, C_SIZE, Allocator, MAX_THREADS>::advanceFront(Chunk* frontChunk, Chunk* nextChunk, typename Domain::Guard& guard)
+{
+    Chunk* expected = frontChunk;
+
+    tail.compare_exchange_strong(expected, nextChunk, std::memory_order_seq_cst, std::memory_order_relaxed);
+
+    expected = frontChunk;
+
+    if(head.compare_exchange_strong(expected, nextChunk, std::memory_order_seq_cst, std::memory_order_relaxed))
+    {
+        guard.clear();
+        guard.retire(frontChunk);
+    }
+}
@@ -0,0 +1,132 @@
+/**
+ * @file        ContainerStats.h
+ * @details     Opt-in counters for the allocation and the copy activity of the containers.
+ *              Counters are kept per container type(e.g. Vector<int>) and shared by all of its instances.
+ *              Define CONTAINER_STATS_ENABLED before including any container to enable them,
+ *              otherwise the recording points compile to nothing and stats() returns zeros.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstdint>              // std::uint64_t
+
+#if defined(CONTAINER_STATS_ENABLED)
+#include <atomic>               // std::atomic
+#endif
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+namespace ContainerStats {
+    #if defined(CONTAINER_STATS_ENABLED)
+    inline constexpr bool enabled = true;
+    #else
+    inline constexpr bool enabled = false;
+    #endif
+
+    /*** Counter Values ***/
+    struct Snapshot {
+        std::uint64_t reallocations     = 0;    // Storage replacements of Vector and FlatHashMap
+        std::uint64_t chunkCreations    = 0;    // Chunks allocated by Queue, reused spare chunks are excluded
+        std::uint64_t chunkRemovals     = 0;    // Chunks deallocated by Queue, chunks kept as spare are excluded
+        std::uint64_t nodeAllocations   = 0;    // Nodes allocated by List
+        std::uint64_t nodeDeallocations = 0;    // Nodes deallocated by List
+        std::uint64_t bytesCopied       = 0;    // Bytes of the elements created by copying
+        std::uint64_t bytesMoved        = 0;    // Bytes of the elements created by moving or relocating
+
+        /**
+         * @brief   Calls the visitor with the name and the value of each counter, for exporting to a metrics system
+         * @param   visitor Callable object taking (const char* name, std::uint64_t value)
+         */
+        template<class Visitor>
+        void visit(Visitor&& visitor) const
+        {
+            visitor("reallocations",        reallocations);
+            visitor("chunk_creations",      chunkCreations);
+            visitor("chunk_removals",       chunkRemovals);
+            visitor("node_allocations",     nodeAllocations);
+            visitor("node_deallocations",   nodeDeallocations);
+            visitor("bytes_copied",         bytesCopied);
+            visitor("bytes_moved",          bytesMoved);
+        }
+    };
+
+    #if defined(CONTAINER_STATS_ENABLED)
+    /*** Counters ***/
+    // Relaxed atomics, instances of the same type may live in different threads
+    struct Counters {
+        std::atomic<std::uint64_t> reallocations{0};
+        std::atomic<std::uint64_t> chunkCreations{0};
+        std::atomic<std::uint64_t> chunkRemovals{0};
+        std::atomic<std::uint64_t> nodeAllocations{0};
+        std::atomic<std::uint64_t> nodeDeallocations{0};
+        std::atomic<std::uint64_t> bytesCopied{0};
+        std::atomic<std::uint64_t> bytesMoved{0};
+
+        NODISCARD Snapshot snapshot() const noexcept
+        {
+            Snapshot values;
+
+            values.reallocations        = reallocations.load(std::memory_order_relaxed);
+            values.chunkCreations       = chunkCreations.load(std::memory_order_relaxed);
+            values.chunkRemovals        = chunkRemovals.load(std::memory_order_relaxed);
+            values.nodeAllocations      = nodeAllocations.load(std::memory_order_relaxed);
+            values.nodeDeallocations    = nodeDeallocations.load(std::memory_order_relaxed);
+            values.bytesCopied          = bytesCopied.load(std::memory_order_relaxed);
+            values.bytesMoved           = bytesMoved.load(std::memory_order_relaxed);
+
+            return values;
+        }
+
+        void reset() noexcept
+        {
+            reallocations.store(0, std::memory_order_relaxed);
+            chunkCreations.store(0, std::memory_order_relaxed);
+            chunkRemovals.store(0, std::memory_order_relaxed);
+            nodeAllocations.store(0, std::memory_order_relaxed);
+            nodeDeallocations.store(0, std::memory_order_relaxed);
+            bytesCopied.store(0, std::memory_order_relaxed);
+            bytesMoved.store(0, std::memory_order_relaxed);
+        }
+    };
+
+    template<class Container>
+    NODISCARD Counters& countersOf() noexcept
+    {
+        static Counters counters;
+
+        return counters;
+    }
+
+    template<class Container>
+    NODISCARD Snapshot snapshotOf() noexcept   { return countersOf<Container>().snapshot(); }
+
+    template<class Container>
+    void resetOf() noexcept                     { countersOf<Container>().reset(); }
+
+    // Adds to a counter of the given container type, the type must not contain commas(use the injected class name)
+    #define CONTAINER_STATS_RECORD(CONTAINER, COUNTER, AMOUNT) \
+        ContainerStats::countersOf<CONTAINER>().COUNTER.fetch_add(std::uint64_t(AMOUNT), std::memory_order_relaxed)
+    #else
+    template<class Container>
+    NODISCARD constexpr Snapshot snapshotOf() noexcept  { return Snapshot(); }
+
+    template<class Container>
+    constexpr void resetOf() noexcept                   { /* No operation */ }
+
+    // The arguments are not evaluated
+    #define CONTAINER_STATS_RECORD(CONTAINER, COUNTER, AMOUNT) ((void)0)
+    #endif
+}
@@ -0,0 +1,252 @@
+/**
+ * @file        CopyOnWriteContainer.h
+ * @details     A copy-on-write wrapper sharing a single container among its copies.
+ *              Copies only increment an atomic reference count, the contents are cloned at the first modification
+ *              of a shared instance. Intended for large read-mostly tables passed by value across threads.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *                               -> Written containers are cloned by the copies, moved-from instances are empty.
+ *
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include "ArrayContainer.h"     // Array
+#include "VectorContainer.h"    // Vector
+#include <atomic>               // std::atomic
+#include <cstddef>              // std::size_t
+#include <memory>               // std::allocator
+#include <new>                  // std::bad_alloc
+#include <utility>              // std::move, std::forward, std::in_place_t
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Wrapper Class ***/
+/* The shared container lives in a block together with its reference count, any container type can be wrapped.
+ * Reading is done through the const accessors, which never copy. write() returns a modifiable container,
+ * cloning it first if another instance still refers to it.
+ * Distinct instances sharing the same block can be used from different threads without synchronization,
+ * a single instance must not be read and written concurrently, as for std::shared_ptr.
+ * Once write() is called, the container is no longer shared by the copies of the instance but cloned for them,
+ * so that a kept reference cannot modify a copy. Instances assigned or cloned from it share their containers again.
+ * A moved-from instance is empty, it refers to no container until it is assigned or written. */
+template<class Container>
+class CopyOnWrite {
+public:
+    using container_type = Container;
+
+    /*** Constructors and Destructor ***/
+    CopyOnWrite() : block(new SharedBlock()) { }                                        // Empty container
+    explicit CopyOnWrite(const Container& container) : block(new SharedBlock(container)) { }
+    explicit CopyOnWrite(Container&& container) : block(new SharedBlock(std::move(container))) { }
+
+    template<class... Args>
+    explicit CopyOnWrite(std::in_place_t, Args&&... args) : block(new SharedBlock(std::forward<Args>(args)...)) { }
+
+    CopyOnWrite(const CopyOnWrite& copyInstance);
+    CopyOnWrite(CopyOnWrite&& moveInstance) noexcept : block(moveInstance.block) { moveInstance.block = nullptr; }
+    ~CopyOnWrite() { release(); }
+
+    /*** Operator Overloadings ***/
+    CopyOnWrite& operator=(const CopyOnWrite& rightInstance);
+    CopyOnWrite& operator=(CopyOnWrite&& rightInstance) noexcept;
+
+    /*** Element Access ***/
+    NODISCARD const Container& read() const noexcept            { return (nullptr != block) ? block->container : emptyContainer(); }
+    NODISCARD const Container& operator*() const noexcept       { return read();    }
+    NODISCARD const Container* operator->() const noexcept      { return &read();   }
+    NODISCARD Container& write();                               // Clones the container if it is shared
+
+    template<class Index>
+    NODISCARD decltype(auto) operator[](const Index& index) const { return read()[index]; }
+
+    /*** Modifiers ***/
+    void swap(CopyOnWrite& anotherInstance) noexcept { std::swap(block, anotherInstance.block); }
+
+    /*** Status Checkers ***/
+    NODISCARD std::size_t useCount() const noexcept;            // Number of instances sharing the container, 0 if moved-from
+    NODISCARD bool isUnique() const noexcept { return (1 == useCount()); }
+    NODISCARD bool isSharedWith(const CopyOnWrite& other) const noexcept { return (block == other.block) && (nullptr != block); }
+
+    /*** Iterators ***/
+    NODISCARD auto begin() const    { return read().begin();    }
+    NODISCARD auto end() const      { return read().end();      }
+    NODISCARD auto cbegin() const   { return read().begin();    }
+    NODISCARD auto cend() const     { return read().end();      }
+
+    /*** Comparison ***/
+    NODISCARD bool operator==(const CopyOnWrite& rightInstance) const { return isSharedWith(rightInstance) || (read() == rightInstance.read()); }
+    NODISCARD bool operator!=(const CopyOnWrite& rightInstance) const { return !(*this == rightInstance); }
+
+private:
+    struct SharedBlock {
+        template<class... Args>
+        explicit SharedBlock(Args&&... args) : container(std::forward<Args>(args)...) { }
+
+        std::atomic<std::size_t>    refCount{1};
+        bool                        isShareable = true;     // Cleared by write(), only its unique owner modifies it
+        Container                   container;
+    };
+
+    NODISCARD SharedBlock* shareBlock() const;      // Reference for a copy, a clone if the block is not shareable
+    void release() noexcept;                        // Drops the reference, destroys the block if it was the last one
+
+    // Viewed by the empty instances, so that they can be read like any other
+    NODISCARD static const Container& emptyContainer() noexcept
+    {
+        static const Container empty;
+
+        return empty;
+    }
+
+    /*** Members ***/
+    SharedBlock* block;
+};
+
+/**
+ * @brief   Copy constructor, shares the container of the given instance
+ * @param   copyInstance    Instance to be shared
+ * @throws  std::bad_alloc  If the container has been written and its clone cannot be allocated
+ */
+template<class Container>
+CopyOnWrite<Container>::CopyOnWrite(const CopyOnWrite& copyInstance)
+: block(copyInstance.shareBlock())
+{ /* No operation */ }
+
+/**
+ * @brief   Copy assignment operator, shares the container of the given instance
+ * @param   rightInstance   Instance to be shared
+ * @return  lValue reference to the left instance to support cascaded calls
+ * @throws  std::bad_alloc  If the container has been written and its clone cannot be allocated, the left instance stays unchanged
+ */
+template<class Container>
+CopyOnWrite<Container>& CopyOnWrite<Container>::operator=(const CopyOnWrite& rightInstance)
+{
+    if(block != rightInstance.block)
+    {
+        SharedBlock* const sharedBlock = rightInstance.shareBlock();
+
+        release();
+        block = sharedBlock;
+    }
+
+    return *this;
+}
+
+/**
+ * @brief   Move assignment operator, takes over the reference of the given instance
+ * @param   rightInstance   Instance to be moved, empty afterwards
+ * @return  lValue reference to the left instance to support cascaded calls
+ */
+template<class Container>
+CopyOnWrite<Container>& CopyOnWrite<Container>::operator=(CopyOnWrite&& rightInstance) noexcept
+{
+    if(this != &rightInstance)
+    {
+        release();
+        block = rightInstance.block;
+        rightInstance.block = nullptr;
+    }
+
+    return *this;
+}
+
+/**
+ * @brief   Returns the container for modification, cloning it first if it is shared
+ * @return  lValue reference to a container used by this instance only
+ * @throws  std::bad_alloc  If the clone cannot be allocated, the instance stays unchanged
+ * @note    An empty instance gets a new empty container.
+ * @note    The reference stays valid until the instance is assigned, moved or destroyed, copies clone the container.
+ */
+template<class Container>
+Container& CopyOnWrite<Container>::write()
+{
+    if(nullptr == block)
+    {
+        block = new SharedBlock();
+    }
+    // Acquire pairs with the release of the other owners, their reads are complete before the in-place modification
+    else if(1 != block->refCount.load(std::memory_order_acquire))
+    {
+        SharedBlock* const clone = new SharedBlock(static_cast<const Container&>(block->container));
+
+        release();
+        block = clone;
+    }
+
+    block->isShareable = false;     // The returned reference may outlive this call
+
+    return block->container;
+}
+
+/**
+ * @brief   Returns the number of instances sharing the container
+ * @return  Number of instances, 0 for an empty instance
+ * @note    The value may be outdated immediately if other threads copy or destroy the instances concurrently.
+ */
+template<class Container>
+std::size_t CopyOnWrite<Container>::useCount() const noexcept
+{
+    return (nullptr != block) ? block->refCount.load(std::memory_order_acquire) : 0;
+}
+
+/**
+ * @brief   Creates a reference to the container for a copy of this instance
+ * @return  Block shared with this instance, a clone of it if the container has been written, nullptr if empty
+ * @throws  std::bad_alloc  If the clone cannot be allocated
+ */
+template<class Container>
+typename CopyOnWrite<Container>::SharedBlock* CopyOnWrite<Container>::shareBlock() const
+{
+    if(nullptr == block)
+        return nullptr;
+
+    if(!block->isShareable)
+        return new SharedBlock(static_cast<const Container&>(block->container));
+
+    // No ordering is needed, the new reference is created from an existing one
+    block->refCount.fetch_add(1, std::memory_order_relaxed);
+
+    return block;
+}
+
+/**
+ * @brief   Drops the reference of this instance, destroys the block if it was the last one
+ */
+template<class Container>
+void CopyOnWrite<Container>::release() noexcept
+{
+    // Release publishes the reads of this owner, acquire lets the last owner see all of them before the destruction
+    if((nullptr != block) && (1 == block->refCount.fetch_sub(1, std::memory_order_acq_rel)))
+        delete block;
+
+    block = nullptr;
+}
+
+/**
+ * @brief   Swaps the containers of two instances without copying
+ * @param   left    First instance
+ * @param   right   Second instance
+ */
+template<class Container>
+void swap(CopyOnWrite<Container>& left, CopyOnWrite<Container>& right) noexcept
+{
+    left.swap(right);
+}
+
+/*** Container Aliases ***/
+template<class T, class Allocator = std::allocator<T>>
+using CowArray = CopyOnWrite<Array<T, Allocator>>;
+
+template<class T, class Allocator = std::allocator<T>, class GrowthPolicy = PowerOf2Growth>
+using CowVector = CopyOnWrite<Vector<T, Allocator, GrowthPolicy>>;
@@ -0,0 +1,1236 @@
+/**
+ * @file        FlatHashMapContainer.h
+ * @details     A template open addressing hash map keeping its entries in a single contiguous slot array.
+ *              Each slot has a control byte holding 7 bits of the hash, groups of control bytes are probed with SIMD.
+ *              Deletion shifts the following entries back instead of leaving tombstones.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *                               -> Slots are unions of both pair types instead of casting between them, large entries are documented.
+ *
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstddef>              // std::size_t, std::ptrdiff_t
+#include <cstdint>              // Fixed width integers
+#include <cstring>              // std::memcpy, std::memset
+#include <functional>           // std::hash
+#include <initializer_list>     // std::initializer_list
+#include <iterator>             // std::forward_iterator_tag
+#include <memory>               // std::allocator, std::allocator_traits
+#include <stdexcept>            // Exceptions
+#include <tuple>                // std::forward_as_tuple
+#include <type_traits>          // Type traits
+#include <utility>              // std::pair, std::move, std::forward
+#include "SimdKernels.h"        // SIMD_KERNELS_* target selection
+#include "ContainerStats.h"     // CONTAINER_STATS_RECORD, ContainerStats::Snapshot
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+namespace FlatHashMapDetail {
+
+/* A control byte is EMPTY or holds the lowest 7 bits of the hash of its entry, so that the sign bit marks the empty slots.
+ * The control array ends with a copy of its first Group::WIDTH bytes, a group can be loaded at any slot without wrapping. */
+using ControlByte = std::int8_t;
+
+constexpr ControlByte EMPTY = -128;
+
+NODISCARD inline std::size_t lowestSetBit(std::uint64_t bits) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return std::size_t(__builtin_ctzll(bits));
+#else
+    std::size_t index = 0;
+
+    for(; 0 == (bits & 1u); bits >>= 1)
+        ++index;
+
+    return index;
+#endif
+}
+
+// Slots of a group matching a condition, each slot is represented by (1 << SHIFT) bits
+template<std::size_t SHIFT>
+class BitMask {
+public:
+    explicit BitMask(std::uint64_t bits) noexcept : bits(bits) { }
+
+    NODISCARD explicit operator bool() const noexcept { return (0 != bits); }
+    NODISCARD std::size_t lowest() const noexcept { return lowestSetBit(bits) >> SHIFT; }   // Offset of the first matching slot
+    void removeLowest() noexcept { bits &= (bits - 1); }
+
+private:
+    std::uint64_t bits;
+};
+
+#if defined(SIMD_KERNELS_AVX2) || defined(SIMD_KERNELS_SSE2)
+// 16 control bytes are compared at once, the byte mask has a single bit per slot
+class Group {
+public:
+    static constexpr std::size_t WIDTH = 16;
+
+    explicit Group(const ControlByte* position) noexcept : control(_mm_loadu_si128(reinterpret_cast<const __m128i*>(position))) { }
+
+    NODISCARD BitMask<0> match(const ControlByte hashBits) const noexcept
+    {
+        return BitMask<0>(std::uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(hashBits), control))));
+    }
+
+    NODISCARD BitMask<0> matchEmpty() const noexcept { return BitMask<0>(std::uint32_t(_mm_movemask_epi8(control))); }
+
+private:
+    __m128i control;
+};
+#elif defined(SIMD_KERNELS_NEON)
+// 8 control bytes are compared at once, each matching slot sets the sign bit of its byte
+class Group {
+public:
+    static constexpr std::size_t WIDTH = 8;
+
+    explicit Group(const ControlByte* position) noexcept : control(vld1_s8(position)) { }
+
+    NODISCARD BitMask<3> match(const ControlByte hashBits) const noexcept
+    {
+        return BitMask<3>(vget_lane_u64(vreinterpret_u64_u8(vceq_s8(control, vdup_n_s8(hashBits))), 0) & SIGN_BITS);
+    }
+
+    NODISCARD BitMask<3> matchEmpty() const noexcept
+    {
+        return BitMask<3>(vget_lane_u64(vreinterpret_u64_s8(control), 0) & SIGN_BITS);
+    }
+
+private:
+    static constexpr std::uint64_t SIGN_BITS = 0x8080808080808080ull;
+
+    int8x8_t control;
+};
+#else
+// 8 control bytes are compared as a single word, each matching slot sets the sign bit of its byte
+class Group {
+public:
+    static constexpr std::size_t WIDTH = 8;
+
+    explicit Group(const ControlByte* position) noexcept
+    {
+        std::memcpy(&control, position, sizeof(control));
+
+    #if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+        control = __builtin_bswap64(control);   // The first slot shall be the lowest byte
+    #endif
+    }
+
+    /* A byte is zero after the xor if it matches, the subtraction sets its sign bit.
+     * Bytes above a match may be reported too, which costs a key comparison but never misses an entry. */
+    NODISCARD BitMask<3> match(const ControlByte hashBits) const noexcept
+    {
+        const std::uint64_t difference = control ^ (LOWEST_BITS * std::uint8_t(hashBits));
+
+        return BitMask<3>((difference - LOWEST_BITS) & ~difference & SIGN_BITS);
+    }
+
+    NODISCARD BitMask<3> matchEmpty() const noexcept { return BitMask<3>(control & SIGN_BITS); }
+
+private:
+    static constexpr std::uint64_t LOWEST_BITS  = 0x0101010101010101ull;
+    static constexpr std::uint64_t SIGN_BITS    = 0x8080808080808080ull;
+
+    std::uint64_t control;
+};
+#endif
+
+} // namespace FlatHashMapDetail
+
+/*** Container Class ***/
+/* Entries are placed by linear probing from the slot selected by the hash, shifting back the following entries on deletion
+ * keeps every entry reachable from its home slot without gaps. A lookup ends at the first group having an empty slot.
+ * The table grows to the next power of 2 once the number of entries reaches the load factor limit, a slot is always kept empty.
+ * Rehashing and deletion invalidate the iterators, the references to the entries are invalidated as well since entries move.
+ * Keys and values must be nothrow move constructible and the hasher must not throw, as the entries are moved during rehashing.
+ * Large entries make both moves expensive, a growing map copies every entry at each rehash and an erasure copies the shifted ones.
+ * For entries of a few hundred bytes, reserve(..) the expected size up front and keep large values behind a std::unique_ptr. */
+template<class K, class V, class Hash = std::hash<K>, class Allocator = std::allocator<std::pair<const K, V>>>
+class FlatHashMap {
+    /* The entry of a full slot is always constructed as the pair with a const key, it is the object exposed by the iterators.
+     * Moving an entry reads it through the pair with a modifiable key, the members of both pairs share their layout.
+     * This is the same union used by the hash value type of libc++, no pointer of one pair type is cast to the other. */
+    union Slot {
+        Slot()  { }
+        ~Slot() { }
+
+        std::pair<const K, V>   value;
+        std::pair<K, V>         movable;
+    };
+
+    static_assert(std::is_nothrow_move_constructible_v<std::pair<K, V>>, "Keys and values must be nothrow move constructible!");
+
+    using ControlByte   = FlatHashMapDetail::ControlByte;
+    using Group         = FlatHashMapDetail::Group;
+
+    template<bool IS_CONST>
+    class basic_iterator;
+
+public:
+    /*** C++ Standard Named Requirements for Containers ***/
+    using key_type          = K;
+    using mapped_type       = V;
+    using value_type        = std::pair<const K, V>;
+    using size_type         = std::size_t;
+    using difference_type   = std::ptrdiff_t;
+    using hasher            = Hash;
+    using allocator_type    = Allocator;
+    using reference         = value_type&;
+    using const_reference   = const value_type&;
+    using iterator          = basic_iterator<false>;
+    using const_iterator    = basic_iterator<true>;
+
+    static constexpr float DEFAULT_MAX_LOAD_FACTOR = 0.875f;
+
+    /*** Constructors and Destructors ***/
+    FlatHashMap() = default;
+    explicit FlatHashMap(const allocator_type& alloc) : allocator(alloc) { }
+    explicit FlatHashMap(const size_type expectedSize, const Hash& hashFunction = Hash(), const allocator_type& alloc = allocator_type());
+
+    template<class InputIterator, class = std::enable_if_t<!std::is_integral_v<InputIterator>>>
+    FlatHashMap(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type());  // Range constructor
+
+    FlatHashMap(std::initializer_list<value_type> initializerList, const allocator_type& alloc = allocator_type());
+    FlatHashMap(const FlatHashMap& copyMap);
+    FlatHashMap(const FlatHashMap& copyMap, const allocator_type& alloc);
+    FlatHashMap(FlatHashMap&& moveMap) noexcept;
+    FlatHashMap(FlatHashMap&& moveMap, const allocator_type& alloc);
+
+    ~FlatHashMap() { releaseStorage(); }
+
+    /*** Operator Overloadings ***/
+    FlatHashMap& operator=(const FlatHashMap& copyMap);
+    FlatHashMap& operator=(FlatHashMap&& moveMap) noexcept(std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value ||
+                                                          std::allocator_traits<Allocator>::is_always_equal::value);
+
+    NODISCARD bool operator==(const FlatHashMap& rightMap) const;
+    NODISCARD bool operator!=(const FlatHashMap& rightMap) const { return !(*this == rightMap); }
+
+    /*** Element Access ***/
+    mapped_type& operator[](const key_type& key)    { return try_emplace(key).first->second;            }  // Inserts a default value if not found
+    mapped_type& operator[](key_type&& key)         { return try_emplace(std::move(key)).first->second; }  // Inserts a default value if not found
+    NODISCARD mapped_type& at(const key_type& key);
+    NODISCARD const mapped_type& at(const key_type& key) const;
+
+    /*** Lookup ***/
+    NODISCARD iterator find(const key_type& key);
+    NODISCARD const_iterator find(const key_type& key) const;
+    NODISCARD bool contains(const key_type& key) const  { return (NOT_FOUND != findIndex(key, hashOf(key)));    }
+    NODISCARD size_type count(const key_type& key) const { return contains(key) ? 1 : 0;                       }
+
+    /*** Modifiers ***/
+    std::pair<iterator, bool> insert(const value_type& value)   { return tryEmplace(value.first, value.second);             }
+    std::pair<iterator, bool> insert(value_type&& value)        { return tryEmplace(value.first, std::move(value.second));  }
+
+    template<class InputIterator>
+    void insert(InputIterator first, InputIterator last);
+    void insert(std::initializer_list<value_type> initializerList) { insert(initializerList.begin(), initializerList.end()); }
+
+    template<class... Args>
+    std::pair<iterator, bool> emplace(Args&&... args);          // Constructs the entry first, then inserts it if its key is not found
+
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args)  { return tryEmplace(key, std::forward<Args>(args)...);               }
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args)       { return tryEmplace(std::move(key), std::forward<Args>(args)...);    }
+
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& value);
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(key_type&& key, M&& value);
+
+    size_type erase(const key_type& key);                       // Returns the number of erased entries
+    void erase(const_iterator position);                        // The following entries may move, iterators are invalidated
+
+    template<class Predicate>
+    size_type erase_if(Predicate pred);                         // Erases all entries fulfilling the predicate in a single pass
+
+    void clear() noexcept;
+    void swap(FlatHashMap& swapMap) noexcept;
+
+    /*** Size and Capacity ***/
+    NODISCARD bool empty()          const noexcept { return (0 == sz);  }
+    NODISCARD size_type size()      const noexcept { return sz;         }
+    NODISCARD size_type capacity()  const noexcept { return cap;        }   // Number of slots
+    NODISCARD size_type max_size()  const noexcept { return std::allocator_traits<SlotAllocator>::max_size(allocator) / 2; }
+
+    void reserve(const size_type expectedSize);                 // Makes room for the given number of entries without rehashing
+    void rehash(const size_type slotCount);                     // Rebuilds with at least the given number of slots, 0 shrinks to fit
+
+    /*** Hash Policy ***/
+    NODISCARD float load_factor() const noexcept { return (0 == cap) ? 0.0f : (float(sz) / float(cap)); }
+    NODISCARD float max_load_factor() const noexcept { return maxLoad; }
+    void max_load_factor(const float loadFactor);
+
+    /*** Observers ***/
+    NODISCARD hasher hash_function() const { return hash; }
+    NODISCARD allocator_type get_allocator() const noexcept { return allocator_type(allocator); }
+
+    /*** Statistics ***/
+    NODISCARD static ContainerStats::Snapshot stats() noexcept { return ContainerStats::snapshotOf<FlatHashMap>(); }  // Zeros unless enabled
+
+    /*** Iterators ***/
+    NODISCARD iterator begin() noexcept                 { return iterator(control, control + cap, slots);       }
+    NODISCARD iterator end() noexcept                   { return iterator(control + cap, control + cap, slots + cap); }
+    NODISCARD const_iterator begin() const noexcept     { return const_iterator(control, control + cap, slots); }
+    NODISCARD const_iterator end() const noexcept       { return const_iterator(control + cap, control + cap, slots + cap); }
+    NODISCARD const_iterator cbegin() const noexcept    { return begin();   }
+    NODISCARD const_iterator cend() const noexcept      { return end();     }
+
+private:
+    using SlotAllocator     = typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+    using SlotTraits        = std::allocator_traits<SlotAllocator>;
+    using ControlAllocator  = typename std::allocator_traits<Allocator>::template rebind_alloc<ControlByte>;
+    using ControlTraits     = std::allocator_traits<ControlAllocator>;
+
+    static constexpr size_type MIN_CAPACITY = (Group::WIDTH > 16) ? Group::WIDTH : 16;
+    static constexpr size_type NOT_FOUND    = size_type(-1);
+
+    // Forward iterator skipping the empty slots, the end iterator points to the slot after the last one
+    template<bool IS_CONST>
+    class basic_iterator {
+        friend class FlatHashMap;
+        friend class basic_iterator<!IS_CONST>;
+
+        using SlotPtr = std::conditional_t<IS_CONST, const Slot*, Slot*>;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = FlatHashMap::value_type;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::conditional_t<IS_CONST, const value_type*, value_type*>;
+        using reference         = std::conditional_t<IS_CONST, const value_type&, value_type&>;
+
+        basic_iterator() = default;
+
+        // Conversion from iterator to const_iterator
+        template<bool OTHER_CONST, class = std::enable_if_t<IS_CONST && !OTHER_CONST>>
+        basic_iterator(const basic_iterator<OTHER_CONST>& other) : control(other.control), controlEnd(other.controlEnd), slot(other.slot) { }
+
+        NODISCARD reference operator*()  const { return *operator->(); }
+        NODISCARD pointer   operator->() const { return &slot->value; }
+
+        basic_iterator& operator++()    { ++control; ++slot; skipEmpty(); return *this; }
+        basic_iterator  operator++(int) { basic_iterator previous = *this; ++(*this); return previous; }
+
+        NODISCARD bool operator==(const basic_iterator& other) const { return (slot == other.slot); }
+        NODISCARD bool operator!=(const basic_iterator& other) const { return (slot != other.slot); }
+
+    private:
+        basic_iterator(const ControlByte* control, const ControlByte* controlEnd, SlotPtr slot) : control(control), controlEnd(controlEnd), slot(slot)
+        {
+            skipEmpty();
+        }
+
+        void skipEmpty() noexcept
+        {
+            while((control != controlEnd) && (*control < 0))
+            {
+                ++control;
+                ++slot;
+            }
+        }
+
+        const ControlByte*  control     = nullptr;
+        const ControlByte*  controlEnd  = nullptr;
+        SlotPtr             slot        = nullptr;
+    };
+
+    /*** Members ***/
+    Slot*           slots       = nullptr;
+    ControlByte*    control     = nullptr;  // cap + Group::WIDTH bytes, the last ones mirror the first ones
+    size_type       sz          = 0;
+    size_type       cap         = 0;        // 0 or a power of 2 not less than MIN_CAPACITY
+    size_type       growthLimit = 0;        // Number of entries triggering growth
+    float           maxLoad     = DEFAULT_MAX_LOAD_FACTOR;
+    Hash            hash;
+    SlotAllocator   allocator;
+
+    /*** Helper Functions ***/
+    // Hash of the key mixed so that both the low and the high bits depend on all bits of the original hash
+    NODISCARD size_type hashOf(const key_type& key) const
+    {
+        std::uint64_t mixed = std::uint64_t(hash(key));
+
+        mixed ^= mixed >> 33;
+        mixed *= 0xFF51AFD7ED558CCDull;
+        mixed ^= mixed >> 33;
+
+        return size_type(mixed);
+    }
+
+    NODISCARD static ControlByte controlOf(const size_type hashValue) noexcept   { return ControlByte(hashValue & 0x7F); }
+    NODISCARD size_type homeOf(const size_type hashValue) const noexcept        { return (hashValue >> 7) & (cap - 1); }
+
+    NODISCARD size_type findIndex(const key_type& key, const size_type hashValue) const;
+    NODISCARD size_type findEmpty(const size_type hashValue) const noexcept;
+    NODISCARD size_type growthLimitOf(const size_type slotCount) const noexcept;
+    NODISCARD size_type capacityFor(const size_type entryCount) const;
+
+    template<class KeyArg, class... Args>
+    std::pair<iterator, bool> tryEmplace(KeyArg&& key, Args&&... args);
+
+    void setControl(const size_type index, const ControlByte value) noexcept;
+    void eraseAt(size_type index) noexcept;
+    void resizeTable(const size_type newCap);
+    void allocateTable(const size_type newCap, Slot*& newSlots, ControlByte*& newControl);
+    void deallocateTable(Slot* oldSlots, ControlByte* oldControl, const size_type oldCap) noexcept;
+
+    template<bool MOVE, class SourceMap>
+    void cloneFrom(SourceMap& source);                          // Constructs the entries at the same slots as the source
+    void takeOver(FlatHashMap& source) noexcept;                // Takes the storage of the source, not the allocator
+    void releaseStorage() noexcept;
+
+    NODISCARD iterator iteratorAt(const size_type index) noexcept               { return iterator(control + index, control + cap, slots + index);        }
+    NODISCARD const_iterator iteratorAt(const size_type index) const noexcept   { return const_iterator(control + index, control + cap, slots + index);  }
+};
+
+/**
+ * @brief   Constructs an empty map with room for the given number of entries
+ * @param   expectedSize    Number of entries which can be inserted without rehashing
+ * @param   hashFunction    Hasher object
+ * @param   alloc           Allocator object
+ */
+template<class K, class V, class Hash, class Allocator>
+FlatHashMap<K, V, Hash, Allocator>::FlatHashMap(const size_type expectedSize, const Hash& hashFunction, const allocator_type& alloc)
+: hash(hashFunction), allocator(alloc)
+{
+    reserve(expectedSize);
+}
+
+/**
+ * @brief   Range constructor, the later duplicates of a key are ignored
+ * @param   first   Iterator to the first entry
+ * @param   last    Iterator to the entry after the last one
+ * @param   alloc   Allocator object
+ */
+template<class K, class V, class Hash, class Allocator>
+template<class InputIterator, class>
+FlatHashMap<K, V, Hash, Allocator>::FlatHashMap(InputIterator first, InputIterator last, const allocator_type& alloc)
+: allocator(alloc)
+{
+    insert(first, last);
+}
+
+/**
+ * @brief   Initializer list constructor, the later duplicates of a key are ignored
+ * @param   initializerList Entries to be inserted
+ * @param   alloc           Allocator object
+ */
+template<class K, class V, class Hash, class Allocator>
+FlatHashMap<K, V, Hash, Allocator>::FlatHashMap(std::initializer_list<value_type> initializerList, const allocator_type& alloc)
+: allocator(alloc)
+{
+    reserve(initializerList.size());
+    insert(initializerList.begin(), initializerList.end());
+}
+
+/**
+ * @brief   Copy constructor, the entries are copied to the same slots without rehashing
+ * @param   copyMap Map to be copied
+ */
+template<class K, class V, class Hash, class Allocator>
+FlatHashMap<K, V, Hash, Allocator>::FlatHashMap(const FlatHashMap& copyMap)
+: maxLoad(copyMap.maxLoad), hash(copyMap.hash), allocator(SlotTraits::select_on_container_copy_construction(copyMap.allocator))
+{
+    cloneFrom<false>(copyMap);
+}
+
+/**
+ * @brief   Copy constructor with an allocator, the entries are copied to the same slots without rehashing
+ * @param   copyMap Map to be copied
+ * @param   alloc   Allocator object of the new map
+ */
+template<class K, class V, class Hash, class Allocator>
+FlatHashMap<K, V, Hash, Allocator>::FlatHashMap(const FlatHashMap& copyMap, const allocator_type& alloc)
+: maxLoad(copyMap.maxLoad), hash(copyMap.hash), allocator(alloc)
+{
+    cloneFrom<false>(copyMap);
+}
+
+/**
+ * @brief   Move constructor, takes over the storage
+ * @param   moveMap Map to be moved, left empty
+ */
+template<class K, class V, class Hash, class Allocator>
+FlatHashMap<K, V, Hash, Allocator>::FlatHashMap(FlatHashMap&& moveMap) noexcept
+: maxLoad(moveMap.maxLoad), hash(moveMap.hash), allocator(std::move(moveMap.allocator))
+{
+    takeOver(moveMap);
+}
+
+/**
+ * @brief   Move constructor with an allocator, the entries are moved one by one if the allocators differ
+ * @param   moveMap Map to be moved, left empty if its storage is taken over
+ * @param   alloc   Allocator object of the new map
+ */
+template<class K, class V, class Hash, class Allocator>
+FlatHashMap<K, V, Hash, Allocator>::FlatHashMap(FlatHashMap&& moveMap, const allocator_type& alloc)
+: maxLoad(moveMap.maxLoad), hash(moveMap.hash), allocator(alloc)
+{
+    if(allocator == moveMap.allocator)
+        takeOver(moveMap);
+    else
+        cloneFrom<true>(moveMap);
+}
+
+/**
+ * @brief   Copy assignment operator, provides the strong exception guarantee
+ * @param   copyMap Map to be copied
+ * @return  lValue reference to the left map to support cascaded calls
+ */
+template<class K, class V, class Hash, class Allocator>
+FlatHashMap<K, V, Hash, Allocator>& FlatHashMap<K, V, Hash, Allocator>::operator=(const FlatHashMap& copyMap)
+{
+    if(this != &copyMap)
+    {
+        constexpr bool propagate = SlotTraits::propagate_on_container_copy_assignment::value;
+
+        // Allocated with the allocator which this map will have afterwards
+        FlatHashMap copy(copyMap, allocator_type(propagate ? copyMap.allocator : allocator));
+
+        releaseStorage();
+
+        if constexpr(propagate)
+            allocator = copyMap.allocator;
+
+        maxLoad = copyMap.maxLoad;
+        hash    = copyMap.hash;
+        takeOver(copy);
+    }
+
+    return *this;
+}
+
+/**
+ * @brief   Move assignment operator, takes over the storage if the allocators allow
+ * @param   moveMap Map to be moved
+ * @return  lValue reference to the left map to support cascaded calls
+ */
+template<class K, class V, class Hash, class Allocator>
+FlatHashMap<K, V, Hash, Allocator>& FlatHashMap<K, V, Hash, Allocator>::operator=(FlatHashMap&& moveMap)
+    noexcept(std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value ||
+             std::allocator_traits<Allocator>::is_always_equal::value)
+{
+    if(this == &moveMap)
+        return *this;
+
+    constexpr bool propagate = SlotTraits::propagate_on_container_move_assignment::value;
+
+    if constexpr(propagate || SlotTraits::is_always_equal::value)
+    {
+        releaseStorage();
+
+        if constexpr(propagate)
+            allocator = std::move(moveMap.allocator);
+    }
+    else if(allocator == moveMap.allocator)
+    {
+        releaseStorage();
+    }
+    else
+    {
+        // Entries are moved into a storage of this allocator
+        FlatHashMap moved(std::move(moveMap), allocator_type(allocator));
+
+        releaseStorage();
+        maxLoad = moved.maxLoad;
+        hash    = moved.hash;
+        takeOver(moved);
+
+        return *this;
+    }
+
+    maxLoad = moveMap.maxLoad;
+    hash    = moveMap.hash;
+    takeOver(moveMap);
+
+    return *this;
+}
+
+/**
+ * @brief   Compares the entries regardless of their order
+ * @param   rightMap    Map to be compared
+ * @return  true    If both maps have the same keys mapped to equal values
+ */
+template<class K, class V, class Hash, class Allocator>
+bool FlatHashMap<K, V, Hash, Allocator>::operator==(const FlatHashMap& rightMap) const
+{
+    if(sz != rightMap.sz)
+        return false;
+
+    for(const value_type& entry : *this)
+    {
+        const const_iterator match = rightMap.find(entry.first);
+
+        if((match == rightMap.end()) || !(match->second == entry.second))
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief   Returns the value mapped to the key
+ * @param   key Key to be searched
+ * @return  lValue reference to the mapped value
+ * @throws  std::out_of_range   If the key is not found
+ */
+template<class K, class V, class Hash, class Allocator>
+typename FlatHashMap<K, V, Hash, Allocator>::mapped_type& FlatHashMap<K, V, Hash, Allocator>::at(const key_type& key)
+{
+    const size_type index = findIndex(key, hashOf(key));
+
+    if(NOT_FOUND == index)
+        throw std::out_of_range("Key not found!");
+
+    return slots[index].value.second;
+}
+
+/**
+ * @brief   Returns the value mapped to the key
+ * @param   key Key to be searched
+ * @return  Constant lValue reference to the mapped value
+ * @throws  std::out_of_range   If the key is not found
+ */
+template<class K, class V, class Hash, class Allocator>
+const typename FlatHashMap<K, V, Hash, Allocator>::mapped_type& FlatHashMap<K, V, Hash, Allocator>::at(const key_type& key) const
+{
+    const size_type index = findIndex(key, hashOf(key));
+
+    if(NOT_FOUND == index)
+        throw std::out_of_range("Key not found!");
+
+    return slots[index].value.second;
+}
+
+/**
+ * @brief   Searches the entry of the key
+ * @param   key Key to be searched
+ * @return  Iterator to the entry, end() if not found
+ */
+template<class K, class V, class Hash, class Allocator>
+typename FlatHashMap<K, V, Hash, Allocator>::iterator FlatHashMap<K, V, Hash, Allocator>::find(const key_type& key)
+{
+    const size_type index = findIndex(key, hashOf(key));
+
+    return (NOT_FOUND == index) ? end() : iteratorAt(index);
+}
+
+/**
+ * @brief   Searches the entry of the key
+ * @param   key Key to be searched
+ * @return  Constant iterator to the entry, end() if not found
+ */
+template<class K, class V, class Hash, class Allocator>
+typename FlatHashMap<K, V, Hash, Allocator>::const_iterator FlatHashMap<K, V, Hash, Allocator>::find(const key_type& key) const
+{
+    const size_type index = findIndex(key, hashOf(key));
+
+    return (NOT_FOUND == index) ? end() : iteratorAt(index);
+}
+
+/**
+ * @brief   Inserts the entries of a range, the entries with an existing key are ignored
+ * @param   first   Iterator to the first entry
+ * @param   last    Iterator to the entry after the last one
+ */
+template<class K, class V, class Hash, class Allocator>
+template<class InputIterator>
+void FlatHashMap<K, V, Hash, Allocator>::insert(InputIterator first, InputIterator last)
+{
+    if constexpr(std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIterator>::iterator_category>)
+        reserve(sz + size_type(std::distance(first, last)));    // Duplicates may leave some of the room unused
+
+    for(; first != last; ++first)
+        tryEmplace(first->first, first->second);
+}
+
+/**
+ * @brief   Constructs an entry from the arguments and inserts it if its key is not found
+ * @param   args    Arguments to construct a key and value pair
+ * @return  Iterator to the entry of the key and whether the insertion took place
+ * @note    Prefer try_emplace(..) when the key is at hand, it does not construct the value if the key exists.
+ */
+template<class K, class V, class Hash, class Allocator>
+template<class... Args>
+std::pair<typename FlatHashMap<K, V, Hash, Allocator>::iterator, bool> FlatHashMap<K, V, Hash, Allocator>::emplace(Args&&... args)
+{
+    std::pair<K, V> entry(std::forward<Args>(args)...);
+
+    return tryEmplace(std::move(entry.first), std::move(entry.second));
+}
+
+/**
+ * @brief   Inserts the value or assigns it to the existing entry of the key
+ * @param   key     Key of the entry
+ * @param   value   Value to be mapped to the key
+ * @return  Iterator to the entry of the key and whether an insertion took place
+ */
+template<class K, class V, class Hash, class Allocator>
+template<class M>
+std::pair<typename FlatHashMap<K, V, Hash, Allocator>::iterator, bool> FlatHashMap<K, V, Hash, Allocator>::insert_or_assign(const key_type& key, M&& value)
+{
+    const size_type index = findIndex(key, hashOf(key));
+
+    if(NOT_FOUND != index)
+    {
+        slots[index].value.second = std::forward<M>(value);
+
+        return {iteratorAt(index), false};
+    }
+
+    return tryEmplace(key, std::forward<M>(value));
+}
+
+/**
+ * @brief   Inserts the value or assigns it to the existing entry of the key
+ * @param   key     Key of the entry, moved only if an insertion takes place
+ * @param   value   Value to be mapped to the key
+ * @return  Iterator to the entry of the key and whether an insertion took place
+ */
+template<class K, class V, class Hash, class Allocator>
+template<class M>
+std::pair<typename FlatHashMap<K, V, Hash, Allocator>::iterator, bool> FlatHashMap<K, V, Hash, Allocator>::insert_or_assign(key_type&& key, M&& value)
+{
+    const size_type index = findIndex(key, hashOf(key));
+
+    if(NOT_FOUND != index)
+    {
+        slots[index].value.second = std::forward<M>(value);
+
+        return {iteratorAt(index), false};
+    }
+
+    return tryEmplace(std::move(key), std::forward<M>(value));
+}
+
+/**
+ * @brief   Erases the entry of the key
+ * @param   key Key of the entry to be erased
+ * @return  Number of erased entries, 0 or 1
+ */
+template<class K, class V, class Hash, class Allocator>
+typename FlatHashMap<K, V, Hash, Allocator>::size_type FlatHashMap<K, V, Hash, Allocator>::erase(const key_type& key)
+{
+    const size_type index = findIndex(key, hashOf(key));
+
+    if(NOT_FOUND == index)
+        return 0;
+
+    eraseAt(index);
+
+    return 1;
+}
+
+/**
+ * @brief   Erases the entry at the given position
+ * @param   position    Iterator to a valid entry
+ * @note    An entry following the position may be moved into it, use erase_if(..) to erase while traversing.
+ */
+template<class K, class V, class Hash, class Allocator>
+void FlatHashMap<K, V, Hash, Allocator>::erase(const_iterator position)
+{
+    eraseAt(size_type(position.slot - slots));
+}
+
+/**
+ * @brief   Erases all entries fulfilling the predicate
+ * @param   pred    Unary predicate taking a constant entry
+ * @return  Number of erased entries
+ * @note    Each entry is visited once. The traversal starts after an empty slot so that no shifted entry is visited twice.
+ */
+template<class K, class V, class Hash, class Allocator>
+template<class Predicate>
+typename FlatHashMap<K, V, Hash, Allocator>::size_type FlatHashMap<K, V, Hash, Allocator>::erase_if(Predicate pred)
+{
+    if(0 == sz)
+        return 0;
+
+    // Shifting stops at an empty slot, the entries are shifted only towards the slots not visited yet
+    size_type start = 0;
+
+    while(control[start] >= 0)
+        ++start;
+
+    const size_type mask        = cap - 1;
+    const size_type initialSize = sz;
+
+    for(size_type step = 1; step < cap; )
+    {
+        const size_type index = (start + step) & mask;
+
+        if((control[index] >= 0) && pred(std::as_const(slots[index].value)))
+            eraseAt(index);     // The slot is visited again as a following entry may have moved into it
+        else
+            ++step;
+    }
+
+    return initialSize - sz;
+}
+
+/**
+ * @brief   Destroys all entries, the capacity is kept
+ */
+template<class K, class V, class Hash, class Allocator>
+void FlatHashMap<K, V, Hash, Allocator>::clear() noexcept
+{
+    if(0 == cap)
+        return;
+
+    for(size_type index = 0; index < cap; ++index)
+    {
+        if(control[index] >= 0)
+            SlotTraits::destroy(allocator, &slots[index].value);
+    }
+
+    std::memset(control, std::uint8_t(FlatHashMapDetail::EMPTY), cap + Group::WIDTH);
+    sz = 0;
+}
+
+/**
+ * @brief   Exchanges the contents of two maps
+ * @param   swapMap Map to be swapped with
+ * @note    The allocators are swapped only if they propagate on swap.
+ */
+template<class K, class V, class Hash, class Allocator>
+void FlatHashMap<K, V, Hash, Allocator>::swap(FlatHashMap& swapMap) noexcept
+{
+    using std::swap;
+
+    swap(slots,         swapMap.slots);
+    swap(control,       swapMap.control);
+    swap(sz,            swapMap.sz);
+    swap(cap,           swapMap.cap);
+    swap(growthLimit,   swapMap.growthLimit);
+    swap(maxLoad,       swapMap.maxLoad);
+    swap(hash,          swapMap.hash);
+
+    if constexpr(SlotTraits::propagate_on_container_swap::value)
+        swap(allocator, swapMap.allocator);
+}
+
+/**
+ * @brief   Grows the table so that the given number of entries can be held without rehashing
+ * @param   expectedSize    Number of entries
+ * @throws  std::length_error   If the required number of slots cannot be represented
+ */
+template<class K, class V, class Hash, class Allocator>
+void FlatHashMap<K, V, Hash, Allocator>::reserve(const size_type expectedSize)
+{
+    if(expectedSize > growthLimit)
+        resizeTable(capacityFor(expectedSize));
+}
+
+/**
+ * @brief   Rebuilds the table with the given number of slots, rounded up to hold the entries within the load factor
+ * @param   slotCount   Minimum number of slots, 0 to shrink to the smallest table holding the entries
+ * @throws  std::length_error   If the required number of slots cannot be represented
+ */
+template<class K, class V, class Hash, class Allocator>
+void FlatHashMap<K, V, Hash, Allocator>::rehash(const size_type slotCount)
+{
+    if((0 == sz) && (0 == slotCount))
+    {
+        releaseStorage();
+        return;
+    }
+
+    size_type newCap = capacityFor(sz);
+
+    while(newCap < slotCount)
+    {
+        if(newCap > (max_size() >> 1))
+            throw std::length_error("Number of slots exceeds the maximum size!");
+
+        newCap <<= 1;
+    }
+
+    if(newCap != cap)
+        resizeTable(newCap);
+}
+
+/**
+ * @brief   Sets the maximum ratio of the entries to the slots, grows the table if it is exceeded
+ * @param   loadFactor  New load factor, greater than 0 and less than 1
+ * @throws  std::out_of_range   If the load factor is out of its range
+ */
+template<class K, class V, class Hash, class Allocator>
+void FlatHashMap<K, V, Hash, Allocator>::max_load_factor(const float loadFactor)
+{
+    if(!((loadFactor > 0.0f) && (loadFactor < 1.0f)))
+        throw std::out_of_range("Load factor must be between 0 and 1!");
+
+    maxLoad     = loadFactor;
+    growthLimit = growthLimitOf(cap);
+
+    if(sz > growthLimit)
+        resizeTable(capacityFor(sz));
+}
+
+/**
+ * @brief   Searches the slot of the key, group by group from its home slot
+ * @param   key         Key to be searched
+ * @param   hashValue   Mixed hash of the key
+ * @return  Index of the slot, NOT_FOUND if the key is not found
+ */
+template<class K, class V, class Hash, class Allocator>
+typename FlatHashMap<K, V, Hash, Allocator>::size_type FlatHashMap<K, V, Hash, Allocator>::findIndex(const key_type& key, const size_type hashValue) const
+{
+    if(0 == sz)
+        return NOT_FOUND;
+
+    const ControlByte   hashBits    = controlOf(hashValue);
+    const size_type     mask        = cap - 1;
+
+    for(size_type position = homeOf(hashValue); ; position = (position + Group::WIDTH) & mask)
+    {
+        const Group group(control + position);
+
+        for(auto match = group.match(hashBits); match; match.removeLowest())
+        {
+            const size_type index = (position + match.lowest()) & mask;
+
+            if(slots[index].value.first == key)
+                return index;
+        }
+
+        // Entries have no gap after their home slot, the key would have been placed before the empty slot
+        if(group.matchEmpty())
+            return NOT_FOUND;
+    }
+}
+
+/**
+ * @brief   Finds the first empty slot from the home slot of the hash
+ * @param   hashValue   Mixed hash of the key to be inserted
+ * @return  Index of the empty slot
+ * @note    A slot is always kept empty, the search terminates.
+ */
+template<class K, class V, class Hash, class Allocator>
+typename FlatHashMap<K, V, Hash, Allocator>::size_type FlatHashMap<K, V, Hash, Allocator>::findEmpty(const size_type hashValue) const noexcept
+{
+    const size_type mask = cap - 1;
+
+    for(size_type position = homeOf(hashValue); ; position = (position + Group::WIDTH) & mask)
+    {
+        const auto empty = Group(control + position).matchEmpty();
+
+        if(empty)
+            return (position + empty.lowest()) & mask;
+    }
+}
+
+/**
+ * @brief   Calculates the number of entries which a table of the given size can hold
+ * @param   slotCount   Number of slots
+ * @return  Number of entries, leaves at least one slot empty
+ */
+template<class K, class V, class Hash, class Allocator>
+typename FlatHashMap<K, V, Hash, Allocator>::size_type FlatHashMap<K, V, Hash, Allocator>::growthLimitOf(const size_type slotCount) const noexcept
+{
+    if(0 == slotCount)
+        return 0;
+
+    const size_type limit = size_type(double(slotCount) * double(maxLoad));
+
+    return (limit < slotCount) ? limit : (slotCount - 1);
+}
+
+/**
+ * @brief   Calculates the smallest number of slots holding the given number of entries
+ * @param   entryCount  Number of entries
+ * @return  Power of 2 not less than MIN_CAPACITY
+ * @throws  std::length_error   If the number of slots cannot be represented
+ */
+template<class K, class V, class Hash, class Allocator>
+typename FlatHashMap<K, V, Hash, Allocator>::size_type FlatHashMap<K, V, Hash, Allocator>::capacityFor(const size_type entryCount) const
+{
+    size_type slotCount = MIN_CAPACITY;
+
+    while(growthLimitOf(slotCount) < entryCount)
+    {
+        if(slotCount > (max_size() >> 1))
+            throw std::length_error("Number of slots exceeds the maximum size!");
+
+        slotCount <<= 1;
+    }
+
+    return slotCount;
+}
+
+/**
+ * @brief   Inserts an entry constructed from the arguments if the key is not found
+ * @param   key     Key of the entry, forwarded only if an insertion takes place
+ * @param   args    Arguments to construct the value
+ * @return  Iterator to the entry of the key and whether the insertion took place
+ */
+template<class K, class V, class Hash, class Allocator>
+template<class KeyArg, class... Args>
+std::pair<typename FlatHashMap<K, V, Hash, Allocator>::iterator, bool> FlatHashMap<K, V, Hash, Allocator>::tryEmplace(KeyArg&& key, Args&&... args)
+{
+    const size_type hashValue   = hashOf(key);
+    const size_type found       = findIndex(key, hashValue);
+
+    if(NOT_FOUND != found)
+        return {iteratorAt(found), false};
+
+    if(sz >= growthLimit)
+        resizeTable(capacityFor(sz + 1));
+
+    const size_type index = findEmpty(hashValue);
+
+    SlotTraits::construct(allocator, &slots[index].value, std::piecewise_construct,
+                          std::forward_as_tuple(std::forward<KeyArg>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+
+    setControl(index, controlOf(hashValue));
+    ++sz;
+
+    return {iteratorAt(index), true};
+}
+
+/**
+ * @brief   Writes a control byte and its mirror at the end of the control array
+ * @param   index   Index of the slot
+ * @param   value   Control byte
+ */
+template<class K, class V, class Hash, class Allocator>
+void FlatHashMap<K, V, Hash, Allocator>::setControl(const size_type index, const ControlByte value) noexcept
+{
+    control[index] = value;
+
+    if(index < Group::WIDTH)
+        control[cap + index] = value;
+}
+
+/**
+ * @brief   Destroys the entry of the slot, then shifts back the following entries which are not at their home slot
+ * @param   index   Index of a full slot
+ * @note    No tombstone is left, the following lookups and the load factor are not affected by the past deletions.
+ */
+template<class K, class V, class Hash, class Allocator>
+void FlatHashMap<K, V, Hash, Allocator>::eraseAt(size_type index) noexcept
+{
+    const size_type mask = cap - 1;
+
+    SlotTraits::destroy(allocator, &slots[index].value);
+    setControl(index, FlatHashMapDetail::EMPTY);
+    --sz;
+
+    for(size_type next = (index + 1) & mask; control[next] >= 0; next = (next + 1) & mask)
+    {
+        // The entry can fill the hole only if the hole is not before its home slot
+        const size_type home = homeOf(hashOf(slots[next].value.first));
+
+        if(((next - home) & mask) >= ((next - index) & mask))
+        {
+            SlotTraits::construct(allocator, &slots[index].value, std::move(slots[next].movable));
+            SlotTraits::destroy(allocator, &slots[next].value);
+            setControl(index, control[next]);
+            setControl(next, FlatHashMapDetail::EMPTY);
+            CONTAINER_STATS_RECORD(FlatHashMap, bytesMoved, sizeof(value_type));
+
+            index = next;
+        }
+    }
+}
+
+/**
+ * @brief   Moves all entries into a new table of the given size
+ * @param   newCap  Number of slots, a power of 2 which can hold the entries
+ * @throws  std::bad_alloc  If the new table cannot be allocated, the map stays unchanged
+ */
+template<class K, class V, class Hash, class Allocator>
+void FlatHashMap<K, V, Hash, Allocator>::resizeTable(const size_type newCap)
+{
+    Slot*           newSlots    = nullptr;
+    ControlByte*    newControl  = nullptr;
+
+    allocateTable(newCap, newSlots, newControl);
+
+    Slot* const         oldSlots    = slots;
+    ControlByte* const  oldControl  = control;
+    const size_type     oldCap      = cap;
+
+    slots       = newSlots;
+    control     = newControl;
+    cap         = newCap;
+    growthLimit = growthLimitOf(newCap);
+
+    for(size_type oldIndex = 0; oldIndex < oldCap; ++oldIndex)
+    {
+        if(oldControl[oldIndex] < 0)
+            continue;
+
+        const size_type hashValue   = hashOf(oldSlots[oldIndex].value.first);
+        const size_type index       = findEmpty(hashValue);
+
+        SlotTraits::construct(allocator, &slots[index].value, std::move(oldSlots[oldIndex].movable));
+        SlotTraits::destroy(allocator, &oldSlots[oldIndex].value);
+        setControl(index, controlOf(hashValue));
+    }
+
+    deallocateTable(oldSlots, oldControl, oldCap);
+
+    CONTAINER_STATS_RECORD(FlatHashMap, reallocations, 1);
+    CONTAINER_STATS_RECORD(FlatHashMap, bytesMoved, sz * sizeof(value_type));
+}
+
+/**
+ * @brief   Allocates the slots and the control bytes of a table, all slots are marked empty
+ * @param   newCap      Number of slots
+ * @param   newSlots    Set to the uninitialized slots
+ * @param   newControl  Set to the control bytes
+ * @throws  std::bad_alloc  If any of the arrays cannot be allocated, nothing is leaked
+ */
+template<class K, class V, class Hash, class Allocator>
+void FlatHashMap<K, V, Hash, Allocator>::allocateTable(const size_type newCap, Slot*& newSlots, ControlByte*& newControl)
+{
+    ControlAllocator controlAllocator(allocator);
+
+    newSlots = SlotTraits::allocate(allocator, newCap);
+
+    try {
+        newControl = ControlTraits::allocate(controlAllocator, newCap + Group::WIDTH);
+    }
+    catch(...) {
+        SlotTraits::deallocate(allocator, newSlots, newCap);
+        throw;  // Propagate exception
+    }
+
+    std::memset(newControl, std::uint8_t(FlatHashMapDetail::EMPTY), newCap + Group::WIDTH);
+}
+
+/**
+ * @brief   Deallocates the arrays of a table, the entries must have been destroyed
+ * @param   oldSlots    Slots of the table
+ * @param   oldControl  Control bytes of the table
+ * @param   oldCap      Number of slots, nothing is deallocated if 0
+ */
+template<class K, class V, class Hash, class Allocator>
+void FlatHashMap<K, V, Hash, Allocator>::deallocateTable(Slot* oldSlots, ControlByte* oldControl, const size_type oldCap) noexcept
+{
+    if(0 == oldCap)
+        return;
+
+    ControlAllocator controlAllocator(allocator);
+
+    SlotTraits::deallocate(allocator, oldSlots, oldCap);
+    ControlTraits::deallocate(controlAllocator, oldControl, oldCap + Group::WIDTH);
+}
+
+/**
+ * @brief   Copies or moves the entries of the source into the same slots of a table of the same size
+ * @param   source  Map of the same hasher, left with moved-from entries if MOVE is set
+ * @throws  Any exception thrown by the constructors of the entries, the constructed entries are destroyed
+ * @note    Must be called on an empty map without storage.
+ */
+template<class K, class V, class Hash, class Allocator>
+template<bool MOVE, class SourceMap>
+void FlatHashMap<K, V, Hash, Allocator>::cloneFrom(SourceMap& source)
+{
+    if(0 == source.sz)
+        return;
+
+    allocateTable(source.cap, slots, control);
+    cap         = source.cap;
+    growthLimit = source.growthLimit;
+
+    size_type index = 0;
+
+    try {
+        for(; index < cap; ++index)
+        {
+            if(source.control[index] < 0)
+                continue;
+
+            if constexpr(MOVE)
+                SlotTraits::construct(allocator, &slots[index].value, std::move(source.slots[index].movable));
+            else
+                SlotTraits::construct(allocator, &slots[index].value, std::as_const(source.slots[index].value));
+        }
+    }
+    catch(...) {
+        while(0 != index--)
+        {
+            if(source.control[index] >= 0)
+                SlotTraits::destroy(allocator, &slots[index].value);
+        }
+
+        deallocateTable(slots, control, cap);
+        slots       = nullptr;
+        control     = nullptr;
+        cap         = 0;
+        growthLimit = 0;
+
+        throw;  // Propagate exception
+    }
+
+    std::memcpy(control, source.control, cap + Group::WIDTH);
+    sz = source.sz;
+
+    if constexpr(MOVE)
+        CONTAINER_STATS_RECORD(FlatHashMap, bytesMoved, sz * sizeof(value_type));
+    else
+        CONTAINER_STATS_RECORD(FlatHashMap, bytesCopied, sz * sizeof(value_type));
+}
+
+/**
+ * @brief   Takes over the storage of the source, leaving it empty
+ * @param   source  Map whose allocator is equal to the allocator of this map
+ * @note    Must be called on a map without storage.
+ */
+template<class K, class V, class Hash, class Allocator>
+void FlatHashMap<K, V, Hash, Allocator>::takeOver(FlatHashMap& source) noexcept
+{
+    slots       = source.slots;
+    control     = source.control;
+    sz          = source.sz;
+    cap         = source.cap;
+    growthLimit = source.growthLimit;
+
+    source.slots        = nullptr;
+    source.control      = nullptr;
+    source.sz           = 0;
+    source.cap          = 0;
+    source.growthLimit  = 0;
+}
+
+/**
+ * @brief   Destroys all entries and deallocates the table
+ */
+template<class K, class V, class Hash, class Allocator>
+void FlatHashMap<K, V, Hash, Allocator>::releaseStorage() noexcept
+{
+    clear();
+    deallocateTable(slots, control, cap);
+
+    slots       = nullptr;
+    control     = nullptr;
+    cap         = 0;
+    growthLimit = 0;
+}
+
+/**
+ * @brief   Swaps the contents of two maps
+ * @param   left    First map
+ * @param   right   Second map
+ */
+template<class K, class V, class Hash, class Allocator>
+void swap(FlatHashMap<K, V, Hash, Allocator>& left, FlatHashMap<K, V, Hash, Allocator>& right) noexcept
+{
+    left.swap(right);
+}
@@ -0,0 +1,219 @@
+/**
+ * @file        HazardPointers.h
+ * @details     A hazard pointer domain for safe memory reclamation in lock-free containers.
+ *              Threads publish the nodes they are about to access, retired nodes are
+ *              reclaimed only after no thread has published them anymore.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <algorithm>    // std::sort, std::binary_search
+#include <atomic>       // std::atomic
+#include <cstddef>      // std::size_t
+#include <functional>   // std::hash
+#include <thread>       // std::this_thread
+#include <utility>      // std::move
+#include <vector>       // std::vector
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Reclamation Domain ***/
+/* Each domain owns MAX_THREADS hazard slots. A Guard acquires a free slot for the duration of
+ * an operation, so that at most MAX_THREADS operations may be in progress at the same time.
+ * Retired nodes are kept by the slot that retired them and passed to the Reclaimer once
+ * they are not published by any slot. */
+template<class Node, class Reclaimer, std::size_t MAX_THREADS = 128>
+class HazardDomain {
+    static_assert(MAX_THREADS != 0, "Domain must have at least one hazard slot!");
+
+    struct Slot;
+
+public:
+    /*** RAII Slot Owner ***/
+    class Guard {
+    public:
+        explicit Guard(HazardDomain& domain);
+        ~Guard();
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+
+        NODISCARD Node* protect(const std::atomic<Node*>& source);  // Publishes and returns the node pointed by the source
+        void clear() noexcept { slot->hazard.store(nullptr, std::memory_order_release); }
+        void retire(Node* node);                                    // Node must have been unlinked from the container
+
+    private:
+        HazardDomain&   domain;
+        Slot*           slot;
+    };
+
+    /*** Constructors and Destructor ***/
+    explicit HazardDomain(Reclaimer reclaimer = Reclaimer()) : reclaimer(std::move(reclaimer)) { }
+    ~HazardDomain();
+
+    HazardDomain(const HazardDomain&) = delete;
+    HazardDomain& operator=(const HazardDomain&) = delete;
+
+private:
+    static constexpr std::size_t CACHE_LINE_SIZE    = 64;
+    static constexpr std::size_t RETIRE_THRESHOLD   = 8;    // Number of retired nodes that triggers a scan
+
+    struct alignas(CACHE_LINE_SIZE) Slot {
+        std::atomic<bool>   owned{false};
+        std::atomic<Node*>  hazard{nullptr};
+        std::vector<Node*>  retired;            // Only accessed by the owner of the slot
+    };
+
+    NODISCARD Slot* acquireSlot();
+    void scan(Slot& slot);
+
+    /*** Members ***/
+    Slot        slots[MAX_THREADS];
+    Reclaimer   reclaimer;
+};
+
+/**
+ * @brief   Reclaims all retired nodes
+ * @note    Must not be called while a guard is still alive.
+ */
+template<class Node, class Reclaimer, std::size_t MAX_THREADS>
+HazardDomain<Node, Reclaimer, MAX_THREADS>::~HazardDomain()
+{
+    for(Slot& slot : slots)
+        for(Node* node : slot.retired)
+            reclaimer(node);
+}
+
+/**
+ * @brief   Acquires a free hazard slot for the calling thread
+ * @return  Address of the acquired slot
+ * @note    Waits for a slot to be released if all of them are in use.
+ */
+template<class Node, class Reclaimer, std::size_t MAX_THREADS>
+typename HazardDomain<Node, Reclaimer, MAX_THREADS>::Slot* HazardDomain<Node, Reclaimer, MAX_THREADS>::acquireSlot()
+{
+    // Threads start searching from their own position, so that they mostly get the same uncontended slot
+    static thread_local std::size_t hint = std::hash<std::thread::id>()(std::this_thread::get_id()) % MAX_THREADS;
+
+    for(;;)
+    {
+        for(std::size_t offset = 0; offset < MAX_THREADS; ++offset)
+        {
+            const std::size_t index = (hint + offset) % MAX_THREADS;
+
+            if(!slots[index].owned.load(std::memory_order_relaxed) && !slots[index].owned.exchange(true, std::memory_order_acquire))
+            {
+                hint = index;
+
+                return &slots[index];
+            }
+        }
+
+        std::this_thread::yield();
+    }
+}
+
+/**
+ * @brief   Reclaims the retired nodes of the slot which are not published by any slot
+ * @param   slot    Slot owned by the calling thread
+ */
+template<class Node, class Reclaimer, std::size_t MAX_THREADS>
+void HazardDomain<Node, Reclaimer, MAX_THREADS>::scan(Slot& slot)
+{
+    // Take a snapshot of the published nodes
+    std::vector<Node*> published;
+    published.reserve(MAX_THREADS);
+
+    for(const Slot& otherSlot : slots)
+    {
+        Node* node = otherSlot.hazard.load(std::memory_order_seq_cst);
+
+        if(nullptr != node)
+            published.push_back(node);
+    }
+
+    std::sort(published.begin(), published.end());
+
+    // Keep the published ones for the next scan
+    std::size_t keptCount = 0;
+
+    for(Node* node : slot.retired)
+    {
+        if(std::binary_search(published.begin(), published.end(), node))
+            slot.retired[keptCount++] = node;
+        else
+            reclaimer(node);
+    }
+
+    slot.retired.resize(keptCount);
+}
+
+/**
+ * @brief   Acquires a hazard slot of the domain
+ * @param   domain  Domain of the nodes to be accessed
+ */
+template<class Node, class Reclaimer, std::size_t MAX_THREADS>
+HazardDomain<Node, Reclaimer, MAX_THREADS>::Guard::Guard(HazardDomain& domain)
+: domain(domain), slot(domain.acquireSlot())
+{ /* Empty constructor */ }
+
+/**
+ * @brief   Clears the published node and releases the hazard slot
+ * @note    Retired nodes stay in the slot, they will be reclaimed by a later owner or the domain.
+ */
+template<class Node, class Reclaimer, std::size_t MAX_THREADS>
+HazardDomain<Node, Reclaimer, MAX_THREADS>::Guard::~Guard()
+{
+    slot->hazard.store(nullptr, std::memory_order_release);
+    slot->owned.store(false, std::memory_order_release);
+}
+
+/**
+ * @brief   Publishes the node pointed by the source
+ * @param   source  Shared pointer to the node
+ * @return  Address of the node, it will not be reclaimed until another node is published or the guard is cleared
+ * @note    The source is reloaded until it is seen unchanged after the publication.
+ */
+template<class Node, class Reclaimer, std::size_t MAX_THREADS>
+Node* HazardDomain<Node, Reclaimer, MAX_THREADS>::Guard::protect(const std::atomic<Node*>& source)
+{
+    Node* node = source.load(std::memory_order_acquire);
+
+    for(;;)
+    {
+        slot->hazard.store(node, std::memory_order_seq_cst);
+
+        Node* reloaded = source.load(std::memory_order_seq_cst);
+
+        if(reloaded == node)
+            return node;
+
+        node = reloaded;
+    }
+}
+
+/**
+ * @brief   Hands an unlinked node to the domain for reclamation
+ * @param   node    Node which cannot be reached from the container anymore
+ */
+template<class Node, class Reclaimer, std::size_t MAX_THREADS>
+void HazardDomain<Node, Reclaimer, MAX_THREADS>::Guard::retire(Node* node)
+{
+    slot->retired.push_back(node);
+
+    if(slot->retired.size() >= RETIRE_THRESHOLD)
+        domain.scan(*slot);
+}
@@ -29,6 +29,14 @@
  *              March 25, 2021    -> [[nodiscard]] attribute added to related functions.
  *                                -> Standard named requirements added to class.
  *                                -> Copy assignment operator added for copying from std::initializer_list
+ *              October 14, 2026  -> Allocator policy added, nodes are allocated with the allocator rebound to ListNode.
+ *                                -> Nodes from lists with unequal allocators are reconstructed before being relinked.
+ *                                -> Selection sort replaced with a stable bottom-up merge sort, comparator overloads added.
+ *                                -> Merge relinks the nodes in a single pass.
+ *                                -> Sortedness cached by sorting operations, the remaining checks are iterative.
+ *                                -> Splice overloads added for single nodes and ranges, nodes are relinked without reallocation.
+ *                                -> Opt-in node allocation and copy/move statistics added, see ContainerStats.h.
+ *                                -> Sortedness is no longer written by the const checks, modifiable iterators clear it on dereference.
  *
  *  @note       Feel free to contact for questions, bugs or any other thing.
  *  @copyright  No copyright.
@@ -42,6 +50,12 @@
 #include <ostream>              // For stream operators
 #include <cstddef>              // For std::size_t
 #include <initializer_list>     // For std::initializer_list
+#include <memory>               // For std::allocator, std::allocator_traits
+#include <utility>              // For std::forward, std::move, std::swap
+#include <stdexcept>            // For exceptions
+#include <functional>           // For std::less
+#include <type_traits>          // For std::is_same
+#include "ContainerStats.h"     // For CONTAINER_STATS_RECORD, ContainerStats::Snapshot
 
 /*** Special definitions ***/
 #if __cplusplus >= 201703l          // If the C++ version is greater or equal to 2017xx
@@ -51,7 +65,7 @@
 #endif
 
 /*** Container Class ***/
-template<class T>
+template<class T, class Allocator = std::allocator<T>>
 class List{
 private:
     /*** Forward declarations ***/
@@ -66,6 +80,7 @@ public:
     using pointer         = T*         ;
     using const_pointer   = const T*   ;
     using difference_type = ptrdiff_t  ;
+    using allocator_type  = Allocator  ;
 
     /*** Forward declarations ***/
     class iterator;
@@ -73,6 +88,7 @@ public:
 
     /*** Constructors and Destructors ***/
     List();                             // Default constructor
+    explicit List(const allocator_type& alloc);   // Construct with an allocator object
     List(const size_type n);          // Construct with n nodes initally
 
     template<class... Args>
@@ -123,14 +139,26 @@ public:
     void Resize(const size_type newSize, const_reference data = 0); // Resizes the list so that it contains newSize of elements
     void MakeUnique();                                              // Remove duplicate values
     void Sort();                                                    // Sorts in ascending order
+    template<class Compare>
+    void Sort(Compare comp);                                        // Sorts in the order given by the comparator
     void Merge(List& anotherList);                                  // Merges two sorted list
+    template<class Compare>
+    void Merge(List& anotherList, Compare comp);                    // Merges two lists sorted by the comparator
     void Concatenate(List& anotherList);                            // Concatenates two lists
     void Splice(const iterator& destination, List& anotherList);    // Transferring all elements from another list
+    void Splice(const iterator& destination, List& anotherList, const iterator& element);   // Transferring a single element
+    void Splice(const iterator& destination, List& anotherList, const iterator& first, const iterator& last);  // Transferring a range
 
     /*** Status Checkers ***/
     NODISCARD bool isEmpty() const        { return (numberOfNodes == 0);                  }
     NODISCARD size_type GetNodeCount() const { return numberOfNodes;                         }
-    NODISCARD bool isSorted() const       { return (!isEmpty() && firstPtr->isSorted());  }   // Recursively checks the status of each node
+    NODISCARD bool isSorted() const       { return (!isEmpty() && (knownSorted || CheckSorted())); }  // Known after sorting, iteratively checked otherwise
+
+    /*** Allocator ***/
+    NODISCARD allocator_type get_allocator() const { return allocator_type(nodeAllocator); }
+
+    /*** Statistics ***/
+    NODISCARD static ContainerStats::Snapshot stats() noexcept { return ContainerStats::snapshotOf<List>(); }    // Zeros unless enabled
 
     /*** Operator Overloadings ***/
     NODISCARD bool operator==(const List& anotherList) const    // Compare two lists by equality
@@ -156,7 +184,7 @@ public:
 
         NODISCARD bool operator==(const iterator& anotherIt) { return (node == anotherIt.node);   }   // Equality operator
         NODISCARD bool operator!=(const iterator& anotherIt) { return !operator==(anotherIt);     }   // Inequality operator
-        NODISCARD reference operator*()          { return node->data;                        }               // Dereference operator
+        NODISCARD reference operator*()          { const_cast<List&>(list).knownSorted = false; return node->data; }   // Dereference operator, the element may be modified
         void operator++()       { if(node != nullptr) node = node->nextPtr; }               // Prefix increment
         void operator++(int)    { if(node != nullptr) node = node->nextPtr; }               // Postfix increment
 
@@ -198,9 +226,9 @@ public:
 
     NODISCARD const_iterator  cbegin()    const   { return const_iterator(*this, firstPtr);  }    // Constant iterator starting from the first node
     NODISCARD const_iterator  cend()      const   { return const_iterator(*this, nullptr);   }    // Constant iterator starting from past the end
-    NODISCARD iterator        begin()             { return iterator(*this, firstPtr);        }    // Iterator starting from the first node
+    NODISCARD iterator        begin()             { return iterator(*this, firstPtr);        }    // Iterator starting from the first node, the elements may be modified
     NODISCARD const_iterator  begin()     const   { return const_iterator(*this, firstPtr);  }    // Iterator starting from the first node
-    NODISCARD iterator        end()               { return iterator(*this, nullptr);         }    // Iterator starting from past the end
+    NODISCARD iterator        end()               { return iterator(*this, nullptr);         }    // Iterator starting from past the end, the elements may be modified
     NODISCARD const_iterator  end()       const   { return const_iterator(*this, nullptr);   }    // Constant iterator starting from past the end
 
 private:
@@ -209,23 +237,36 @@ private:
     NODISCARD ListNode* FindNotOf(const_reference data, ListNode* beginByNode);
     NODISCARD ListNode* FindReversed(const_reference data, ListNode* beginByNode);
     NODISCARD ListNode* FindNotOfReversed(const_reference data, ListNode* beginByNode);
-    NODISCARD ListNode* FindMinimum(ListNode* beginByNode);
 
     /*** Operations **/
     void DetachNode(ListNode* removingNode);                                    // Detaching a node from a list by not destroying the content
     void RemoveNode(ListNode* removingNode);                                    // Remove a specific node
     List& RemoveIf(const_reference data, ListNode* beginByNode);                       // Remove all samples of a specific data
-    void SwapNodes(ListNode* firstNode, ListNode* secondNode);                  // Swap different nodes
-    void SwapSuccessiveNodes(ListNode* firstNode, ListNode* secondNode);        // Swap directly linked nodes
-    void SwapNonSuccessiveNodes(ListNode* firstNode, ListNode* secondNode);     // Swap indirectly linked nodes
+    void RelinkPrevious() noexcept;                                             // Rebuilds the previous links by following the next links
+    NODISCARD static ListNode* SplitRun(ListNode* first, size_type length) noexcept;   // Cuts a run of nodes off the chain
+
+    template<class Compare>
+    static void MergeRuns(ListNode* left, ListNode* right, Compare& comp, ListNode*& mergedFirst, ListNode*& mergedLast);
     void Append(ListNode* baseNode, ListNode* newNode);                         // Appending a node to a certain node
     void Prepend(ListNode* baseNode, ListNode* newNode);                        // Prepending a node to a certain node
-    void Append(ListNode* baseNode, List& anotherList);                         // Appending a list to a certain node7
+    void TransferChain(ListNode* baseNode, List& anotherList, ListNode* chainFirst, ListNode* chainLast, size_type chainLength);  // Relinking nodes of another list
+    void AcquireNodes(List& anotherList);                                       // Makes the nodes of another list relinkable into this list
+    NODISCARD bool CheckSorted() const;                                         // Iteratively checks the order of nodes
+
+    /*** Node Management ***/
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<ListNode>;
+    using NodeTraits    = std::allocator_traits<NodeAllocator>;
+
+    template<class... Args>
+    NODISCARD ListNode* CreateNode(Args&&... args);     // Allocate and construct a detached node
+    void DestroyNode(ListNode* node);                   // Destruct and deallocate a detached node
 
     /*** Members ***/
     ListNode* firstPtr   = nullptr;  // First node of the list
     ListNode* lastPtr    = nullptr;  // Last node of the list
     size_type numberOfNodes    = 0;        // Node count
+    NodeAllocator nodeAllocator;     // Allocator rebound to the node type
+    bool knownSorted           = true;     // Known to be in ascending order, cleared by modifiers which may break the order
 
     class ListNode{
         friend class List;
@@ -235,21 +276,9 @@ private:
         { /* Empty constructor */ }
 
         template<class... Args>
-        ListNode(Args&&... args): data(args...), prevPtr(nullptr), nextPtr(nullptr)
+        ListNode(Args&&... args): data(std::forward<Args>(args)...), prevPtr(nullptr), nextPtr(nullptr)
         { /* Empty constructor */ }
 
-        // Recursively checks the status of each node
-        NODISCARD bool isSorted() const
-        {
-            if(nextPtr == nullptr)
-                return true;
-
-            if(nextPtr->data < data)
-                return false;
-
-            return nextPtr->isSorted();
-        }
-
     private:
         value_type data;
         ListNode* prevPtr = nullptr;
@@ -260,17 +289,27 @@ private:
 /**
  * @brief Default constructor
  */
-template<class T>
-List<T>::List()
+template<class T, class Allocator>
+List<T, Allocator>::List()
 : firstPtr(nullptr), lastPtr(nullptr), numberOfNodes(0)
 { /* Empty constructor */ }
 
+/**
+ * @brief   Default constructor with allocator object
+ * @param   alloc   Allocator object
+ * @note    Container will use a copy of this allocator object, rebound to the node type.
+ */
+template<class T, class Allocator>
+List<T, Allocator>::List(const allocator_type& alloc)
+: firstPtr(nullptr), lastPtr(nullptr), numberOfNodes(0), nodeAllocator(alloc)
+{ /* Empty constructor */ }
+
 /**
  * @brief   Constructs a container with n elements initially.
  * @param   n   Size of initial construction nodes.
  */
-template<class T>
-List<T>::List (const size_type n)
+template<class T, class Allocator>
+List<T, Allocator>::List (const size_type n)
 : firstPtr(nullptr), lastPtr(nullptr), numberOfNodes(0)
 {
     // Append n nodes to empty list by in place construction
@@ -283,9 +322,9 @@ List<T>::List (const size_type n)
  * @param   n       Size of initial construction nodes.
  * @param   args    Construction arguments for initial nodes.
  */
-template<class T>
+template<class T, class Allocator>
 template<class... Args>
-List<T>::List(const size_type n, Args&&... args)
+List<T, Allocator>::List(const size_type n, Args&&... args)
 : firstPtr(nullptr), lastPtr(nullptr), numberOfNodes(0)
 {
     // Append n nodes to empty list by in place construction
@@ -302,9 +341,9 @@ List<T>::List(const size_type n, Args&&... args)
  * @note    Template used for iterator type because the user may want to copy the items of a different type of container.
  *          Here is where the idea comes from : stackoverflow.com/questions/30121228
  */
-template<class T>
+template<class T, class Allocator>
 template<class AnotherIteratorType>
-List<T>::List(AnotherIteratorType begin, AnotherIteratorType end)
+List<T, Allocator>::List(AnotherIteratorType begin, AnotherIteratorType end)
 : firstPtr(nullptr), lastPtr(nullptr), numberOfNodes(0)
 {
     AnotherIteratorType tempIt = begin;
@@ -326,14 +365,15 @@ List<T>::List(AnotherIteratorType begin, AnotherIteratorType end)
  * @param   anotherList List to be copied from.
  * @note    If you want to copy another type of list, you shall use the range constructor.
  */
-template<class T>
-List<T>::List(const List<T>& anotherList)
-: firstPtr(nullptr), lastPtr(nullptr), numberOfNodes(0)
+template<class T, class Allocator>
+List<T, Allocator>::List(const List<T, Allocator>& anotherList)
+: firstPtr(nullptr), lastPtr(nullptr), numberOfNodes(0),
+  nodeAllocator(NodeTraits::select_on_container_copy_construction(anotherList.nodeAllocator))
 {
     if(anotherList.isEmpty() == true)
         return;
 
-    List<T>::const_iterator it = anotherList.cbegin();
+    List<T, Allocator>::const_iterator it = anotherList.cbegin();
 
     // Copy all elements one by one
     while(numberOfNodes != anotherList.GetNodeCount())
@@ -341,6 +381,8 @@ List<T>::List(const List<T>& anotherList)
         Append(*it);
         it++;
     }
+
+    knownSorted = anotherList.knownSorted;  // Order is preserved
 }
 
 /**
@@ -348,25 +390,29 @@ List<T>::List(const List<T>& anotherList)
  * @param   anotherList Locally created constant source list.
  * @note    It is recommendded to use the std::mode for the input list.
  */
-template<class T>
-List<T>::List(List<T>&& anotherList)
-: firstPtr(anotherList.firstPtr), lastPtr(anotherList.lastPtr), numberOfNodes(anotherList.GetNodeCount())
+template<class T, class Allocator>
+List<T, Allocator>::List(List<T, Allocator>&& anotherList)
+: firstPtr(anotherList.firstPtr), lastPtr(anotherList.lastPtr), numberOfNodes(anotherList.GetNodeCount()),
+  nodeAllocator(anotherList.nodeAllocator)  // Copied, the source list may still allocate new nodes
 {
     /* No need to make an element wised copy as the source is
        a locally created list container. Assigning nullptr
        to the source container prevents destroying its content as
        we used its resources to construct the new one. */
+    knownSorted = anotherList.knownSorted;
+
     anotherList.firstPtr        = nullptr;
     anotherList.lastPtr         = nullptr;
     anotherList.numberOfNodes   = 0;
+    anotherList.knownSorted     = true;     // Empty list
 }
 
 /**
  * @brief   Construction with initializer list
  * @param   initializerList   Initializer list
  */
-template<class T>
-List<T>::List(std::initializer_list<T> initializerList)
+template<class T, class Allocator>
+List<T, Allocator>::List(std::initializer_list<T> initializerList)
 : firstPtr(nullptr), lastPtr(nullptr), numberOfNodes(0)
 {
     // Append each element by using a range-for
@@ -377,8 +423,8 @@ List<T>::List(std::initializer_list<T> initializerList)
 /**
  * @brief Destroys all nodes one by one
  */
-template<class T>
-List<T>::~List()
+template<class T, class Allocator>
+List<T, Allocator>::~List()
 {
     /* Destroy all nodes until there is no node left. */
     EraseAll();
@@ -390,17 +436,19 @@ List<T>::~List()
  * @param   data      Data to be appended
  * @return  lValue reference to the current list to support cascades
  */
-template<class T>
-List<T>& List<T>::Append(const_reference data)
+template<class T, class Allocator>
+List<T, Allocator>& List<T, Allocator>::Append(const_reference data)
 {
+    knownSorted = isEmpty();    // A single element is always sorted
+
     if(isEmpty() == true)  // If it is the first node
     {
-        firstPtr    = new ListNode(data);    // Create the first node
+        firstPtr    = CreateNode(data);    // Create the first node
         lastPtr     = firstPtr; // The last and the first points the same node
     }
     else
     {
-        lastPtr->nextPtr = new ListNode(data);   // Create and append the node
+        lastPtr->nextPtr = CreateNode(data);   // Create and append the node
         lastPtr->nextPtr->prevPtr = lastPtr;        // Adjust prevNode connection
         lastPtr = lastPtr->nextPtr;                 // Update the lastPtr
     }
@@ -416,17 +464,19 @@ List<T>& List<T>::Append(const_reference data)
  * @param   data      Data to be prepended
  * @return  lValue reference to the current list to support cascades
  */
-template<class T>
-List<T>& List<T>::Prepend(const_reference data)
+template<class T, class Allocator>
+List<T, Allocator>& List<T, Allocator>::Prepend(const_reference data)
 {
+    knownSorted = isEmpty();    // A single element is always sorted
+
     if(isEmpty() == true)   // If it is the first node
     {
-        firstPtr    = new ListNode(data);    // Create the first node
+        firstPtr    = CreateNode(data);    // Create the first node
         lastPtr     = firstPtr; // The last and the first points the same node
     }
     else
     {
-        firstPtr->prevPtr = new ListNode(data);  // Create and prepend the node
+        firstPtr->prevPtr = CreateNode(data);  // Create and prepend the node
         firstPtr->prevPtr->nextPtr = firstPtr;      // Adjust nextNode connection
         firstPtr = firstPtr->prevPtr;               // Update the firstPtr
     }
@@ -441,18 +491,20 @@ List<T>& List<T>::Prepend(const_reference data)
  * @param   args    Arguments forwarded to construct the new element.
  * @return  lValue reference to the current list to support cascades
  */
-template<class T>
+template<class T, class Allocator>
 template<class... Args>
-List<T>& List<T>::EmplaceAppend(Args&&... args)
+List<T, Allocator>& List<T, Allocator>::EmplaceAppend(Args&&... args)
 {
+    knownSorted = isEmpty();    // A single element is always sorted
+
     if(isEmpty() == true)  // If it is the first node
     {
-        firstPtr    = new ListNode(args...);    // Create the first node
+        firstPtr    = CreateNode(std::forward<Args>(args)...);    // Create the first node
         lastPtr     = firstPtr; // The last and the first points the same node
     }
     else
     {
-        lastPtr->nextPtr = new ListNode(args...);    // Create and append the node
+        lastPtr->nextPtr = CreateNode(std::forward<Args>(args)...);    // Create and append the node
         lastPtr->nextPtr->prevPtr = lastPtr;            // Adjust prevNode connection
         lastPtr = lastPtr->nextPtr;                     // Update the lastPtr
     }
@@ -466,18 +518,20 @@ List<T>& List<T>::EmplaceAppend(Args&&... args)
  * @param   args    Arguments forwarded to construct the new element.
  * @return  lValue reference to the current list to support cascades
  */
-template<class T>
+template<class T, class Allocator>
 template<class... Args>
-List<T>& List<T>::EmplacePrepend(Args&&... args)
+List<T, Allocator>& List<T, Allocator>::EmplacePrepend(Args&&... args)
 {
+    knownSorted = isEmpty();    // A single element is always sorted
+
     if(isEmpty() == true)   // If it is the first node
     {
-        firstPtr    = new ListNode(args...);    // Create the first node
+        firstPtr    = CreateNode(std::forward<Args>(args)...);    // Create the first node
         lastPtr     = firstPtr; // The last and the first points the same node
     }
     else
     {
-        firstPtr->prevPtr = new ListNode(args...);   // Create and prepend the node
+        firstPtr->prevPtr = CreateNode(std::forward<Args>(args)...);   // Create and prepend the node
         firstPtr->prevPtr->nextPtr = firstPtr;          // Adjust nextNode connection
         firstPtr = firstPtr->prevPtr;                   // Update the firstPtr
     }
@@ -492,8 +546,8 @@ List<T>& List<T>::EmplacePrepend(Args&&... args)
  * @return  Constant lValue reference to the data of first node.
  * @throws  std::logic_error If the list is empty
  */
-template<class T>
-const T& List<T>::First() const
+template<class T, class Allocator>
+const T& List<T, Allocator>::First() const
 {
     if(isEmpty() == true)
         throw std::logic_error("List is empty!");
@@ -506,8 +560,8 @@ const T& List<T>::First() const
  * @return  Constant lValue reference to the data of last node.
  * @throws  std::logic_error If the list is empty
  */
-template<class T>
-const T& List<T>::Last() const
+template<class T, class Allocator>
+const T& List<T, Allocator>::Last() const
 {
     if(isEmpty() == true)
         throw std::logic_error("List is empty!");
@@ -520,12 +574,14 @@ const T& List<T>::Last() const
  * @return  lValue reference to the data of first node.
  * @throws  std::logic_error If the list is empty
  */
-template<class T>
-T& List<T>::First()
+template<class T, class Allocator>
+T& List<T, Allocator>::First()
 {
     if(isEmpty() == true)
         throw std::logic_error("List is empty!");
 
+    knownSorted = false;    // Element may be modified through the reference
+
     return firstPtr->data;
 }
 
@@ -534,12 +590,14 @@ T& List<T>::First()
  * @return  lValue reference to the data of last node.
  * @throws  std::logic_error If the list is empty
  */
-template<class T>
-T& List<T>::Last()
+template<class T, class Allocator>
+T& List<T, Allocator>::Last()
 {
     if(isEmpty() == true)
         throw std::logic_error("List is empty!");
 
+    knownSorted = false;    // Element may be modified through the reference
+
     return lastPtr->data;
 }
 
@@ -555,9 +613,9 @@ T& List<T>::Last()
  * @note    For more examples, refer to:
  *          github.com/CaglayanDokme/CPP-Exercises/blob/main/FuncWithLambdaArg.cpp
  */
-template<class T>
+template<class T, class Allocator>
 template<class RuleT>
-List<T>& List<T>::RemoveIf(const RuleT& Predicate)
+List<T, Allocator>& List<T, Allocator>::RemoveIf(const RuleT& Predicate)
 {
     ListNode *currentNode = firstPtr, *tempNode;
 
@@ -578,14 +636,14 @@ List<T>& List<T>::RemoveIf(const RuleT& Predicate)
  * @brief   Removes the first node
  * @return  lValue reference to the current list to support cascaded calls
  */
-template<class T>
-List<T>& List<T>::RemoveFirst()
+template<class T, class Allocator>
+List<T, Allocator>& List<T, Allocator>::RemoveFirst()
 {
     if(isEmpty() == false)
     {
         ListNode* tempPtr = firstPtr;       // Save removing node addresss
         firstPtr = firstPtr->nextPtr;       // Update firstPtr
-        delete tempPtr;                     // Delete saved firstPtr
+        DestroyNode(tempPtr);               // Delete saved firstPtr
         numberOfNodes--;                    // Decrement node count
 
         if(firstPtr != nullptr)
@@ -599,14 +657,14 @@ List<T>& List<T>::RemoveFirst()
  * @brief   Removes the last node
  * @return  lValue reference to the current list to support cascaded calls
  */
-template<class T>
-List<T>& List<T>::RemoveLast()
+template<class T, class Allocator>
+List<T, Allocator>& List<T, Allocator>::RemoveLast()
 {
     if(isEmpty() == false)
     {
         ListNode* tempPtr = lastPtr;        // Save removing node addresss
         lastPtr = lastPtr->prevPtr;         // Update lastPtr
-        delete tempPtr;                     // Delete saved lastPtr
+        DestroyNode(tempPtr);               // Delete saved lastPtr
         numberOfNodes--;                    // Decrement node count
 
         if(lastPtr != nullptr)
@@ -621,8 +679,8 @@ List<T>& List<T>::RemoveLast()
  * @param   data    Value to be removed
  * @return  lValue reference to the list to support cascaded calls
  */
-template<class T>
-List<T>& List<T>::RemoveIf(const_reference data)
+template<class T, class Allocator>
+List<T, Allocator>& List<T, Allocator>::RemoveIf(const_reference data)
 {
     // Remove by starting from the first node
     return RemoveIf(data, firstPtr);
@@ -633,8 +691,8 @@ List<T>& List<T>::RemoveIf(const_reference data)
  * @param   data Search key
  * @return  lValue reference to the list to support cascaded calls
  */
-template<class T>
-List<T>& List<T>::RemoveFirstOf(const_reference data)
+template<class T, class Allocator>
+List<T, Allocator>& List<T, Allocator>::RemoveFirstOf(const_reference data)
 {
     RemoveNode(Find(data, firstPtr));   // Find and remove the first sample
 
@@ -646,8 +704,8 @@ List<T>& List<T>::RemoveFirstOf(const_reference data)
  * @param   data Search key
  * @return  lValue reference to the list to support cascaded calls
  */
-template<class T>
-List<T>& List<T>::RemoveLastOf(const_reference data)
+template<class T, class Allocator>
+List<T, Allocator>& List<T, Allocator>::RemoveLastOf(const_reference data)
 {
     RemoveNode(FindReversed(data, lastPtr));   // Find and remove the last sample
 
@@ -659,8 +717,8 @@ List<T>& List<T>::RemoveLastOf(const_reference data)
  * @param   data    Value to be removed
  * @return  lValue reference to the list to support cascaded calls
  */
-template<class T>
-List<T>& List<T>::RemoveIfNot(const_reference data)
+template<class T, class Allocator>
+List<T, Allocator>& List<T, Allocator>::RemoveIfNot(const_reference data)
 {
     ListNode* removingNode;      // Node to be removed
     ListNode* searchStartPoint;  // Node where the search will start
@@ -683,8 +741,8 @@ List<T>& List<T>::RemoveIfNot(const_reference data)
  * @param   data Comparison key
  * @return  lValue reference to the list to support cascaded calls
  */
-template<class T>
-List<T>& List<T>::RemoveFirstNotOf(const_reference data)
+template<class T, class Allocator>
+List<T, Allocator>& List<T, Allocator>::RemoveFirstNotOf(const_reference data)
 {
     // Find and remove the first sample not of given data
     RemoveNode(FindNotOf(data, firstPtr));
@@ -697,8 +755,8 @@ List<T>& List<T>::RemoveFirstNotOf(const_reference data)
  * @param   data Comparison key
  * @return  lValue reference to the list to support cascaded calls
  */
-template<class T>
-List<T>& List<T>::RemoveLastNotOf(const_reference data)
+template<class T, class Allocator>
+List<T, Allocator>& List<T, Allocator>::RemoveLastNotOf(const_reference data)
 {
     // Find and remove the last sample not of given data
     RemoveNode(FindNotOfReversed(data, lastPtr));
@@ -710,8 +768,8 @@ List<T>& List<T>::RemoveLastNotOf(const_reference data)
  * @brief   Removes all nodes
  * @return  lValue reference to the empty list to support cascaded calls
  */
-template<class T>
-List<T>& List<T>::EraseAll()
+template<class T, class Allocator>
+List<T, Allocator>& List<T, Allocator>::EraseAll()
 {
     /* Remove all until the list is empty */
     while(isEmpty() == false)
@@ -725,9 +783,11 @@ List<T>& List<T>::EraseAll()
  * @param   oldData Data key to be replaced
  * @param   newData Replace value
  */
-template<class T>
-void List<T>::ReplaceAllWith(const_reference oldData, const_reference newData)
+template<class T, class Allocator>
+void List<T, Allocator>::ReplaceAllWith(const_reference oldData, const_reference newData)
 {
+    knownSorted = false;    // New data may break the order
+
     ListNode* currentNode = firstPtr;
 
     while(currentNode != nullptr)
@@ -747,9 +807,11 @@ void List<T>::ReplaceAllWith(const_reference oldData, const_reference newData)
  * @param   oldData Data key to be replaced
  * @param   newData Replace value
  */
-template<class T>
-void List<T>::ReplaceFirstWith(const_reference oldData, const_reference newData)
+template<class T, class Allocator>
+void List<T, Allocator>::ReplaceFirstWith(const_reference oldData, const_reference newData)
 {
+    knownSorted = false;    // New data may break the order
+
     ListNode* currentNode = Find(oldData, firstPtr);
 
     if(currentNode != nullptr)
@@ -761,9 +823,11 @@ void List<T>::ReplaceFirstWith(const_reference oldData, const_reference newData)
  * @param   oldData Data key to be replaced
  * @param   newData Replace value
  */
-template<class T>
-void List<T>::ReplaceLastWith(const_reference oldData, const_reference newData)
+template<class T, class Allocator>
+void List<T, Allocator>::ReplaceLastWith(const_reference oldData, const_reference newData)
 {
+    knownSorted = false;    // New data may break the order
+
     ListNode* currentNode = FindReversed(oldData, lastPtr);
 
     if(currentNode != nullptr)
@@ -776,8 +840,8 @@ void List<T>::ReplaceLastWith(const_reference oldData, const_reference newData)
  * @note    There is no need to make a complete swap.
  *          Interchancing the first and last nodes does the same.
  */
-template<class T>
-void List<T>::Swap(List<T>& anotherList)
+template<class T, class Allocator>
+void List<T, Allocator>::Swap(List<T, Allocator>& anotherList)
 {
     if(*this == anotherList)
         return;     // Self swap is not required
@@ -798,6 +862,11 @@ void List<T>::Swap(List<T>& anotherList)
     tempSize                    = numberOfNodes;                // Save the size of this list
     numberOfNodes               = anotherList.numberOfNodes;    // Replace the size of this
     anotherList.numberOfNodes   = tempSize;                     // Replace the size of the other list
+
+    // Nodes must be released by the allocator which created them
+    using std::swap;
+    swap(nodeAllocator, anotherList.nodeAllocator);
+    swap(knownSorted, anotherList.knownSorted);
 }
 
 /**
@@ -805,8 +874,8 @@ void List<T>::Swap(List<T>& anotherList)
  * @param newSize   New list size, expressed in number of elements
  * @param data      Object whose content is copied to the appended nodes
  */
-template<class T>
-void List<T>::Resize(const size_type newSize, const_reference data)
+template<class T, class Allocator>
+void List<T, Allocator>::Resize(const size_type newSize, const_reference data)
 {
     // Remove excessive nodes if exists
     while(newSize < GetNodeCount())
@@ -820,8 +889,8 @@ void List<T>::Resize(const size_type newSize, const_reference data)
 /**
  * @brief Removes all but the first element from every consecutive group of equal elements in the container.
  */
-template<class T>
-void List<T>::MakeUnique()
+template<class T, class Allocator>
+void List<T, Allocator>::MakeUnique()
 {
     ListNode* currentNode = firstPtr;
 
@@ -836,68 +905,145 @@ void List<T>::MakeUnique()
 }
 
 /**
- * @brief Sorts the elements with insertion sort.
+ * @brief Sorts the elements in ascending order.
+ */
+template<class T, class Allocator>
+void List<T, Allocator>::Sort()
+{
+    Sort(std::less<value_type>());
+}
+
+/**
+ * @brief   Sorts the elements with a stable bottom-up merge sort.
+ * @param   comp    Binary predicate that returns true if the first argument shall precede the second one.
+ * @note    Nodes are relinked, the elements are neither copied nor moved.
+ * @note    Equal elements preserve their relative order.
+ * @note    All nodes are kept in the list if the comparator throws, but their order is unspecified.
  */
-template<class T>
-void List<T>::Sort()
+template<class T, class Allocator>
+template<class Compare>
+void List<T, Allocator>::Sort(Compare comp)
 {
     // At least two nodes required for sorting
-    if((isEmpty() == true) || (firstPtr == lastPtr))
+    if(GetNodeCount() < 2)
         return;
 
-    ListNode *minNode, *swapNode = firstPtr;
-    while (swapNode != nullptr)
+    /* Each pass merges the adjacent sorted runs of the given length.
+     * Only the next links are maintained during the passes. */
+    for(size_type runLength = 1; runLength < GetNodeCount(); runLength *= 2)
     {
-        minNode = FindMinimum(swapNode);    // Find the minimum node of the list after (including)swap node
-        SwapNodes(minNode, swapNode);       // Swap the minimum node and swapNode
-        swapNode = minNode->nextPtr;        // Continue from the next node
+        ListNode* remainingNodes = firstPtr;    // Runs waiting to be merged in this pass
+        ListNode* passFirst      = nullptr;     // First node of the merged runs
+        ListNode* passLast       = nullptr;     // Last node of the merged runs
+
+        while(remainingNodes != nullptr)
+        {
+            ListNode* leftRun   = remainingNodes;
+            ListNode* rightRun  = SplitRun(leftRun, runLength);
+            remainingNodes      = SplitRun(rightRun, runLength);
+
+            ListNode *mergedFirst = nullptr, *mergedLast = nullptr;
+
+            try {
+                MergeRuns(leftRun, rightRun, comp, mergedFirst, mergedLast);
+            }catch(...){
+                // Chain all nodes again to keep the list consistent
+                ((passLast != nullptr) ? passLast->nextPtr : passFirst) = mergedFirst;
+                mergedLast->nextPtr = remainingNodes;
+
+                firstPtr    = passFirst;
+                knownSorted = false;
+                RelinkPrevious();
+
+                throw;  // Propagate exception
+            }
+
+            // Append the merged run to the result of this pass
+            ((passLast != nullptr) ? passLast->nextPtr : passFirst) = mergedFirst;
+            passLast = mergedLast;
+        }
+
+        firstPtr = passFirst;
     }
+
+    RelinkPrevious();
+
+    knownSorted = std::is_same_v<Compare, std::less<value_type>> || std::is_same_v<Compare, std::less<>>;
+}
+
+/**
+ * @brief   Merges two sorted lists into a single sorted list.
+ * @param   anotherList List to be merged
+ * @note    The second list will be completely flushed after this operation.
+ */
+template<class T, class Allocator>
+void List<T, Allocator>::Merge(List<T, Allocator>& anotherList)
+{
+    Merge(anotherList, std::less<value_type>());
 }
 
 /**
- * @brief   Merges two lists into a single list.
+ * @brief   Merges two lists sorted by the given comparator into a single sorted list.
  * @param   anotherList List to be merged
+ * @param   comp        Binary predicate that returns true if the first argument shall precede the second one.
+ * @note    Both lists must already be sorted by the comparator, sortedness is not checked.
  * @note    The second list will be completely flushed after this operation.
+ * @note    Equal elements of this list precede the ones of the second list.
  */
-template<class T>
-void List<T>::Merge(List<T>& anotherList)
+template<class T, class Allocator>
+template<class Compare>
+void List<T, Allocator>::Merge(List<T, Allocator>& anotherList, Compare comp)
 {
-    // Both of the lists must be sorted before merging
-    if(isSorted() == false)
-        Sort(); // Sort first
+    if((this == &anotherList) || (anotherList.isEmpty() == true))
+        return;
 
-    if(anotherList.isSorted() == false)
-        anotherList.Sort(); // Sort first
+    AcquireNodes(anotherList);  // Nodes will be relinked
 
-    ListNode *currentNodeL1 = firstPtr, *currentNodeL2 = anotherList.firstPtr;
+    // Take over the nodes of the other list
+    ListNode* anotherFirst      = anotherList.firstPtr;
+    numberOfNodes              += anotherList.GetNodeCount();
 
-    while(currentNodeL1 != nullptr)
-    {
-        currentNodeL2 = anotherList.firstPtr;
-        if(currentNodeL1->data > currentNodeL2->data)
-        {
-            anotherList.DetachNode(currentNodeL2);
-            Prepend(currentNodeL1, currentNodeL2);
-        }
-        else
-            currentNodeL1 = currentNodeL1->nextPtr;
+    anotherList.firstPtr        = nullptr;
+    anotherList.lastPtr         = nullptr;
+    anotherList.numberOfNodes   = 0;
+
+    ListNode *mergedFirst = nullptr, *mergedLast = nullptr;
+
+    // Lists sorted in ascending order stay sorted after merging
+    const bool bothSorted = knownSorted && anotherList.knownSorted;
+    anotherList.knownSorted = true;     // Empty list
+
+    try {
+        MergeRuns(firstPtr, anotherFirst, comp, mergedFirst, mergedLast);
+    }catch(...){
+        // All nodes are kept in this list
+        firstPtr    = mergedFirst;
+        knownSorted = false;
+        RelinkPrevious();
+
+        throw;  // Propagate exception
     }
 
-    // Concatenate remaining elements of other list as they are already sorted
-    if(anotherList.isEmpty() == false)
-        Concatenate(anotherList);
+    firstPtr = mergedFirst;
+    RelinkPrevious();
+
+    knownSorted = bothSorted && (std::is_same_v<Compare, std::less<value_type>> || std::is_same_v<Compare, std::less<>>);
 }
 
 /**
  * @brief   Concatenates another list to this one.
  * @param   anotherList List to be concatenated.
  */
-template<class T>
-void List<T>::Concatenate(List<T>& anotherList)
+template<class T, class Allocator>
+void List<T, Allocator>::Concatenate(List<T, Allocator>& anotherList)
 {
     if(anotherList.isEmpty() == true)
         return;
 
+    AcquireNodes(anotherList);  // Nodes will be relinked
+
+    knownSorted = false;    // Order of the joint is unknown
+
     if(isEmpty() == true)
         firstPtr = anotherList.firstPtr;
 
@@ -919,16 +1065,76 @@ void List<T>::Concatenate(List<T>& anotherList)
 
 /**
  * @brief   Transfers elements from another list into this list by appending them at position.
- * @param   destination Position the append will occur.
+ * @param   destination Position the append will occur, end() prepends the elements to the first node.
  * @param   anotherList Source list. It will be completely flushed.
+ * @throws  std::logic_error If the destination does not belong to this list.
+ */
+template<class T, class Allocator>
+void List<T, Allocator>::Splice(const iterator& destination, List<T, Allocator>& anotherList)
+{
+    if(&destination.list != this)
+        throw std::logic_error("Iterator does not belong to the list!");
+
+    if((this == &anotherList) || (anotherList.isEmpty() == true))
+        return;
+
+    TransferChain(destination.node, anotherList, anotherList.firstPtr, anotherList.lastPtr, anotherList.GetNodeCount());
+}
+
+/**
+ * @brief   Transfers a single element from another list into this list by appending it at position.
+ * @param   destination Position the append will occur, end() prepends the element to the first node.
+ * @param   anotherList Source list, may be this list.
+ * @param   element     Element of the source list to be transferred.
+ * @throws  std::logic_error If any of the iterators does not belong to its list.
+ * @throws  std::logic_error If the element is past the end.
+ * @note    Takes constant time, the node is relinked without being copied.
  */
-template<class T>
-void List<T>::Splice(const iterator& destination, List<T>& anotherList)
+template<class T, class Allocator>
+void List<T, Allocator>::Splice(const iterator& destination, List<T, Allocator>& anotherList, const iterator& element)
 {
-    if(destination.node == nullptr)
-        throw std::logic_error("Iterator had been corrupted!");
+    if((&destination.list != this) || (&element.list != &anotherList))
+        throw std::logic_error("Iterator does not belong to the list!");
+
+    if(element.node == nullptr)
+        throw std::logic_error("Cannot transfer past the end!");
 
-    Append(destination.node, anotherList);
+    if(destination.node == element.node)
+        return; // Cannot be appended to itself, it is already there
+
+    TransferChain(destination.node, anotherList, element.node, element.node, 1);
+}
+
+/**
+ * @brief   Transfers a range of elements from another list into this list by appending them at position.
+ * @param   destination Position the append will occur, end() prepends the elements to the first node.
+ * @param   anotherList Source list, may be this list.
+ * @param   first       First element of the range to be transferred.
+ * @param   last        Element following the last element of the range to be transferred.
+ * @throws  std::logic_error If any of the iterators does not belong to its list.
+ * @note    The destination must not be inside the range if both lists are the same.
+ * @note    Takes linear time in the length of the range for counting the elements,
+ *          constant time if both lists are the same. The nodes are relinked without being copied.
+ */
+template<class T, class Allocator>
+void List<T, Allocator>::Splice(const iterator& destination, List<T, Allocator>& anotherList, const iterator& first, const iterator& last)
+{
+    if((&destination.list != this) || (&first.list != &anotherList) || (&last.list != &anotherList))
+        throw std::logic_error("Iterator does not belong to the list!");
+
+    if(first.node == last.node)
+        return; // Empty range
+
+    ListNode* chainLast     = (last.node == nullptr) ? anotherList.lastPtr : last.node->prevPtr;
+    size_type chainLength   = 0;
+
+    if(this != &anotherList)    // Node counts don't change for transfers inside the same list
+    {
+        for(const ListNode* currentNode = first.node; currentNode != last.node; currentNode = currentNode->nextPtr)
+            ++chainLength;
+    }
+
+    TransferChain(destination.node, anotherList, first.node, chainLast, chainLength);
 }
 
 /**
@@ -936,8 +1142,8 @@ void List<T>::Splice(const iterator& destination, List<T>& anotherList)
  * @param   initializerList Source list
  * @return  lValue reference to current list to support cascaded calls
  */
-template<class T>
-List<T>& List<T>::operator=(std::initializer_list<T> initializerList)
+template<class T, class Allocator>
+List<T, Allocator>& List<T, Allocator>::operator=(std::initializer_list<T> initializerList)
 {
     EraseAll(); // Destroy all nodes first
 
@@ -955,8 +1161,8 @@ List<T>& List<T>::operator=(std::initializer_list<T> initializerList)
  *          Returns nullptr if the data couldn't found.
  * @note    The algorithm used is the linear search as there are no value-based relation between nodes.
  */
-template<class T>
-typename List<T>::ListNode* List<T>::Find(const_reference data, ListNode* beginByNode)
+template<class T, class Allocator>
+typename List<T, Allocator>::ListNode* List<T, Allocator>::Find(const_reference data, ListNode* beginByNode)
 {
     // Search begins by the given node
     ListNode* currentNode = beginByNode;
@@ -982,8 +1188,8 @@ typename List<T>::ListNode* List<T>::Find(const_reference data, ListNode* beginB
  *          Returns nullptr if the data couldn't found.
  * @note    The algorithm used is the linear search as there are no value-based relation between nodes.
  */
-template<class T>
-typename List<T>::ListNode* List<T>::FindNotOf(const_reference data, ListNode* beginByNode)
+template<class T, class Allocator>
+typename List<T, Allocator>::ListNode* List<T, Allocator>::FindNotOf(const_reference data, ListNode* beginByNode)
 {
     // Search begins by the given node
     ListNode* currentNode = beginByNode;
@@ -1009,8 +1215,8 @@ typename List<T>::ListNode* List<T>::FindNotOf(const_reference data, ListNode* b
  *          Returns nullptr if the data couldn't found.
  * @note    The algorithm used is the reversed linear search as there are no value-based relation between nodes.
  */
-template<class T>
-typename List<T>::ListNode* List<T>::FindReversed(const_reference data, ListNode* beginByNode)
+template<class T, class Allocator>
+typename List<T, Allocator>::ListNode* List<T, Allocator>::FindReversed(const_reference data, ListNode* beginByNode)
 {
     // Search begins by the given node
     ListNode* currentNode = beginByNode;
@@ -1036,8 +1242,8 @@ typename List<T>::ListNode* List<T>::FindReversed(const_reference data, ListNode
  *          Returns nullptr if the data couldn't found.
  * @note    The algorithm used is the reversed linear search as there are no value-based relation between nodes.
  */
-template<class T>
-typename List<T>::ListNode* List<T>::FindNotOfReversed(const_reference data, ListNode* beginByNode)
+template<class T, class Allocator>
+typename List<T, Allocator>::ListNode* List<T, Allocator>::FindNotOfReversed(const_reference data, ListNode* beginByNode)
 {
     // Search begins by the given node
     ListNode* currentNode = beginByNode;
@@ -1055,42 +1261,13 @@ typename List<T>::ListNode* List<T>::FindNotOfReversed(const_reference data, Lis
     return currentNode;
 }
 
-/**
- * @brief   Finds the node with minimum data starting from a given node
- * @param   beginByNode Search starts from this node.s
- * @return  Address of the node with minimum data.
- * @throws  std::logic_error If the list is empty or the start node is undefined.
- */
-template<class T>
-typename List<T>::ListNode* List<T>::FindMinimum(ListNode* beginByNode)
-{
-    // Check for exceptional situations
-    if(beginByNode == nullptr)
-        throw std::logic_error("Start node cannot be a nullptr!");
-    else if(isEmpty() == true)
-        throw std::logic_error("List is empty!");
-    else{}
-
-    ListNode* currentNode = beginByNode->nextPtr, *minNode = beginByNode;
-
-    while(currentNode != nullptr)
-    {
-        if(currentNode->data < minNode->data)
-            minNode = currentNode;
-
-        currentNode = currentNode->nextPtr;
-    }
-
-    return minNode;
-}
-
 /**
  * @brief   Removes a certain node from the list by not destroying the content of the node.s
  * @param   removingNode Address of the node to be removed.
  * @throw   std::logic_error If the list was empty.
  */
-template<class T>
-void List<T>::DetachNode(ListNode* removingNode)
+template<class T, class Allocator>
+void List<T, Allocator>::DetachNode(ListNode* removingNode)
 {
     if(isEmpty() == true)
         throw std::logic_error("Empty list cannot have any nodes!");
@@ -1118,8 +1295,8 @@ void List<T>::DetachNode(ListNode* removingNode)
  * @brief   Removes the given node.
  * @param   removingNode Address of the node to be removed.
  */
-template<class T>
-void List<T>::RemoveNode(ListNode* removingNode)
+template<class T, class Allocator>
+void List<T, Allocator>::RemoveNode(ListNode* removingNode)
 {
     if(removingNode == nullptr)         // Return if the node is not valids
         return;
@@ -1133,7 +1310,7 @@ void List<T>::RemoveNode(ListNode* removingNode)
         removingNode->nextPtr->prevPtr = removingNode->prevPtr;
         removingNode->prevPtr->nextPtr = removingNode->nextPtr;
 
-        delete removingNode;    // Delete the node
+        DestroyNode(removingNode);  // Delete the node
         numberOfNodes--;        // Decrement node counter
     }
 }
@@ -1144,8 +1321,8 @@ void List<T>::RemoveNode(ListNode* removingNode)
  * @param   beginByNode Node where the search will start from
  * @return  lValue reference to the list to support cascaded calls
  */
-template<class T>
-List<T>& List<T>::RemoveIf(const_reference data, ListNode* beginByNode)
+template<class T, class Allocator>
+List<T, Allocator>& List<T, Allocator>::RemoveIf(const_reference data, ListNode* beginByNode)
 {
     ListNode* removingNode;      // Node to be removed
     ListNode* searchStartPoint;  // Node where the search will start again from
@@ -1164,139 +1341,90 @@ List<T>& List<T>::RemoveIf(const_reference data, ListNode* beginByNode)
 }
 
 /**
- * @brief   Swaps any kind of nodes.
- * @param   firstNode   Node to be swapped.
- * @param   secondNode  Node to be swapped.
- * @throws  std::logic_error If the nodes are undefined.
+ * @brief   Rebuilds the previous links and the last node by following the next links from the first node.
  */
-template<class T>
-void List<T>::SwapNodes(ListNode* firstNode, ListNode* secondNode)
+template<class T, class Allocator>
+void List<T, Allocator>::RelinkPrevious() noexcept
 {
-    // Check for exceptional situations
-    if((firstNode == nullptr) || (secondNode == nullptr))
-        throw std::logic_error("Cannot swap undefined nodes!");
-    else if (firstNode == secondNode)
-        return; // No need to swap
-    else{}
-
-    // Successive nodes should be handled in a slightly different way
-    if(firstNode->nextPtr == secondNode)
-        SwapSuccessiveNodes(firstNode, secondNode);
-    else if (firstNode->prevPtr == secondNode)
-        SwapSuccessiveNodes(secondNode, firstNode);
-    else
-        SwapNonSuccessiveNodes(firstNode, secondNode);
+    ListNode* previousNode = nullptr;
+
+    for(ListNode* currentNode = firstPtr; currentNode != nullptr; currentNode = currentNode->nextPtr)
+    {
+        currentNode->prevPtr    = previousNode;
+        previousNode            = currentNode;
+    }
+
+    lastPtr = previousNode;
 }
 
 /**
- * @brief   Swaps successive nodes.
- * @param   firstNode   Node to be swapped.
- * @param   secondNode  Node to be swapped.
- * @throws  std::logic_error If the nodes are not successively bounded.
+ * @brief   Cuts a run of nodes off a chain linked by the next links.
+ * @param   first   First node of the run, may be NULL.
+ * @param   length  Maximum number of nodes in the run.
+ * @return  First node after the run, NULL if the chain is exhausted.
  */
-template<class T>
-void List<T>::SwapSuccessiveNodes(ListNode* firstNode, ListNode* secondNode)
+template<class T, class Allocator>
+typename List<T, Allocator>::ListNode* List<T, Allocator>::SplitRun(ListNode* first, size_type length) noexcept
 {
-    // Check for exceptional situations
-    if((firstNode->nextPtr != secondNode) || (secondNode->prevPtr != firstNode))
-        throw std::logic_error("Nodes are not successive!");
-
-    // Rebuild links between successive nodes
-    secondNode->prevPtr = firstNode->prevPtr;
-    firstNode->nextPtr  = secondNode->nextPtr;
-
-    // Adjust the previous and next nodes
-    // firstPtr and lastPtr may be modified
-    if(firstNode != firstPtr)
-        firstNode->prevPtr->nextPtr = secondNode;
-    else
-        firstPtr = secondNode;
+    if(first == nullptr)
+        return nullptr;
 
-    if(secondNode != lastPtr)
-        secondNode->nextPtr->prevPtr = firstNode;
-    else
-        lastPtr = firstNode;
+    // Find the last node of the run
+    for( ; (length > 1) && (first->nextPtr != nullptr); --length)
+        first = first->nextPtr;
+
+    ListNode* nextRun   = first->nextPtr;
+    first->nextPtr      = nullptr;  // Terminate the run
 
-    firstNode->prevPtr  = secondNode;
-    secondNode->nextPtr = firstNode;
+    return nextRun;
 }
 
 /**
- * @brief   Swaps the nonsuccessive nodes between each other.
- * @param   firstNode   Node to be swapped.
- * @param   secondNode  Node to be swapped.
- * @throws  std::logic_error If any node is undefined.
- * @throws  std::logic_error If nodes are the same.
+ * @brief   Merges two sorted runs linked by the next links.
+ * @param   left            First node of the left run, may be NULL.
+ * @param   right           First node of the right run, may be NULL.
+ * @param   comp            Binary predicate that returns true if the first argument shall precede the second one.
+ * @param   mergedFirst     First node of the merged run.
+ * @param   mergedLast      Last node of the merged run.
+ * @note    Nodes of the left run precede the equal nodes of the right run.
+ * @note    The merged run contains all nodes even if the comparator throws.
  */
-template<class T>
-void List<T>::SwapNonSuccessiveNodes(ListNode* firstNode, ListNode* secondNode)
+template<class T, class Allocator>
+template<class Compare>
+void List<T, Allocator>::MergeRuns(ListNode* left, ListNode* right, Compare& comp, ListNode*& mergedFirst, ListNode*& mergedLast)
 {
-    // Check for exceptional situations
-    if((firstNode == nullptr) || (secondNode == nullptr))
-        throw std::logic_error("Cannot swap undefined nodes!");
-    else if (firstNode == secondNode)
-        throw std::logic_error("Nodes must be different!");
-    else if(firstNode->nextPtr == secondNode)
-        return SwapSuccessiveNodes(firstNode, secondNode);
-    else if(firstNode->prevPtr == secondNode)
-        return SwapSuccessiveNodes(secondNode, firstNode);
-    else{}
-
-    ListNode* tempPtr = nullptr;
-
-    /** Update previos pointers **/
-    if(firstNode == firstPtr)	// First one is the firstPtr
-    {
-        secondNode->prevPtr->nextPtr 	= firstNode;
-        firstNode->prevPtr 				= secondNode->prevPtr;
-        secondNode->prevPtr 			= nullptr;
-        firstPtr                        = secondNode;	// Change global firstPtr
-    }
-    else
-    {
-        if(secondNode == firstPtr)	// Second one is the firstPtr
-        {
-            firstNode->prevPtr->nextPtr	= secondNode;
-            secondNode->prevPtr			= firstNode->prevPtr;
-            firstNode->prevPtr 			= nullptr;
-            firstPtr                    = firstNode;	// Change global firstPtr
-        }
-        else	// Both of the nodes are not the edges of the list
-        {
-            firstNode->prevPtr->nextPtr 	= secondNode;
-            secondNode->prevPtr->nextPtr 	= firstNode;
-            tempPtr                         = secondNode->prevPtr;
-            secondNode->prevPtr 			= firstNode->prevPtr;
-            firstNode->prevPtr 				= tempPtr;
-        }
-    }
+    ListNode** nextLink = &mergedFirst;     // Link to be filled by the next merged node
 
-    /** Update next pointers **/
-    if(firstNode == lastPtr)	// First one is the lastPtr
-    {
-        firstNode->nextPtr 				= secondNode->nextPtr;
-        secondNode->nextPtr->prevPtr 	= firstNode;
-        secondNode->nextPtr 			= nullptr;
-        lastPtr                         = secondNode;	// Change global lastPtr
-    }
-    else
-    {
-        if(secondNode == lastPtr)	// Second one is the lastPtr
+    // Appends the remaining nodes of a run
+    auto appendRun = [&nextLink, &mergedLast](ListNode* run) noexcept {
+        for( ; run != nullptr; run = run->nextPtr)
         {
-            secondNode->nextPtr 		= firstNode->nextPtr;
-            firstNode->nextPtr->prevPtr = secondNode;
-            firstNode->nextPtr 			= nullptr;
-            lastPtr                     = firstNode;	// Change the global lastPtr
+            *nextLink   = run;
+            mergedLast  = run;
+            nextLink    = &(run->nextPtr);
         }
-        else	// Both of the nodes are not the edges of the list
+    };
+
+    try {
+        while((left != nullptr) && (right != nullptr))
         {
-            firstNode->nextPtr->prevPtr 	= secondNode;
-            secondNode->nextPtr->prevPtr 	= firstNode;
-            tempPtr                         = firstNode->nextPtr;
-            firstNode->nextPtr 				= secondNode->nextPtr;
-            secondNode->nextPtr 			= tempPtr;
+            // Right node is taken only if it is strictly less, which keeps the merge stable
+            ListNode*& takenRun = comp(right->data, left->data) ? right : left;
+
+            *nextLink   = takenRun;
+            mergedLast  = takenRun;
+            nextLink    = &(takenRun->nextPtr);
+            takenRun    = takenRun->nextPtr;
         }
+    }catch(...){
+        appendRun(left);
+        appendRun(right);
+
+        throw;  // Propagate exception
     }
+
+    appendRun(left);
+    appendRun(right);
 }
 
 /**
@@ -1305,12 +1433,14 @@ void List<T>::SwapNonSuccessiveNodes(ListNode* firstNode, ListNode* secondNode)
  * @param   newNode     Any node to be appended.
  * @throws  std::logic_error If any of the given nodes is NULL.
  */
-template<class T>
-void List<T>::Append(ListNode* baseNode, ListNode* newNode)
+template<class T, class Allocator>
+void List<T, Allocator>::Append(ListNode* baseNode, ListNode* newNode)
 {
     if((baseNode == nullptr) || (newNode == nullptr))
         throw std::logic_error("Base node cannot be NULL while appending!");
 
+    knownSorted = false;    // Order of the new node is unknown
+
     // Update lastPtr if needed
     if(baseNode == lastPtr)
         lastPtr = newNode;
@@ -1330,12 +1460,14 @@ void List<T>::Append(ListNode* baseNode, ListNode* newNode)
  * @param   newNode     Any node to be prepended.
  * @throws  std::logic_error If any of the given nodes is NULL.
  */
-template<class T>
-void List<T>::Prepend(ListNode* baseNode, ListNode* newNode)
+template<class T, class Allocator>
+void List<T, Allocator>::Prepend(ListNode* baseNode, ListNode* newNode)
 {
     if((baseNode == nullptr) || (newNode == nullptr))
         throw std::logic_error("Base node cannot be NULL while appending!");
 
+    knownSorted = false;    // Order of the new node is unknown
+
     // Update lastPtr if needed
     if(baseNode == firstPtr)
         firstPtr = newNode;
@@ -1350,40 +1482,157 @@ void List<T>::Prepend(ListNode* baseNode, ListNode* newNode)
 }
 
 /**
- * @brief   Appends a list to a node of the current list
- * @param   baseNode    Destination node
- * @param   anotherList List to appended to
- * @throw   std::logic_error If the destination node is NULL.
+ * @brief   Relinks a chain of nodes from another list after a node of this list.
+ * @param   baseNode    Node of this list, NULL prepends the chain to the first node.
+ * @param   anotherList List containing the chain, may be this list.
+ * @param   chainFirst  First node of the chain.
+ * @param   chainLast   Last node of the chain, reachable from the first node.
+ * @param   chainLength Number of nodes in the chain, may be 0 if both lists are the same.
+ * @note    The elements are moved into new nodes if the allocators of the lists are not equal.
  */
-template<class T>
-void List<T>::Append(ListNode* baseNode, List<T>& anotherList)
+template<class T, class Allocator>
+void List<T, Allocator>::TransferChain(ListNode* baseNode, List<T, Allocator>& anotherList, ListNode* chainFirst, ListNode* chainLast, size_type chainLength)
 {
+    if(!(nodeAllocator == anotherList.nodeAllocator))
+    {
+        // Nodes must be released by the allocator which created them, move the elements into new nodes
+        List<T, Allocator> rebuiltList(get_allocator());
+        ListNode* const chainEnd = chainLast->nextPtr;
+
+        for(ListNode* currentNode = chainFirst; currentNode != chainEnd; currentNode = currentNode->nextPtr)
+            rebuiltList.EmplaceAppend(std::move(currentNode->data));
+
+        // Remove the moved-from nodes of the other list
+        while(chainFirst != chainEnd)
+        {
+            ListNode* nextNode = chainFirst->nextPtr;
+            anotherList.RemoveNode(chainFirst);
+            chainFirst = nextNode;
+        }
+
+        return TransferChain(baseNode, rebuiltList, rebuiltList.firstPtr, rebuiltList.lastPtr, rebuiltList.GetNodeCount());
+    }
+
+    // Unlink the chain from the other list
+    if(chainFirst == anotherList.firstPtr)
+        anotherList.firstPtr = chainLast->nextPtr;
+    else
+        chainFirst->prevPtr->nextPtr = chainLast->nextPtr;
+
+    if(chainLast == anotherList.lastPtr)
+        anotherList.lastPtr = chainFirst->prevPtr;
+    else
+        chainLast->nextPtr->prevPtr = chainFirst->prevPtr;
+
+    anotherList.numberOfNodes -= chainLength;
+
+    // Link the chain after the base node
+    ListNode* nextNode = (baseNode == nullptr) ? firstPtr : baseNode->nextPtr;
+
+    chainFirst->prevPtr = baseNode;
+    chainLast->nextPtr  = nextNode;
+
     if(baseNode == nullptr)
-        throw std::logic_error("Base node cannot be NULL while appending!");
+        firstPtr = chainFirst;
+    else
+        baseNode->nextPtr = chainFirst;
 
-    if(baseNode == lastPtr)
-        return Concatenate(anotherList);
+    if(nextNode == nullptr)
+        lastPtr = chainLast;
+    else
+        nextNode->prevPtr = chainLast;
 
-    if(anotherList.isEmpty() == true)
-        return;
+    numberOfNodes += chainLength;
+    knownSorted    = false;     // Order of the joints is unknown
+}
 
-    if(isEmpty() == true)
-        return Swap(anotherList);
+/**
+ * @brief   Reconstructs the nodes of another list with the allocator of this list if the allocators are not equal.
+ * @param   anotherList Source list whose nodes are about to be relinked into this list.
+ * @note    Nodes must be released by an allocator equal to the one which created them.
+ *          The elements are moved into the new nodes, the order is preserved.
+ */
+template<class T, class Allocator>
+void List<T, Allocator>::AcquireNodes(List<T, Allocator>& anotherList)
+{
+    if((this == &anotherList) || (nodeAllocator == anotherList.nodeAllocator))
+        return; // Nodes can be relinked directly
 
-    // Adjust new links
-    baseNode->nextPtr->prevPtr      = anotherList.lastPtr;
-    anotherList.lastPtr->nextPtr    = baseNode->nextPtr;
+    List<T, Allocator> rebuiltList(get_allocator());
 
-    anotherList.firstPtr->prevPtr   = baseNode;
-    baseNode->nextPtr               = anotherList.firstPtr;
+    for(ListNode* currentNode = anotherList.firstPtr; currentNode != nullptr; currentNode = currentNode->nextPtr)
+        rebuiltList.EmplaceAppend(std::move(currentNode->data));
 
-    // Incremenet node counter
-    numberOfNodes += anotherList.GetNodeCount();
+    anotherList.EraseAll();
+
+    // Hand over the rebuilt nodes, the allocators stay with their lists
+    std::swap(anotherList.firstPtr,         rebuiltList.firstPtr);
+    std::swap(anotherList.lastPtr,          rebuiltList.lastPtr);
+    std::swap(anotherList.numberOfNodes,    rebuiltList.numberOfNodes);
+    std::swap(anotherList.knownSorted,      rebuiltList.knownSorted);
+}
+
+/**
+ * @brief   Iteratively checks whether the nodes are in ascending order.
+ * @return  true    If each node is not less than its previous node.
+ *          false   If any node is less than its previous node.
+ * @note    The result is not cached, so that the const lists can be checked concurrently.
+ */
+template<class T, class Allocator>
+bool List<T, Allocator>::CheckSorted() const
+{
+    for(const ListNode* currentNode = firstPtr; (currentNode != nullptr) && (currentNode->nextPtr != nullptr); currentNode = currentNode->nextPtr)
+        if(currentNode->nextPtr->data < currentNode->data)
+            return false;
+
+    return true;
+}
+
+/**
+ * @brief   Allocates and constructs a detached node.
+ * @param   args    Arguments forwarded to construct the element of the node.
+ * @return  Address of the new node.
+ * @note    Nothing is leaked if the construction throws.
+ */
+template<class T, class Allocator>
+template<class... Args>
+typename List<T, Allocator>::ListNode* List<T, Allocator>::CreateNode(Args&&... args)
+{
+    ListNode* newNode = NodeTraits::allocate(nodeAllocator, 1);
+
+    try {
+        NodeTraits::construct(nodeAllocator, newNode, std::forward<Args>(args)...);
+    }catch(...){
+        NodeTraits::deallocate(nodeAllocator, newNode, 1);
+
+        throw;  // Propagate exception
+    }
+
+    CONTAINER_STATS_RECORD(List, nodeAllocations, 1);
+
+    // Only the constructions from another element are counted as copies or moves
+    if constexpr((1 == sizeof...(Args)) && (std::is_same_v<std::decay_t<Args>, T> && ...))
+    {
+        if constexpr((std::is_lvalue_reference_v<Args> && ...))
+            CONTAINER_STATS_RECORD(List, bytesCopied, sizeof(T));
+        else
+            CONTAINER_STATS_RECORD(List, bytesMoved, sizeof(T));
+    }
+
+    return newNode;
+}
+
+/**
+ * @brief   Destructs and deallocates a detached node.
+ * @param   node    Node to be destroyed.
+ */
+template<class T, class Allocator>
+void List<T, Allocator>::DestroyNode(ListNode* node)
+{
+    NodeTraits::destroy(nodeAllocator, node);
+    NodeTraits::deallocate(nodeAllocator, node, 1);
 
-    // Destroy old links of the other list
-    anotherList.firstPtr    = nullptr;
-    anotherList.lastPtr     = nullptr;
-    anotherList.numberOfNodes = 0;
+    CONTAINER_STATS_RECORD(List, nodeDeallocations, 1);
 }
 
 /**
@@ -1392,14 +1641,14 @@ void List<T>::Append(ListNode* baseNode, List<T>& anotherList)
  * @param   list    List to be inserted.
  * @return  lValue reference to stream to support cascaded calls.
  */
-template<class T>
-std::ostream& operator<<(std::ostream& stream, const List<T>& list)
+template<class T, class Allocator>
+std::ostream& operator<<(std::ostream& stream, const List<T, Allocator>& list)
 {
     if(list.isEmpty() == true)
         stream << "-- empty list --";
     else
     {
-        typename List<T>::const_iterator it = list.cbegin();
+        typename List<T, Allocator>::const_iterator it = list.cbegin();
 
         while(it != list.cend())
         {
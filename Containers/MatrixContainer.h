@@ -0,0 +1,525 @@
+/**
+ * @file        MatrixContainer.h
+ * @details     A template matrix class with compile-time dimensions.
+ *              Elements are stored contiguously in row-major order, inline for small matrices and on the heap otherwise.
+ *              Element-wise operations are written as flat loops with constant trip counts,
+ *              so that the compiler can fully unroll them for small matrices and auto-vectorize them.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        November 11, 2021 -> First release as an exercise(OverloadingParenthesis.cpp)
+ *              October 14, 2026  -> Promoted to a header with row views, element-wise operations and blocked multiplication.
+ *                                -> Large matrices stored on the heap, Multiply(..) with an output parameter added.
+ *
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include "AlignedAllocator.h"   // AlignedAllocator
+#include "SimdKernels.h"        // SimdKernels::equal
+#include <cassert>              // assert
+#include <cstddef>              // std::size_t
+#include <memory>               // std::uninitialized_default_construct_n, std::uninitialized_copy_n, std::destroy_n
+#include <ostream>              // std::ostream
+#include <stdexcept>            // std::out_of_range
+#include <utility>              // std::swap
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Storage Classes ***/
+// Elements kept inside the matrix object
+template<class DataType, std::size_t SIZE, std::size_t ALIGNMENT, bool IS_INLINE>
+class MatrixStorage {
+public:
+    NODISCARD DataType* get() noexcept              { return elements; }
+    NODISCARD const DataType* get() const noexcept  { return elements; }
+
+private:
+    alignas(ALIGNMENT) DataType elements[SIZE];
+};
+
+/* Elements kept in an aligned space of the heap, moving only takes over the space.
+ * A moved-from storage holds no space, it can only be assigned or destroyed. */
+template<class DataType, std::size_t SIZE, std::size_t ALIGNMENT>
+class MatrixStorage<DataType, SIZE, ALIGNMENT, false> {
+    using Allocator = AlignedAllocator<DataType, ALIGNMENT>;
+
+public:
+    MatrixStorage() : elements(Allocator().allocate(SIZE))
+    {
+        try {
+            std::uninitialized_default_construct_n(elements, SIZE);
+        }
+        catch(...) {
+            Allocator().deallocate(elements, SIZE);
+
+            throw;  // Propagate exception
+        }
+    }
+
+    MatrixStorage(const MatrixStorage& copyStorage) : elements(Allocator().allocate(SIZE))
+    {
+        try {
+            std::uninitialized_copy_n(copyStorage.elements, SIZE, elements);
+        }
+        catch(...) {
+            Allocator().deallocate(elements, SIZE);
+
+            throw;  // Propagate exception
+        }
+    }
+
+    MatrixStorage(MatrixStorage&& moveStorage) noexcept : elements(moveStorage.elements) { moveStorage.elements = nullptr; }
+
+    ~MatrixStorage() { release(); }
+
+    MatrixStorage& operator=(const MatrixStorage& rightStorage)
+    {
+        if(this == &rightStorage)
+            return *this;
+
+        if(nullptr == elements)     // Moved-from, a new space is needed
+        {
+            MatrixStorage copy(rightStorage);
+
+            std::swap(elements, copy.elements);
+        }
+        else
+        {
+            for(std::size_t index = 0; index < SIZE; ++index)
+                elements[index] = rightStorage.elements[index];
+        }
+
+        return *this;
+    }
+
+    // Spaces are exchanged, so the right storage stays usable
+    MatrixStorage& operator=(MatrixStorage&& rightStorage) noexcept
+    {
+        std::swap(elements, rightStorage.elements);
+
+        return *this;
+    }
+
+    NODISCARD DataType* get() noexcept              { return elements; }
+    NODISCARD const DataType* get() const noexcept  { return elements; }
+
+private:
+    void release() noexcept
+    {
+        if(nullptr != elements)
+        {
+            std::destroy_n(elements, SIZE);
+            Allocator().deallocate(elements, SIZE);
+        }
+    }
+
+    DataType* elements;
+};
+
+/*** Container Class ***/
+/* Matrices up to INLINE_BYTES are stored inline, larger ones on the heap so that they can be placed on the stack and
+ * returned by value at the cost of a single allocation. Hot loops should prefer Multiply(..) and the compound
+ * operators, which reuse the storage of an existing matrix. Storage is aligned to 32 bytes, the width of AVX registers.
+ * A moved-from heap stored matrix holds no elements, it can only be assigned or destroyed. */
+template<class DataType, std::size_t ROW, std::size_t COLUMN>
+class Matrix {
+    static_assert(ROW       != 0, "Row size cannot be 0!");
+    static_assert(COLUMN    != 0, "Column size cannot be 0!");
+
+    static constexpr std::size_t SIZE           = ROW * COLUMN;
+    static constexpr std::size_t ALIGNMENT      = (alignof(DataType) > 32) ? alignof(DataType) : 32;
+
+public:
+    static constexpr std::size_t BLOCK_SIZE     = 64;   // Tile size of the blocked algorithms
+    static constexpr std::size_t SMALL_LIMIT    = 16;   // Dimensions up to this size are not blocked
+    static constexpr std::size_t INLINE_BYTES   = 4096; // Largest matrix stored inside the object
+    static constexpr bool IS_INLINE             = (SIZE * sizeof(DataType) <= INLINE_BYTES);
+
+    /*** Row View ***/
+    // Unchecked access to a single row, it is only valid as long as the matrix is alive
+    template<class ElementType>
+    class RowView {
+    public:
+        explicit RowView(ElementType* rowData) noexcept : rowData(rowData) { }
+
+        NODISCARD ElementType& operator[](const std::size_t column) const noexcept { return rowData[column]; }
+
+        NODISCARD ElementType* begin() const noexcept { return rowData;           }
+        NODISCARD ElementType* end()   const noexcept { return rowData + COLUMN;  }
+        NODISCARD static constexpr std::size_t getSize() noexcept { return COLUMN; }
+
+    private:
+        ElementType* rowData;
+    };
+
+    /*** Constructors ***/
+    Matrix() = default;
+    explicit Matrix(const DataType& fillValue) { Fill(fillValue); }
+
+    NODISCARD static Matrix Identity();
+
+    /*** Element Access ***/
+    // Checked access
+    NODISCARD DataType& operator()(const std::size_t row, const std::size_t column);
+    NODISCARD const DataType& operator()(const std::size_t row, const std::size_t column) const;
+
+    // Unchecked access for hot loops
+    NODISCARD RowView<DataType>         operator[](const std::size_t row)       noexcept { return RowView<DataType>(Data() + (row * COLUMN));          }
+    NODISCARD RowView<const DataType>   operator[](const std::size_t row) const noexcept { return RowView<const DataType>(Data() + (row * COLUMN));    }
+
+    NODISCARD DataType*         Data()       noexcept { return storage.get(); }  // Row-major contiguous storage
+    NODISCARD const DataType*   Data() const noexcept { return storage.get(); }  // Row-major contiguous storage
+
+    /*** Element-wise Operations ***/
+    Matrix& Fill(const DataType& fillValue) noexcept;
+    Matrix& operator+=(const Matrix& rightMatrix) noexcept;
+    Matrix& operator-=(const Matrix& rightMatrix) noexcept;
+    Matrix& operator*=(const DataType& factor) noexcept;
+    Matrix& AddScaled(const Matrix& source, const DataType& factor) noexcept;       // this += source * factor
+    Matrix& MultiplyAdd(const Matrix& left, const Matrix& right) noexcept;          // this += left (element-wise *) right
+
+    // Allocate for heap stored matrices, the compound operators should be preferred in loops
+    NODISCARD Matrix operator+(const Matrix& rightMatrix) const { Matrix result(*this); result += rightMatrix; return result; }
+    NODISCARD Matrix operator-(const Matrix& rightMatrix) const { Matrix result(*this); result -= rightMatrix; return result; }
+    NODISCARD Matrix operator*(const DataType& factor)    const { Matrix result(*this); result *= factor;      return result; }
+
+    /*** Matrix Operations ***/
+    template<std::size_t OTHER_COLUMN>
+    NODISCARD Matrix<DataType, ROW, OTHER_COLUMN> operator*(const Matrix<DataType, COLUMN, OTHER_COLUMN>& rightMatrix) const;
+
+    NODISCARD Matrix<DataType, COLUMN, ROW> Transpose() const;
+
+    /*** Comparison ***/
+    NODISCARD bool operator==(const Matrix& rightMatrix) const noexcept;
+    NODISCARD bool operator!=(const Matrix& rightMatrix) const noexcept { return !(*this == rightMatrix); }
+
+    /*** Status Checkers ***/
+    NODISCARD static constexpr std::size_t Rows()    noexcept { return ROW;      }
+    NODISCARD static constexpr std::size_t Columns() noexcept { return COLUMN;   }
+
+private:
+    /*** Members ***/
+    MatrixStorage<DataType, SIZE, ALIGNMENT, IS_INLINE> storage;
+};
+
+/**
+ * @brief   Creates an identity matrix
+ * @return  Matrix with ones on the main diagonal and zeros elsewhere
+ */
+template<class DataType, std::size_t ROW, std::size_t COLUMN>
+Matrix<DataType, ROW, COLUMN> Matrix<DataType, ROW, COLUMN>::Identity()
+{
+    Matrix result(DataType(0));
+
+    for(std::size_t index = 0; (index < ROW) && (index < COLUMN); ++index)
+        result.Data()[(index * COLUMN) + index] = DataType(1);
+
+    return result;
+}
+
+/**
+ * @brief   Checked element access
+ * @param   row     Row index
+ * @param   column  Column index
+ * @return  lValue reference to the element
+ * @throws  std::out_of_range   If any of the indexes is out of range
+ */
+template<class DataType, std::size_t ROW, std::size_t COLUMN>
+DataType& Matrix<DataType, ROW, COLUMN>::operator()(const std::size_t row, const std::size_t column)
+{
+    if((row >= ROW) || (column >= COLUMN))
+        throw std::out_of_range("Index out-of-range error!");
+
+    return Data()[(row * COLUMN) + column];
+}
+
+/**
+ * @brief   Checked element access
+ * @param   row     Row index
+ * @param   column  Column index
+ * @return  Const lValue reference to the element
+ * @throws  std::out_of_range   If any of the indexes is out of range
+ */
+template<class DataType, std::size_t ROW, std::size_t COLUMN>
+const DataType& Matrix<DataType, ROW, COLUMN>::operator()(const std::size_t row, const std::size_t column) const
+{
+    if((row >= ROW) || (column >= COLUMN))
+        throw std::out_of_range("Index out-of-range error!");
+
+    return Data()[(row * COLUMN) + column];
+}
+
+/**
+ * @brief   Fills the matrix with the given value
+ * @param   fillValue   Value to be used to fill the matrix
+ * @return  lValue reference to support cascaded calls
+ */
+template<class DataType, std::size_t ROW, std::size_t COLUMN>
+Matrix<DataType, ROW, COLUMN>& Matrix<DataType, ROW, COLUMN>::Fill(const DataType& fillValue) noexcept
+{
+    DataType* const data = Data();
+
+    for(std::size_t index = 0; index < SIZE; ++index)
+        data[index] = fillValue;
+
+    return *this;
+}
+
+/**
+ * @brief   Element-wise addition
+ * @param   rightMatrix Matrix to be added
+ * @return  lValue reference to support cascaded calls
+ */
+template<class DataType, std::size_t ROW, std::size_t COLUMN>
+Matrix<DataType, ROW, COLUMN>& Matrix<DataType, ROW, COLUMN>::operator+=(const Matrix& rightMatrix) noexcept
+{
+    DataType* const data            = Data();
+    const DataType* const source    = rightMatrix.Data();
+
+    for(std::size_t index = 0; index < SIZE; ++index)
+        data[index] += source[index];
+
+    return *this;
+}
+
+/**
+ * @brief   Element-wise subtraction
+ * @param   rightMatrix Matrix to be subtracted
+ * @return  lValue reference to support cascaded calls
+ */
+template<class DataType, std::size_t ROW, std::size_t COLUMN>
+Matrix<DataType, ROW, COLUMN>& Matrix<DataType, ROW, COLUMN>::operator-=(const Matrix& rightMatrix) noexcept
+{
+    DataType* const data            = Data();
+    const DataType* const source    = rightMatrix.Data();
+
+    for(std::size_t index = 0; index < SIZE; ++index)
+        data[index] -= source[index];
+
+    return *this;
+}
+
+/**
+ * @brief   Scales all elements
+ * @param   factor  Scaling factor
+ * @return  lValue reference to support cascaded calls
+ */
+template<class DataType, std::size_t ROW, std::size_t COLUMN>
+Matrix<DataType, ROW, COLUMN>& Matrix<DataType, ROW, COLUMN>::operator*=(const DataType& factor) noexcept
+{
+    DataType* const data = Data();
+
+    for(std::size_t index = 0; index < SIZE; ++index)
+        data[index] *= factor;
+
+    return *this;
+}
+
+/**
+ * @brief   Adds a scaled matrix in a single pass
+ * @param   source  Matrix to be scaled and added
+ * @param   factor  Scaling factor
+ * @return  lValue reference to support cascaded calls
+ */
+template<class DataType, std::size_t ROW, std::size_t COLUMN>
+Matrix<DataType, ROW, COLUMN>& Matrix<DataType, ROW, COLUMN>::AddScaled(const Matrix& source, const DataType& factor) noexcept
+{
+    DataType* const data                = Data();
+    const DataType* const sourceData    = source.Data();
+
+    for(std::size_t index = 0; index < SIZE; ++index)
+        data[index] += sourceData[index] * factor;
+
+    return *this;
+}
+
+/**
+ * @brief   Adds the element-wise product of two matrices in a single pass
+ * @param   left    Left operand of the product
+ * @param   right   Right operand of the product
+ * @return  lValue reference to support cascaded calls
+ * @note    Compiles to fused multiply-add instructions when the target supports them(e.g. -mfma) and contraction is allowed.
+ */
+template<class DataType, std::size_t ROW, std::size_t COLUMN>
+Matrix<DataType, ROW, COLUMN>& Matrix<DataType, ROW, COLUMN>::MultiplyAdd(const Matrix& left, const Matrix& right) noexcept
+{
+    DataType* const data            = Data();
+    const DataType* const leftData  = left.Data();
+    const DataType* const rightData = right.Data();
+
+    for(std::size_t index = 0; index < SIZE; ++index)
+        data[index] += leftData[index] * rightData[index];
+
+    return *this;
+}
+
+/**
+ * @brief   Matrix multiplication into an existing matrix, no storage is allocated
+ * @param   result  Destination of the product, its previous content is overwritten
+ * @param   left    Left operand
+ * @param   right   Right operand, its row count must be equal to the column count of the left operand
+ * @return  lValue reference to the result to support cascaded calls
+ * @note    The result must not be any of the operands.
+ * @note    Loops are ordered as row-inner-column, so that the innermost loop runs over contiguous rows.
+ *          Large matrices are multiplied tile by tile to keep the operands in cache.
+ */
+template<class DataType, std::size_t ROW, std::size_t COLUMN, std::size_t OTHER_COLUMN>
+Matrix<DataType, ROW, OTHER_COLUMN>& Multiply(Matrix<DataType, ROW, OTHER_COLUMN>&          result,
+                                              const Matrix<DataType, ROW, COLUMN>&          left,
+                                              const Matrix<DataType, COLUMN, OTHER_COLUMN>& right) noexcept
+{
+    constexpr std::size_t BLOCK_SIZE    = Matrix<DataType, ROW, COLUMN>::BLOCK_SIZE;
+    constexpr std::size_t SMALL_LIMIT   = Matrix<DataType, ROW, COLUMN>::SMALL_LIMIT;
+
+    const DataType* const leftData  = left.Data();
+    const DataType* const rightData = right.Data();
+    DataType* const product         = result.Data();
+
+    assert((static_cast<const void*>(product) != leftData) && (static_cast<const void*>(product) != rightData));
+
+    result.Fill(DataType(0));
+
+    if constexpr((ROW <= SMALL_LIMIT) && (COLUMN <= SMALL_LIMIT) && (OTHER_COLUMN <= SMALL_LIMIT))
+    {
+        // Constant bounds, fully unrolled by the compiler
+        for(std::size_t row = 0; row < ROW; ++row)
+            for(std::size_t inner = 0; inner < COLUMN; ++inner)
+            {
+                const DataType factor = leftData[(row * COLUMN) + inner];
+
+                for(std::size_t column = 0; column < OTHER_COLUMN; ++column)
+                    product[(row * OTHER_COLUMN) + column] += factor * rightData[(inner * OTHER_COLUMN) + column];
+            }
+    }
+    else
+    {
+        for(std::size_t rowBlock = 0; rowBlock < ROW; rowBlock += BLOCK_SIZE)
+        {
+            const std::size_t rowEnd = (rowBlock + BLOCK_SIZE < ROW) ? (rowBlock + BLOCK_SIZE) : ROW;
+
+            for(std::size_t innerBlock = 0; innerBlock < COLUMN; innerBlock += BLOCK_SIZE)
+            {
+                const std::size_t innerEnd = (innerBlock + BLOCK_SIZE < COLUMN) ? (innerBlock + BLOCK_SIZE) : COLUMN;
+
+                for(std::size_t columnBlock = 0; columnBlock < OTHER_COLUMN; columnBlock += BLOCK_SIZE)
+                {
+                    const std::size_t columnEnd = (columnBlock + BLOCK_SIZE < OTHER_COLUMN) ? (columnBlock + BLOCK_SIZE) : OTHER_COLUMN;
+
+                    // Multiply the tiles
+                    for(std::size_t row = rowBlock; row < rowEnd; ++row)
+                        for(std::size_t inner = innerBlock; inner < innerEnd; ++inner)
+                        {
+                            const DataType factor   = leftData[(row * COLUMN) + inner];
+                            const DataType* source  = rightData + (inner * OTHER_COLUMN);
+                            DataType* destination   = product + (row * OTHER_COLUMN);
+
+                            for(std::size_t column = columnBlock; column < columnEnd; ++column)
+                                destination[column] += factor * source[column];
+                        }
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief   Matrix multiplication
+ * @param   rightMatrix Right operand, its row count must be equal to the column count of this matrix
+ * @return  Product matrix
+ * @note    Allocates the product for heap stored matrices, see Multiply(..) to reuse an existing matrix.
+ */
+template<class DataType, std::size_t ROW, std::size_t COLUMN>
+template<std::size_t OTHER_COLUMN>
+Matrix<DataType, ROW, OTHER_COLUMN> Matrix<DataType, ROW, COLUMN>::operator*(const Matrix<DataType, COLUMN, OTHER_COLUMN>& rightMatrix) const
+{
+    Matrix<DataType, ROW, OTHER_COLUMN> result;
+
+    Multiply(result, *this, rightMatrix);
+
+    return result;
+}
+
+/**
+ * @brief   Transposes the matrix
+ * @return  Transposed matrix
+ * @note    Large matrices are transposed tile by tile, so that both sides are accessed in cache friendly blocks.
+ */
+template<class DataType, std::size_t ROW, std::size_t COLUMN>
+Matrix<DataType, COLUMN, ROW> Matrix<DataType, ROW, COLUMN>::Transpose() const
+{
+    Matrix<DataType, COLUMN, ROW> result;
+
+    const DataType* const data  = Data();
+    DataType* const transposed  = result.Data();
+
+    for(std::size_t rowBlock = 0; rowBlock < ROW; rowBlock += BLOCK_SIZE)
+    {
+        const std::size_t rowEnd = (rowBlock + BLOCK_SIZE < ROW) ? (rowBlock + BLOCK_SIZE) : ROW;
+
+        for(std::size_t columnBlock = 0; columnBlock < COLUMN; columnBlock += BLOCK_SIZE)
+        {
+            const std::size_t columnEnd = (columnBlock + BLOCK_SIZE < COLUMN) ? (columnBlock + BLOCK_SIZE) : COLUMN;
+
+            for(std::size_t row = rowBlock; row < rowEnd; ++row)
+                for(std::size_t column = columnBlock; column < columnEnd; ++column)
+                    transposed[(column * ROW) + row] = data[(row * COLUMN) + column];
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief   Comparison operator
+ * @param   rightMatrix Matrix to be compared against
+ * @return  true    If all elements are equal
+ */
+template<class DataType, std::size_t ROW, std::size_t COLUMN>
+bool Matrix<DataType, ROW, COLUMN>::operator==(const Matrix& rightMatrix) const noexcept
+{
+    // Vectorized for arithmetic types, operator== must have been overloaded for non-built-in types
+    return SimdKernels::equal(Data(), rightMatrix.Data(), SIZE);
+}
+
+/**
+ * @brief   Scaling with the factor on the left side
+ * @param   factor  Scaling factor
+ * @param   matrix  Matrix to be scaled
+ * @return  Scaled matrix
+ */
+template<class DataType, std::size_t ROW, std::size_t COLUMN>
+NODISCARD Matrix<DataType, ROW, COLUMN> operator*(const DataType& factor, const Matrix<DataType, ROW, COLUMN>& matrix)
+{
+    return matrix * factor;
+}
+
+/**
+ * @brief   Overloaded output insertion operator, prints one row per line
+ * @param   stream  Destination output stream
+ * @param   matrix  Matrix to be inserted
+ * @return  ostream reference to support cascaded insertions
+ */
+template<class DataType, std::size_t ROW, std::size_t COLUMN>
+std::ostream& operator<<(std::ostream& stream, const Matrix<DataType, ROW, COLUMN>& matrix)
+{
+    for(std::size_t row = 0; row < ROW; ++row)
+    {
+        for(const DataType& element : matrix[row])
+            stream << element << " ";
+
+        stream << '\n';
+    }
+
+    return stream;
+}
@@ -0,0 +1,282 @@
+/**
+ * @file        ParallelAlgorithms.h
+ * @details     Parallel algorithms for the contiguous containers(Vector, Array etc.).
+ *              Work is split into chunks and run on a work-stealing ThreadPool,
+ *              small inputs fall back to the sequential version of the algorithm.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *                               -> parallel_reduce(..) no longer needs a default constructible result type.
+ *
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include "ThreadPool.h"         // ThreadPool
+#include "VectorContainer.h"    // Vector
+#include <algorithm>            // std::sort, std::inplace_merge
+#include <cstddef>              // std::size_t
+#include <functional>           // std::plus, std::less
+#include <iterator>             // std::begin, std::end
+#include <optional>             // std::optional
+#include <stdexcept>            // std::invalid_argument
+#include <type_traits>          // std::remove_cv_t, std::remove_reference_t
+#include <utility>              // std::move
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Options ***/
+struct ParallelOptions {
+    std::size_t grainSize           = 0;        // Elements per task, 0 selects it by the number of workers
+    std::size_t sequentialCutoff    = 8192;     // Inputs smaller than this are processed by the calling thread
+    ThreadPool* pool                = nullptr;  // nullptr selects the global pool
+};
+
+namespace ParallelDetail {
+    template<class Container>
+    using ValueType = std::remove_cv_t<std::remove_reference_t<decltype(*std::begin(std::declval<Container&>()))>>;
+
+    NODISCARD inline ThreadPool& selectPool(const ParallelOptions& options) { return (nullptr != options.pool) ? *options.pool : ThreadPool::global(); }
+
+    // Sequential fallback is taken for small inputs and for pools without any parallelism
+    NODISCARD inline bool isSequential(std::size_t length, const ParallelOptions& options, const ThreadPool& pool)
+    {
+        return (length < options.sequentialCutoff) || (pool.size() < 2);
+    }
+
+    // Number of elements per chunk for the algorithms that keep a result per chunk
+    NODISCARD inline std::size_t chunkLength(std::size_t length, const ParallelOptions& options, const ThreadPool& pool)
+    {
+        if(0 != options.grainSize)
+            return options.grainSize;
+
+        const std::size_t chunkCount = pool.size() * 4;
+
+        return (length + chunkCount - 1) / chunkCount;
+    }
+}
+
+/**
+ * @brief   Calls the function for each element in parallel
+ * @param   container   Contiguous container
+ * @param   function    Callable object taking a reference to an element
+ * @param   options     Parallelization options
+ * @note    The function must be safe to be called concurrently for different elements.
+ */
+template<class Container, class Function>
+void parallel_for_each(Container& container, Function function, const ParallelOptions& options = ParallelOptions())
+{
+    auto first = std::begin(container);
+    const std::size_t length = std::size_t(std::end(container) - first);
+    ThreadPool& pool = ParallelDetail::selectPool(options);
+
+    if(ParallelDetail::isSequential(length, options, pool))
+    {
+        for(std::size_t index = 0; index < length; ++index)
+            function(first[index]);
+
+        return;
+    }
+
+    pool.parallel_for(0, length, options.grainSize, [&](std::size_t chunkBegin, std::size_t chunkEnd) {
+        for(std::size_t index = chunkBegin; index < chunkEnd; ++index)
+            function(first[index]);
+    });
+}
+
+/**
+ * @brief   Writes the result of the function for each source element into the destination in parallel
+ * @param   source      Contiguous source container
+ * @param   destination Contiguous destination container, at least as large as the source
+ * @param   function    Callable object taking a const reference to a source element
+ * @param   options     Parallelization options
+ * @throws  std::invalid_argument   If the destination is smaller than the source
+ * @note    Source and destination may be the same container.
+ */
+template<class SourceContainer, class DestinationContainer, class Function>
+void parallel_transform(const SourceContainer& source, DestinationContainer& destination, Function function, const ParallelOptions& options = ParallelOptions())
+{
+    auto sourceFirst        = std::begin(source);
+    auto destinationFirst   = std::begin(destination);
+    const std::size_t length = std::size_t(std::end(source) - sourceFirst);
+
+    if(std::size_t(std::end(destination) - destinationFirst) < length)
+        throw std::invalid_argument("Destination is smaller than the source!");
+
+    ThreadPool& pool = ParallelDetail::selectPool(options);
+
+    if(ParallelDetail::isSequential(length, options, pool))
+    {
+        for(std::size_t index = 0; index < length; ++index)
+            destinationFirst[index] = function(sourceFirst[index]);
+
+        return;
+    }
+
+    pool.parallel_for(0, length, options.grainSize, [&](std::size_t chunkBegin, std::size_t chunkEnd) {
+        for(std::size_t index = chunkBegin; index < chunkEnd; ++index)
+            destinationFirst[index] = function(sourceFirst[index]);
+    });
+}
+
+/**
+ * @brief   Reduces the elements in parallel
+ * @param   container   Contiguous container
+ * @param   init        Initial value, it is combined only once
+ * @param   operation   Associative binary operation
+ * @param   options     Parallelization options
+ * @return  Result of the reduction
+ * @note    Partial results are combined in the order of the chunks, the operation does not need to be commutative.
+ * @note    T must be constructible from an element, each chunk is seeded with its first element.
+ */
+template<class Container, class T, class BinaryOperation = std::plus<>>
+NODISCARD T parallel_reduce(const Container& container, T init, BinaryOperation operation = BinaryOperation(), const ParallelOptions& options = ParallelOptions())
+{
+    auto first = std::begin(container);
+    const std::size_t length = std::size_t(std::end(container) - first);
+    ThreadPool& pool = ParallelDetail::selectPool(options);
+
+    if(ParallelDetail::isSequential(length, options, pool))
+    {
+        for(std::size_t index = 0; index < length; ++index)
+            init = operation(std::move(init), first[index]);
+
+        return init;
+    }
+
+    const std::size_t chunkLength   = ParallelDetail::chunkLength(length, options, pool);
+    const std::size_t chunkCount    = (length + chunkLength - 1) / chunkLength;
+    Vector<std::optional<T>> partialResults(chunkCount);    // T is not required to be default constructible
+
+    // Each chunk starts with its first element, so that no identity value is needed
+    pool.parallel_for(0, chunkCount, 1, [&](std::size_t chunkBegin, std::size_t chunkEnd) {
+        for(std::size_t chunkIndex = chunkBegin; chunkIndex < chunkEnd; ++chunkIndex)
+        {
+            const std::size_t elementBegin  = chunkIndex * chunkLength;
+            const std::size_t elementEnd    = (elementBegin + chunkLength < length) ? (elementBegin + chunkLength) : length;
+            T partial(first[elementBegin]);
+
+            for(std::size_t index = elementBegin + 1; index < elementEnd; ++index)
+                partial = operation(std::move(partial), first[index]);
+
+            partialResults[chunkIndex].emplace(std::move(partial));
+        }
+    });
+
+    for(std::optional<T>& partial : partialResults)
+        init = operation(std::move(init), std::move(*partial));
+
+    return init;
+}
+
+/**
+ * @brief   Copies the elements satisfying the predicate in parallel
+ * @param   container   Contiguous container
+ * @param   predicate   Callable object taking a const reference to an element
+ * @param   options     Parallelization options
+ * @return  Vector of the matching elements, in their original order
+ */
+template<class Container, class Predicate>
+NODISCARD Vector<ParallelDetail::ValueType<const Container>> parallel_filter(const Container& container, Predicate predicate, const ParallelOptions& options = ParallelOptions())
+{
+    using T = ParallelDetail::ValueType<const Container>;
+
+    auto first = std::begin(container);
+    const std::size_t length = std::size_t(std::end(container) - first);
+    ThreadPool& pool = ParallelDetail::selectPool(options);
+    Vector<T> result;
+
+    if(ParallelDetail::isSequential(length, options, pool))
+    {
+        for(std::size_t index = 0; index < length; ++index)
+            if(predicate(first[index]))
+                result.push_back(first[index]);
+
+        return result;
+    }
+
+    const std::size_t chunkLength   = ParallelDetail::chunkLength(length, options, pool);
+    const std::size_t chunkCount    = (length + chunkLength - 1) / chunkLength;
+    Vector<Vector<T>> chunkResults(chunkCount);
+
+    pool.parallel_for(0, chunkCount, 1, [&](std::size_t chunkBegin, std::size_t chunkEnd) {
+        for(std::size_t chunkIndex = chunkBegin; chunkIndex < chunkEnd; ++chunkIndex)
+        {
+            const std::size_t elementBegin  = chunkIndex * chunkLength;
+            const std::size_t elementEnd    = (elementBegin + chunkLength < length) ? (elementBegin + chunkLength) : length;
+
+            for(std::size_t index = elementBegin; index < elementEnd; ++index)
+                if(predicate(first[index]))
+                    chunkResults[chunkIndex].push_back(first[index]);
+        }
+    });
+
+    // Concatenate the chunk results with a single allocation
+    std::size_t totalLength = 0;
+    for(const Vector<T>& chunkResult : chunkResults)
+        totalLength += chunkResult.size();
+
+    result.reserve(totalLength);
+    for(const Vector<T>& chunkResult : chunkResults)
+        result.append(chunkResult.begin(), chunkResult.end());
+
+    return result;
+}
+
+/**
+ * @brief   Sorts the elements in parallel
+ * @param   container   Contiguous container
+ * @param   compare     Strict weak ordering
+ * @param   options     Parallelization options
+ * @note    Chunks are sorted in parallel, then merged pairwise level by level. The sort is not stable.
+ */
+template<class Container, class Compare = std::less<>>
+void parallel_sort(Container& container, Compare compare = Compare(), const ParallelOptions& options = ParallelOptions())
+{
+    auto first = std::begin(container);
+    const std::size_t length = std::size_t(std::end(container) - first);
+    ThreadPool& pool = ParallelDetail::selectPool(options);
+
+    if(ParallelDetail::isSequential(length, options, pool))
+        return std::sort(first, first + length, compare);
+
+    const std::size_t chunkLength   = ParallelDetail::chunkLength(length, options, pool);
+    const std::size_t chunkCount    = (length + chunkLength - 1) / chunkLength;
+
+    pool.parallel_for(0, chunkCount, 1, [&](std::size_t chunkBegin, std::size_t chunkEnd) {
+        for(std::size_t chunkIndex = chunkBegin; chunkIndex < chunkEnd; ++chunkIndex)
+        {
+            const std::size_t elementBegin  = chunkIndex * chunkLength;
+            const std::size_t elementEnd    = (elementBegin + chunkLength < length) ? (elementBegin + chunkLength) : length;
+
+            std::sort(first + elementBegin, first + elementEnd, compare);
+        }
+    });
+
+    // Merge sorted runs of doubling width, the merges of a level are independent of each other
+    for(std::size_t runLength = chunkLength; runLength < length; runLength *= 2)
+    {
+        const std::size_t pairCount = (length + (2 * runLength) - 1) / (2 * runLength);
+
+        pool.parallel_for(0, pairCount, 1, [&](std::size_t pairBegin, std::size_t pairEnd) {
+            for(std::size_t pairIndex = pairBegin; pairIndex < pairEnd; ++pairIndex)
+            {
+                const std::size_t leftBegin = pairIndex * 2 * runLength;
+                const std::size_t middle    = leftBegin + runLength;
+                const std::size_t rightEnd  = (middle + runLength < length) ? (middle + runLength) : length;
+
+                if(middle < rightEnd)
+                    std::inplace_merge(first + leftBegin, first + middle, first + rightEnd, compare);
+            }
+        });
+    }
+}
@@ -0,0 +1,216 @@
+/**
+ * @file        PoolAllocator.h
+ * @details     A node pool allocator for node based containers.
+ *              Single element allocations are served from contiguous blocks and recycled through a free list.
+ *              Blocks are returned to the global heap only when the last allocator sharing the pool is destroyed.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstddef>              // std::size_t
+#include <memory>               // std::shared_ptr, std::allocator
+#include <new>                  // operator new, std::align_val_t
+#include <type_traits>          // std::true_type
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Pool Resource ***/
+/* Type erased slab of equally sized slots, shared by all rebound copies of a pool allocator.
+ * The slot size is fixed by the first allocation, bigger or stricter aligned requests are forwarded to the global heap.
+ * A pool is not thread safe, it shall be used by a single thread at a time. */
+class NodePool {
+public:
+    explicit NodePool(std::size_t nodesPerBlock) noexcept : nodesPerBlock((0 == nodesPerBlock) ? 1 : nodesPerBlock) { }
+    ~NodePool();
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    NODISCARD void* allocate(std::size_t size, std::size_t alignment);
+    void deallocate(void* ptr, std::size_t size, std::size_t alignment) noexcept;
+
+    NODISCARD std::size_t blockCount() const noexcept { return numberOfBlocks; }  // Number of blocks taken from the global heap
+
+private:
+    struct FreeSlot     { FreeSlot* next;       };
+    struct BlockHeader  { BlockHeader* next;    };
+
+    NODISCARD bool isPooled(std::size_t size, std::size_t alignment) const noexcept { return (size <= slotSize) && (alignment <= slotAlignment); }
+    void allocateBlock();
+
+    const std::size_t nodesPerBlock;
+    std::size_t slotSize        = 0;        // Fixed by the first allocation
+    std::size_t slotAlignment   = 0;        // Fixed by the first allocation
+    std::size_t numberOfBlocks  = 0;
+    FreeSlot* freeList          = nullptr;  // Recycled slots
+    BlockHeader* blocks         = nullptr;  // All blocks, the newest one is the first
+    unsigned char* nextSlot     = nullptr;  // Unused slots of the newest block are carved lazily
+    unsigned char* blockEnd     = nullptr;
+};
+
+/**
+ * @brief   Returns all blocks to the global heap
+ * @note    Elements allocated from the pool must already have been destroyed.
+ */
+inline NodePool::~NodePool()
+{
+    while(nullptr != blocks)
+    {
+        BlockHeader* next = blocks->next;
+
+        ::operator delete(static_cast<void*>(blocks), std::align_val_t(slotAlignment));
+        blocks = next;
+    }
+}
+
+/**
+ * @brief   Allocates a slot from the pool
+ * @param   size        Size of the requested space in bytes
+ * @param   alignment   Alignment of the requested space
+ * @return  Address of an uninitialized space
+ * @throws  std::bad_alloc  If a new block cannot be allocated
+ */
+inline void* NodePool::allocate(std::size_t size, std::size_t alignment)
+{
+    if(0 == slotSize)   // The first allocation determines the slot layout
+    {
+        slotAlignment   = (alignment < alignof(FreeSlot)) ? alignof(FreeSlot) : alignment;
+        slotSize        = (size < sizeof(FreeSlot)) ? sizeof(FreeSlot) : size;
+        slotSize        = ((slotSize + slotAlignment - 1) / slotAlignment) * slotAlignment;
+    }
+
+    if(!isPooled(size, alignment))
+        return ::operator new(size, std::align_val_t(alignment));
+
+    if(nullptr != freeList) // Recycle a released slot first
+    {
+        FreeSlot* slot  = freeList;
+        freeList        = slot->next;
+
+        return static_cast<void*>(slot);
+    }
+
+    if(nextSlot == blockEnd)
+        allocateBlock();
+
+    void* slot  = static_cast<void*>(nextSlot);
+    nextSlot   += slotSize;
+
+    return slot;
+}
+
+/**
+ * @brief   Releases a slot back to the pool
+ * @param   ptr         Address returned by allocate(..)
+ * @param   size        Size given to allocate(..)
+ * @param   alignment   Alignment given to allocate(..)
+ * @note    Pooled slots are kept in the free list, they are not returned to the global heap.
+ */
+inline void NodePool::deallocate(void* ptr, std::size_t size, std::size_t alignment) noexcept
+{
+    if(nullptr == ptr)
+        return;
+
+    if(!isPooled(size, alignment))
+        return ::operator delete(ptr, std::align_val_t(alignment));
+
+    FreeSlot* slot  = ::new(ptr) FreeSlot{freeList};
+    freeList        = slot;
+}
+
+/**
+ * @brief   Allocates a new block and makes its slots available for allocation
+ * @throws  std::bad_alloc  If the block cannot be allocated
+ */
+inline void NodePool::allocateBlock()
+{
+    // Slots start after the header, at an aligned offset
+    const std::size_t headerSize = ((sizeof(BlockHeader) + slotAlignment - 1) / slotAlignment) * slotAlignment;
+    unsigned char* block = static_cast<unsigned char*>(::operator new(headerSize + (nodesPerBlock * slotSize), std::align_val_t(slotAlignment)));
+
+    blocks      = ::new(static_cast<void*>(block)) BlockHeader{blocks};
+    nextSlot    = block + headerSize;
+    blockEnd    = nextSlot + (nodesPerBlock * slotSize);
+
+    ++numberOfBlocks;
+}
+
+/*** Allocator Class ***/
+/* Copies and rebound copies share the same pool, and compare equal.
+ * Default constructed allocators create their own pools, and compare unequal. */
+template<class T, std::size_t NODES_PER_BLOCK = 64>
+class PoolAllocator {
+    template<class U, std::size_t N> friend class PoolAllocator;
+
+public:
+    using value_type = T;
+
+    // Pool is shared with the container it serves
+    using propagate_on_container_copy_assignment    = std::true_type;
+    using propagate_on_container_move_assignment    = std::true_type;
+    using propagate_on_container_swap               = std::true_type;
+
+    // Rebinding must be explicit because of the non-type template parameter
+    template<class U>
+    struct rebind { using other = PoolAllocator<U, NODES_PER_BLOCK>; };
+
+    PoolAllocator() : pool(std::make_shared<NodePool>(NODES_PER_BLOCK)) { }
+
+    // Declared explicitly so that moved-from allocators keep sharing the pool
+    PoolAllocator(const PoolAllocator& other) noexcept = default;
+    PoolAllocator& operator=(const PoolAllocator& other) noexcept = default;
+
+    template<class U>
+    PoolAllocator(const PoolAllocator<U, NODES_PER_BLOCK>& other) noexcept : pool(other.pool) { }
+
+    /**
+     * @brief   Allocates space for given number of elements
+     * @param   n   Number of elements
+     * @return  Address of the uninitialized space
+     * @note    Only single element allocations are served by the pool.
+     */
+    NODISCARD T* allocate(std::size_t n)
+    {
+        if(1 == n)
+            return static_cast<T*>(pool->allocate(sizeof(T), alignof(T)));
+
+        return std::allocator<T>().allocate(n);
+    }
+
+    /**
+     * @brief   Releases the space allocated by allocate(..)
+     * @param   ptr Address of the space
+     * @param   n   Number of elements given to allocate(..)
+     */
+    void deallocate(T* ptr, std::size_t n) noexcept
+    {
+        if(1 == n)
+            return pool->deallocate(static_cast<void*>(ptr), sizeof(T), alignof(T));
+
+        std::allocator<T>().deallocate(ptr, n);
+    }
+
+    NODISCARD const NodePool& get_pool() const noexcept { return *pool; }
+
+    template<class U>
+    NODISCARD bool operator==(const PoolAllocator<U, NODES_PER_BLOCK>& other) const noexcept { return (pool == other.pool); }
+
+    template<class U>
+    NODISCARD bool operator!=(const PoolAllocator<U, NODES_PER_BLOCK>& other) const noexcept { return (pool != other.pool); }
+
+private:
+    std::shared_ptr<NodePool> pool;
+};
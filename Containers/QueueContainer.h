@@ -15,6 +15,17 @@
  *                                  -> Constructors simplified using the default member initialization.
  *                                  -> select_on_container_copy_construction(..) added to copy constructor.
  *                                  -> lvalue return type added to modifier functions to supoort cascaded calls.
+ *              October 14, 2026    -> Consumed chunks are kept in a spare chunk cache and reused as new back chunks.
+ *                                  -> Chunk pointer array is reallocated only when its capacity is exceeded.
+ *                                  -> Element traversal unified, destruction and assignment of multi-chunk queues fixed.
+ *                                  -> Chunk pointer array turned into a circular buffer with geometric growth.
+ *                                  -> push_range(..), pop_n(..) and segment view added for bulk transfers.
+ *                                  -> Random access iterators and find/count/contains added.
+ *                                  -> Opt-in chunk allocation and copy/move statistics added, see ContainerStats.h.
+ *                                  -> Allocator propagation traits honoured by copy assignment and swap.
+ *                                  -> Front and back chunk pointers cached, push and pop no longer look up the chunk map.
+ *                                  -> Move assignment operator added.
+ *                                  -> Iterators point into the chunks like the ones of std::deque, stepping does not divide.
  * @note        Feel free to contact for questions, bugs or any other thing.
  * @copyright   No copyright.
  */
@@ -23,10 +34,16 @@
 #pragma once
 
 /*** Libraries ***/
+#include "SimdKernels.h"    // SimdKernels::equal, SimdKernels::find, SimdKernels::count
+#include "ContainerStats.h" // CONTAINER_STATS_RECORD, ContainerStats::Snapshot
 #include <memory>       // std::allocator, std::allocator_traits
 #include <cstring>      // std::memcpy
-#include <algorithm>    // std::swap
+#include <algorithm>    // std::swap, std::min
 #include <cstddef>      // std::size_t
+#include <stdexcept>    // std::logic_error, std::runtime_error
+#include <utility>      // std::move, std::forward
+#include <iterator>     // std::forward_iterator_tag, std::random_access_iterator_tag
+#include <type_traits>  // std::is_trivially_copyable_v
 
 /*** Special definitions ***/
 // If the C++ version is greater or equal to 2017xx
@@ -42,15 +59,25 @@
 #endif  // C++17 check
 
 /*** Container Class ***/
-template<class T, std::size_t C_SIZE = 128, class Allocator = std::allocator<T>>
+/* Elements are stored in chunks of C_SIZE elements.
+ * Chunk pointers are kept in a circular map whose capacity is doubled when it is full,
+ * so that both adding and retiring chunks are amortized constant time.
+ * Up to SPARE_CHUNKS consumed chunks are kept to be reused as new back chunks,
+ * so that a queue with a stable depth does not allocate at all. */
+template<class T, std::size_t C_SIZE = 128, class Allocator = std::allocator<T>, std::size_t SPARE_CHUNKS = 1>
 class Queue{
+    static_assert(C_SIZE != 0, "Chunk size cannot be 0!");
+
+    template<bool IS_CONST>
+    class basic_iterator;
+
 public:
     /*** C++ Standard Named Requirements for Containers ***/
     using value_type        = T;
     using reference         = T&;
     using const_reference   = const T&;
-    using iterator          = T*;
-    using const_iterator    = const T*;
+    using iterator          = basic_iterator<false>;
+    using const_iterator    = basic_iterator<true>;
     using pointer           = typename std::allocator_traits<Allocator>::pointer;
     using const_pointer     = typename std::allocator_traits<Allocator>::const_pointer;
     using difference_type   = typename std::allocator_traits<Allocator>::difference_type;
@@ -58,6 +85,160 @@ public:
     using allocator_type    = Allocator;
     using ch_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<pointer>;
 
+    /*** Segment View ***/
+    // Contiguous span of elements inside a single chunk
+    struct segment {
+        const_pointer   data;
+        size_type       length;
+
+        NODISCARD const_pointer begin() const { return data;          }
+        NODISCARD const_pointer end()   const { return data + length; }
+    };
+
+    // Iterable view of the segments from the front chunk to the back chunk, invalidated by any modifier
+    class segment_view {
+    public:
+        class const_iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = segment;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = const segment*;
+            using reference         = segment;
+
+            const_iterator(const Queue& queue, size_type index) : queue(&queue), index(index) { }
+
+            NODISCARD segment operator*() const { return queue->segmentAt(index); }
+            const_iterator& operator++()        { ++index; return *this; }
+            const_iterator  operator++(int)     { const_iterator previous = *this; ++index; return previous; }
+
+            NODISCARD bool operator==(const const_iterator& other) const { return (index == other.index); }
+            NODISCARD bool operator!=(const const_iterator& other) const { return (index != other.index); }
+
+        private:
+            const Queue*    queue;
+            size_type       index;  // Position of the chunk from the front
+        };
+
+        explicit segment_view(const Queue& queue) : queue(queue) { }
+
+        NODISCARD const_iterator begin() const { return const_iterator(queue, 0);                       }
+        NODISCARD const_iterator end()   const { return const_iterator(queue, queue.segmentCount());    }
+        NODISCARD size_type      size()  const { return queue.segmentCount();                           }
+
+    private:
+        const Queue& queue;
+    };
+
+private:
+    /* Random access iterator pointing into a chunk like the one of std::deque, invalidated by any modifier.
+     * Stepping only moves the element pointer, the chunk map is visited at the chunk boundaries.
+     * The end of a full back chunk is the end of the queue, no chunk is visited after the back one. */
+    template<bool IS_CONST>
+    class basic_iterator {
+        friend class Queue;
+        friend class basic_iterator<!IS_CONST>;
+
+        using QueuePtr = std::conditional_t<IS_CONST, const Queue*, Queue*>;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::conditional_t<IS_CONST, const T*, T*>;
+        using reference         = std::conditional_t<IS_CONST, const T&, T&>;
+
+        basic_iterator() = default;
+
+        // Conversion from iterator to const_iterator
+        template<bool OTHER_CONST, class = std::enable_if_t<IS_CONST && !OTHER_CONST>>
+        basic_iterator(const basic_iterator<OTHER_CONST>& other)
+        : queue(other.queue), current(other.current), chunkEnd(other.chunkEnd), chunkIdx(other.chunkIdx) { }
+
+        NODISCARD reference operator*()  const { return *current; }
+        NODISCARD pointer   operator->() const { return current;  }
+        NODISCARD reference operator[](difference_type offset) const { return *(*this + offset); }
+
+        basic_iterator& operator++()
+        {
+            if((++current == chunkEnd) && (chunkPosition() + 1 < queue->numOfChunks))
+                enterChunk(chunkIdx + 1, 0);
+
+            return *this;
+        }
+
+        basic_iterator& operator--()
+        {
+            if(current == chunkEnd - C_SIZE)    // First element of the chunk
+                enterChunk(chunkIdx - 1, C_SIZE);
+
+            --current;
+
+            return *this;
+        }
+
+        basic_iterator  operator++(int) { basic_iterator previous = *this; ++(*this); return previous; }
+        basic_iterator  operator--(int) { basic_iterator previous = *this; --(*this); return previous; }
+
+        basic_iterator& operator+=(difference_type offset) { return (*this = basic_iterator(queue, size_type(difference_type(position()) + offset))); }
+        basic_iterator& operator-=(difference_type offset) { return (*this = basic_iterator(queue, size_type(difference_type(position()) - offset))); }
+
+        NODISCARD basic_iterator operator+(difference_type offset) const { basic_iterator result = *this; return result += offset; }
+        NODISCARD basic_iterator operator-(difference_type offset) const { basic_iterator result = *this; return result -= offset; }
+        NODISCARD friend basic_iterator operator+(difference_type offset, const basic_iterator& it) { return it + offset; }
+        NODISCARD difference_type operator-(const basic_iterator& other) const { return difference_type(position()) - difference_type(other.position()); }
+
+        NODISCARD bool operator==(const basic_iterator& other) const { return (current == other.current); }
+        NODISCARD bool operator!=(const basic_iterator& other) const { return (current != other.current); }
+        NODISCARD bool operator< (const basic_iterator& other) const { return (position() <  other.position()); }
+        NODISCARD bool operator> (const basic_iterator& other) const { return (position() >  other.position()); }
+        NODISCARD bool operator<=(const basic_iterator& other) const { return (position() <= other.position()); }
+        NODISCARD bool operator>=(const basic_iterator& other) const { return (position() >= other.position()); }
+
+    private:
+        // Iterator to the element at the given distance from the front, the only place dividing by the chunk size
+        basic_iterator(QueuePtr queue, size_type position) : queue(queue)
+        {
+            if(0 == queue->numOfChunks) // No element can be pointed
+                return;
+
+            const size_type offset  = queue->frontIdx + position;
+            size_type chunkPos      = offset / C_SIZE;
+            size_type index         = offset % C_SIZE;
+
+            if(chunkPos == queue->numOfChunks)  // End of a full back chunk
+            {
+                --chunkPos;
+                index = C_SIZE;
+            }
+
+            enterChunk(queue->firstChunkIdx + chunkPos, index);
+        }
+
+        // Points to the given index of the chunk at the given index of the chunk map, wrapped around
+        void enterChunk(size_type mapIdx, size_type index)
+        {
+            chunkIdx    = mapIdx & (queue->chunksCapacity - 1);
+            chunkEnd    = queue->chunks[chunkIdx] + C_SIZE;
+            current     = chunkEnd - C_SIZE + index;
+        }
+
+        NODISCARD size_type chunkPosition() const { return (chunkIdx - queue->firstChunkIdx) & (queue->chunksCapacity - 1); }    // Chunk distance from the front chunk
+        NODISCARD size_type position() const        // Element distance from the front element
+        {
+            if(nullptr == current)
+                return 0;
+
+            return (chunkPosition() * C_SIZE) + size_type(current - (chunkEnd - C_SIZE)) - queue->frontIdx;
+        }
+
+        QueuePtr    queue       = nullptr;
+        pointer     current     = nullptr;  // Pointed element
+        pointer     chunkEnd    = nullptr;  // Past the last element of the pointed chunk
+        size_type   chunkIdx    = 0;        // Index of the pointed chunk in the chunk map
+    };
+
+public:
     /*** Constructors and Destructor ***/
     // Default constructor
     Queue() = default;
@@ -80,6 +261,20 @@ public:
     NODISCARD const_reference back() const;
     NODISCARD reference       back();
 
+    /*** Iterators ***/
+    NODISCARD iterator       begin()        { return iterator(this, 0);        }
+    NODISCARD iterator       end()          { return iterator(this, sz);       }
+    NODISCARD const_iterator begin()  const { return const_iterator(this, 0);  }
+    NODISCARD const_iterator end()    const { return const_iterator(this, sz); }
+    NODISCARD const_iterator cbegin() const { return begin();                  }
+    NODISCARD const_iterator cend()   const { return end();                    }
+
+    /*** Lookup ***/
+    NODISCARD const_iterator find(const value_type& value) const;
+    NODISCARD iterator       find(const value_type& value);
+    NODISCARD size_type      count(const value_type& value) const;
+    NODISCARD bool           contains(const value_type& value) const { return (find(value) != end()); }
+
     /*** Modifiers ***/
     template <class... Args>
     Queue& emplace(Args&&... args);
@@ -89,12 +284,30 @@ public:
     Queue& swap(Queue& swapQ) noexcept;
     Queue& flush();
 
+    template<class InputIterator>
+    Queue& push_range(InputIterator first, InputIterator last);
+
+    size_type pop_n(size_type count);
+    template<class OutputIterator>
+    size_type pop_n(size_type count, OutputIterator destination);
+
+    /*** Segment Access ***/
+    NODISCARD segment_view segments() const { return segment_view(*this); }
+
     /*** Status Checkers ***/
     NODISCARD bool        empty() const { return (0 == sz); }
     NODISCARD size_type   size()  const { return sz;        }
+    NODISCARD size_type   spare_chunks() const { return numOfSpareChunks; }    // Number of cached empty chunks
+
+    /*** Memory Management ***/
+    Queue& release_spare_chunks();  // Returns the cached empty chunks to the allocator
+
+    /*** Statistics ***/
+    NODISCARD static ContainerStats::Snapshot stats() noexcept { return ContainerStats::snapshotOf<Queue>(); }   // Zeros unless enabled
 
     /*** Operators ***/
     Queue& operator=(const Queue& rightQ);
+    Queue& operator=(Queue&& rightQ) noexcept(isStealingAlwaysPossible());
     NODISCARD bool operator==(const Queue& rightQ) const;
     NODISCARD bool operator!=(const Queue& rightQ) const;
 
@@ -104,28 +317,52 @@ private:
     size_type       frontIdx        = 0;    // Front index in the front chunk (index of the oldest element)
     size_type       nextBackIdx     = 0;    // Back index in the back chunk (index 'after' the last added element)
     size_type       numOfChunks     = 0;    // Number of chunks (0 is the front)
-    pointer*        chunks          = nullptr;          // Pointers of discrete chunks
+    size_type       firstChunkIdx   = 0;    // Index of the front chunk in the circular chunk map
+    size_type       chunksCapacity  = 0;    // Capacity of the chunk map, always 0 or a power of 2
+    pointer*        chunks          = nullptr;          // Circular map of discrete chunks
+    pointer         frontChunkPtr   = nullptr;          // Cached front chunk, null if there is no chunk
+    pointer         backChunkPtr    = nullptr;          // Cached back chunk, null if there is no chunk
+    size_type       numOfSpareChunks = 0;   // Number of cached empty chunks
+    pointer         spareChunks[(0 == SPARE_CHUNKS) ? 1 : SPARE_CHUNKS] = {};  // Cached empty chunks
     NO_UNIQUE_ADDR  Allocator           allocator;      // Allocator policy for storing the data
     NO_UNIQUE_ADDR  ch_allocator_type   chAllocator;    // Rebinded allocator policy for storing pointers
 
+    static constexpr size_type MIN_CHUNK_MAP_CAPACITY = 8;
+
     /*** Helper Functions ***/
-    NODISCARD const_pointer backChunk()  const;
-    NODISCARD const_pointer frontChunk() const;
-    NODISCARD pointer backChunk();
-    NODISCARD pointer frontChunk();
+    // Chunks of an rvalue can always be taken over if the allocator follows them or cannot differ
+    NODISCARD static constexpr bool isStealingAlwaysPossible() noexcept
+    {
+        return std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value ||
+               std::allocator_traits<Allocator>::is_always_equal::value;
+    }
+
+    NODISCARD const pointer& chunkAt(size_type chunkPosition) const { return chunks[(firstChunkIdx + chunkPosition) & (chunksCapacity - 1)]; }
+    NODISCARD pointer&       chunkAt(size_type chunkPosition)       { return chunks[(firstChunkIdx + chunkPosition) & (chunksCapacity - 1)]; }
     NODISCARD bool isFrontChunkConsumed() const { return (C_SIZE == frontIdx); }
-    NODISCARD bool isNewChunkNeeded()     const { return ((C_SIZE == nextBackIdx) || (0 == numOfChunks)); }
+    NODISCARD bool isNewChunkNeeded()     const { return ((C_SIZE == nextBackIdx) || (nullptr == backChunkPtr)); }
+    NODISCARD const_reference elementAt(size_type position) const;    // Element access by the distance from the front
+    NODISCARD reference       elementAt(size_type position);          // Element access by the distance from the front
     void createNewChunk();
     void removeFrontChunk();
+    void growChunkMap(size_type minCapacity);
+    NODISCARD pointer acquireChunk();       // Takes a spare chunk or allocates a new one
+    void releaseChunk(pointer chunk);       // Caches the chunk as spare or deallocates it
+    void destroyAll();                      // Destroys all elements and releases all chunks
+    void swapContent(Queue& swapQ) noexcept;    // Swaps all members except the allocators
+    void consumeFront(size_type count);     // Advances the front after the elements are destroyed
+    NODISCARD size_type segmentCount() const { return (0 == sz) ? 0 : (((frontIdx + sz - 1) / C_SIZE) + 1); }
+    NODISCARD segment   segmentAt(size_type chunkPosition) const;
+    NODISCARD segment   spanAt(size_type position) const;   // Elements from the given position to the end of its chunk
 };
 
 /**
  * @brief Allocator constructor
  * @param alloc Allocator object
  */
-template<class T, std::size_t C_SIZE, class Allocator>
-Queue<T, C_SIZE, Allocator>::Queue(const Allocator& alloc)
-    : allocator(std::allocator_traits<allocator_type>::select_on_container_copy_construction(alloc))
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::Queue(const Allocator& alloc)
+    : allocator(alloc), chAllocator(alloc)
 { /* No operation */ }
 
 /**
@@ -134,55 +371,22 @@ Queue<T, C_SIZE, Allocator>::Queue(const Allocator& alloc)
  * @throws  std::logic_error    If the source queue was in an inconsistent state.
  * @throws  std::runtime_error  If the allocator fails to allocate chunks
  */
-template<class T, std::size_t C_SIZE, class Allocator>
-Queue<T, C_SIZE, Allocator>::Queue(const Queue& copyQ)
-    : allocator(std::allocator_traits<allocator_type>::select_on_container_copy_construction(copyQ.allocator))
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::Queue(const Queue& copyQ)
+    : allocator(std::allocator_traits<allocator_type>::select_on_container_copy_construction(copyQ.allocator)), chAllocator(allocator)
 {
-    // Check if the source Queue is empty
-    if(!copyQ.empty())
-    {
-        if((0 == copyQ.numOfChunks) || (nullptr == copyQ.chunks))
-            throw std::logic_error("Source Queue is corrupted!");
-
-        // Allocate space for chunk pointers
-        numOfChunks = ((copyQ.sz-1) / C_SIZE) + 1;
-        chunks      = std::allocator_traits<ch_allocator_type>::allocate(chAllocator, numOfChunks);
-
-        if(nullptr == chunks)
-            throw std::runtime_error("Cannot allocate chunks array!");
-
-        // Allocate space for chunks without constructing the objects
-        for(size_type idx = 0; idx < numOfChunks; ++idx)
-        {
-            chunks[idx] = std::allocator_traits<Allocator>::allocate(allocator, C_SIZE);
-
-            if(nullptr == chunks[idx])
-                throw std::runtime_error("Cannot allocate chunks!");
-        }
-
-        // Copy construct objects
-        size_type sourceChunk = 0, destChunk = 0;
-        size_type sourceElemIdx = copyQ.frontIdx, destElemIdx = 0;
-        for( ; sz < copyQ.sz; ++sz)
-        {
-            std::allocator_traits<Allocator>::construct(allocator, chunks[destChunk] + destElemIdx++, copyQ.chunks[sourceChunk][sourceElemIdx++]);
-
-            if(C_SIZE == sourceElemIdx)     // Skip to the next chunk of source?
-            {
-                sourceElemIdx = 0;
-                ++sourceChunk;
-            }
-
-            if(C_SIZE == destElemIdx)       // Skip to the next chunk of destination?
-            {
-                destElemIdx = 0;
-                ++destChunk;
-            }
-        }
-
-        // Adjust indexes
-        nextBackIdx     = destElemIdx;
-        frontIdx        = 0;
+    if(!copyQ.empty() && ((0 == copyQ.numOfChunks) || (nullptr == copyQ.chunks)))
+        throw std::logic_error("Source Queue is corrupted!");
+
+    try {
+        // Copy chunk by chunk
+        for(const segment sourceSegment : copyQ.segments())
+            push_range(sourceSegment.begin(), sourceSegment.end());
+    }catch(...){
+        destroyAll();
+        release_spare_chunks();
+
+        throw;  // Propagate exception
     }
 }
 
@@ -190,53 +394,22 @@ Queue<T, C_SIZE, Allocator>::Queue(const Queue& copyQ)
  * @brief Move constructor
  * @param moveQ     Source queue for stealing resources
  */
-template<class T, std::size_t C_SIZE, class Allocator>
-Queue<T, C_SIZE, Allocator>::Queue(Queue&& moveQ) noexcept
-    : allocator(std::move(moveQ.allocator))
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::Queue(Queue&& moveQ) noexcept
+    : allocator(moveQ.allocator), chAllocator(moveQ.chAllocator)
 {
-    // Swap all members
-    swap(moveQ);
+    // Swap all members except the allocators, the source keeps a copy of its allocators
+    swapContent(moveQ);
 }
 
 /**
  * @brief Destructor
  */
-template<class T, std::size_t C_SIZE, class Allocator>
-Queue<T, C_SIZE, Allocator>::~Queue()
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::~Queue()
 {
-    if(!empty())
-    {
-        if(1 == numOfChunks)    // Is front chunk and back chunk is the same?
-        {
-            // Destroy each element at that single chunk
-            for(size_type idx = frontIdx; idx < nextBackIdx; ++idx)
-                std::allocator_traits<Allocator>::destroy(allocator, frontChunk() + idx);
-        }
-        else if(1 < numOfChunks)
-        {
-            // Destroy each element at the front chunk
-            for(; frontIdx < C_SIZE; ++frontIdx)  // Traverse elements
-                std::allocator_traits<Allocator>::destroy(allocator, frontChunk() + frontIdx);
-
-            // Destroy all elements of other chunks except the back one
-            for(size_type chunkIdx = 1; chunkIdx < (numOfChunks - 2); ++chunkIdx)    // Traverse chunks
-            {
-                for(size_type elemIdx = 0; elemIdx < C_SIZE; ++elemIdx)   // Traverse elements
-                    std::allocator_traits<Allocator>::destroy(allocator, chunks[chunkIdx] + elemIdx);
-            }
-
-            // Destroy each element at back chunk
-            for(size_type elemIdx = 0; elemIdx < nextBackIdx; ++elemIdx)   // Traverse elements
-                std::allocator_traits<Allocator>::destroy(allocator, backChunk() + elemIdx);
-        }
-
-        // Destroy each chunk
-        for(size_type chunkIdx = 0; chunkIdx < numOfChunks; ++chunkIdx)
-            std::allocator_traits<Allocator>::deallocate(allocator, chunks[chunkIdx], C_SIZE);
-    }
-
-    // Destroy chunk pointer array
-    std::allocator_traits<ch_allocator_type>::deallocate(chAllocator, chunks, numOfChunks);
+    destroyAll();
+    release_spare_chunks();
 }
 
 /**
@@ -244,13 +417,13 @@ Queue<T, C_SIZE, Allocator>::~Queue()
  * @return  Constant lValue reference to the front element
  * @throws  std::logic_error    If the Queue is empty
  */
-template<class T, std::size_t C_SIZE, class Allocator>
-const T& Queue<T, C_SIZE, Allocator>::front() const
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+const T& Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::front() const
 {
     if(empty())
         throw std::logic_error("Queue is empty!");
 
-    return frontChunk()[frontIdx];
+    return frontChunkPtr[frontIdx];
 }
 
 /**
@@ -258,13 +431,13 @@ const T& Queue<T, C_SIZE, Allocator>::front() const
  * @return  lValue reference to the front element
  * @throws  std::logic_error    If the Queue is empty
  */
-template<class T, std::size_t C_SIZE, class Allocator>
-T& Queue<T, C_SIZE, Allocator>::front()
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+T& Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::front()
 {
     if(empty())
         throw std::logic_error("Queue is empty!");
 
-    return frontChunk()[frontIdx];
+    return frontChunkPtr[frontIdx];
 }
 
 /**
@@ -272,13 +445,13 @@ T& Queue<T, C_SIZE, Allocator>::front()
  * @return  Constant lValue reference to the back element
  * @throws  std::logic_error    If the Queue is empty
  */
-template<class T, std::size_t C_SIZE, class Allocator>
-const T& Queue<T, C_SIZE, Allocator>::back() const
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+const T& Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::back() const
 {
     if(empty())
         throw std::logic_error("Queue is empty!");
 
-    return backChunk()[nextBackIdx-1];
+    return backChunkPtr[nextBackIdx-1];
 }
 
 /**
@@ -286,33 +459,79 @@ const T& Queue<T, C_SIZE, Allocator>::back() const
  * @return  lValue reference to the back element
  * @throws  std::logic_error    If the Queue is empty
  */
-template<class T, std::size_t C_SIZE, class Allocator>
-T& Queue<T, C_SIZE, Allocator>::back()
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+T& Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::back()
 {
     if(empty())
         throw std::logic_error("Queue is empty!");
 
-    return backChunk()[nextBackIdx-1];
+    return backChunkPtr[nextBackIdx-1];
+}
+
+/**
+ * @brief   Finds the first element which is equal to the given value
+ * @param   value   Value to be searched
+ * @return  Iterator to the found element, end() if not found
+ * @note    Each chunk is searched with a single vectorized pass.
+ */
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+typename Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::const_iterator Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::find(const value_type& value) const
+{
+    for(size_type position = 0; position < sz; )
+    {
+        const segment span = spanAt(position);
+        const size_type index = SimdKernels::find(span.data, span.length, value);
+
+        if(index < span.length)
+            return const_iterator(this, position + index);
+
+        position += span.length;
+    }
+
+    return end();
+}
+
+/**
+ * @brief   Finds the first element which is equal to the given value
+ * @param   value   Value to be searched
+ * @return  Iterator to the found element, end() if not found
+ */
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+typename Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::iterator Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::find(const value_type& value)
+{
+    return iterator(this, static_cast<const Queue&>(*this).find(value).position());
+}
+
+/**
+ * @brief   Counts the elements which are equal to the given value
+ * @param   value   Value to be counted
+ * @return  Number of matching elements
+ */
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+typename Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::size_type Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::count(const value_type& value) const
+{
+    size_type matchCount = 0;
+
+    for(const segment span : segments())
+        matchCount += SimdKernels::count(span.data, span.length, value);
+
+    return matchCount;
 }
 
 /**
  * @brief   Pushes the element by constructing it in-place with the given arguments
  * @param   args  Arguments to be forwarded to the constructor of the new element
  * @return  lvalue reference to support cascaded calls
- * @throws  std::logic_error    If the source queue was in an inconsistent state.
  */
-template<class T, std::size_t C_SIZE, class Allocator>
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
 template <class... Args>
-Queue<T, C_SIZE, Allocator>& Queue<T, C_SIZE, Allocator>::emplace(Args&&... args)
+Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>& Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::emplace(Args&&... args)
 {
     if(isNewChunkNeeded())
         createNewChunk();
 
-    if((0 == numOfChunks) || (nullptr == chunks) || (C_SIZE == nextBackIdx))
-        throw std::logic_error("Chunks are corrupted!");
-
-    // Copy construct the new element at the back
-    std::allocator_traits<Allocator>::construct(allocator, backChunk() + nextBackIdx, std::forward<Args>(args)...);
+    // Construct the new element at the back
+    std::allocator_traits<Allocator>::construct(allocator, backChunkPtr + nextBackIdx, std::forward<Args>(args)...);
 
     // Adjust size variables
     ++sz;
@@ -325,24 +544,22 @@ Queue<T, C_SIZE, Allocator>& Queue<T, C_SIZE, Allocator>::emplace(Args&&... args
  * @brief   Pushes the element to the Queue
  * @param   value Constant lValue reference to the object to be pushed
  * @return  lvalue reference to support cascaded calls
- * @throws  std::logic_error    If the Queue was in an inconsistent state
  */
-template<class T, std::size_t C_SIZE, class Allocator>
-Queue<T, C_SIZE, Allocator>& Queue<T, C_SIZE, Allocator>::push(const value_type& value)
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>& Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::push(const value_type& value)
 {
     if(isNewChunkNeeded())
         createNewChunk();
 
-    if((0 == numOfChunks) || (nullptr == chunks) || (C_SIZE == nextBackIdx))
-        throw std::logic_error("Chunks are corrupted!");
-
     // Copy construct the new element at the back
-    std::allocator_traits<Allocator>::construct(allocator, backChunk() + nextBackIdx, value);
+    std::allocator_traits<Allocator>::construct(allocator, backChunkPtr + nextBackIdx, value);
 
     // Adjust size variables
     ++sz;
     ++nextBackIdx;
 
+    CONTAINER_STATS_RECORD(Queue, bytesCopied, sizeof(T));
+
     return *this;
 }
 
@@ -350,26 +567,29 @@ Queue<T, C_SIZE, Allocator>& Queue<T, C_SIZE, Allocator>::push(const value_type&
  * @brief   Pushes the element to the Queue
  * @param   value rValue reference to the object to be pushed
  * @return  lvalue reference to support cascaded calls
- * @throws  std::logic_error    If the Queue was in an inconsistent state
  */
-template<class T, std::size_t C_SIZE, class Allocator>
-Queue<T, C_SIZE, Allocator>& Queue<T, C_SIZE, Allocator>::push(value_type&& value)
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>& Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::push(value_type&& value)
 {
-    return emplace(std::move(value));
+    emplace(std::move(value));
+
+    CONTAINER_STATS_RECORD(Queue, bytesMoved, sizeof(T));
+
+    return *this;
 }
 
 /**
  * @brief Pops the front element of the Queue
  * @return  lvalue reference to support cascaded calls
  */
-template<class T, std::size_t C_SIZE, class Allocator>
-Queue<T, C_SIZE, Allocator>& Queue<T, C_SIZE, Allocator>::pop()
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>& Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::pop()
 {
     if(empty()) // Nothing to pop
         return *this;
 
     // Destroy the front element
-    std::allocator_traits<Allocator>::destroy(allocator, frontChunk() + frontIdx);
+    std::allocator_traits<Allocator>::destroy(allocator, frontChunkPtr + frontIdx);
 
     // Adjust size variables
     ++frontIdx;
@@ -387,27 +607,48 @@ Queue<T, C_SIZE, Allocator>& Queue<T, C_SIZE, Allocator>::pop()
  * @brief Swaps the content of two Queues
  * @param swapQ     Queue to be swapped with
  * @return  lvalue reference to support cascaded calls
+ * @note    Allocators are swapped only if they propagate on swap, otherwise they must compare equal.
+ */
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>& Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::swap(Queue& swapQ) noexcept
+{
+    swapContent(swapQ);
+
+    if constexpr(std::allocator_traits<Allocator>::propagate_on_container_swap::value)
+    {
+        std::swap(allocator,    swapQ.allocator  );
+        std::swap(chAllocator,  swapQ.chAllocator);
+    }
+
+    return *this;
+}
+
+/**
+ * @brief   Helper method for swapping the content of two Queues
+ * @param   swapQ   Queue to be swapped with
  */
-template<class T, std::size_t C_SIZE, class Allocator>
-Queue<T, C_SIZE, Allocator>& Queue<T, C_SIZE, Allocator>::swap(Queue& swapQ) noexcept
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+void Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::swapContent(Queue& swapQ) noexcept
 {
-    // Swap all members
     std::swap(sz,               swapQ.sz             );
-    std::swap(nextBackIdx,   swapQ.nextBackIdx );
-    std::swap(frontIdx,  swapQ.frontIdx);
+    std::swap(nextBackIdx,      swapQ.nextBackIdx    );
+    std::swap(frontIdx,         swapQ.frontIdx       );
     std::swap(numOfChunks,      swapQ.numOfChunks    );
+    std::swap(firstChunkIdx,    swapQ.firstChunkIdx  );
+    std::swap(chunksCapacity,   swapQ.chunksCapacity );
     std::swap(chunks,           swapQ.chunks         );
-    std::swap(allocator,        swapQ.allocator      );
-
-    return *this;
+    std::swap(frontChunkPtr,    swapQ.frontChunkPtr  );
+    std::swap(backChunkPtr,     swapQ.backChunkPtr   );
+    std::swap(numOfSpareChunks, swapQ.numOfSpareChunks);
+    std::swap(spareChunks,      swapQ.spareChunks    );
 }
 
 /**
  * @brief Flushes the content of the Queue
  * @return  lvalue reference to support cascaded calls
  */
-template<class T, std::size_t C_SIZE, class Allocator>
-Queue<T, C_SIZE, Allocator>& Queue<T, C_SIZE, Allocator>::flush()
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>& Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::flush()
 {
     while(!empty())
         pop();
@@ -416,163 +657,244 @@ Queue<T, C_SIZE, Allocator>& Queue<T, C_SIZE, Allocator>::flush()
 }
 
 /**
- * @brief   Assignment operator
- * @param   rightQ The Queue that appears on the right side of the operator
+ * @brief   Pushes the elements of the given range to the back of the Queue
+ * @param   first   Starting element of source
+ * @param   last    Last element of source(excluded)
  * @return  lvalue reference to support cascaded calls
- * @throws  std::logic_error    When the source Queue is in an inconsistent state
+ * @note    The back chunk is filled in a single pass before the next one is created.
+ *          Trivially copyable elements are copied in bulk when the source is a pointer range.
+ * @note    Elements pushed before an exception are kept.
  */
-template<class T, std::size_t C_SIZE, class Allocator>
-Queue<T, C_SIZE, Allocator>& Queue<T, C_SIZE, Allocator>::operator=(const Queue& rightQ)
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+template<class InputIterator>
+Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>& Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::push_range(InputIterator first, InputIterator last)
 {
-    // Pop all the elements first
-    flush();
-
-    // Replace the allocator if needed
-    if(allocator != rightQ.allocator)
-        allocator = rightQ.allocator;
+    constexpr bool isBulkCopyable = std::is_trivially_copyable_v<T> &&
+                                    (std::is_same_v<InputIterator, T*> || std::is_same_v<InputIterator, const T*>);
 
-    // Prepare source indexes
-    size_type chunkIdxRight = 0;
-    size_type idxRight      = rightQ.frontIdx;
-
-    if(0 == rightQ.numOfChunks)     // No data in the right Queue
+    while(first != last)
     {
-        if(rightQ.size() != 0)
-            throw std::logic_error("Source Queue was in an inconsistent state!");
+        if(isNewChunkNeeded())
+            createNewChunk();
 
-        return *this;
-    }
-    else if(1 == rightQ.numOfChunks)
-    {
-        // Traverse the single chunk of right Queue
-        for( ; idxRight < rightQ.nextBackIdx; ++idxRight)
-            push(rightQ.frontChunk()[idxRight]);
+        T* destination          = &backChunkPtr[nextBackIdx];
+        const size_type room    = C_SIZE - nextBackIdx;
+        size_type pushedCount   = 0;
 
-        return *this;
-    }
-    else
-    {
-        // Traverse each chunk of the right Queue
-        for( ; chunkIdxRight < rightQ.numOfChunks; ++chunkIdxRight)
+        if constexpr(isBulkCopyable)
         {
-            // If the current chunk is not the last one, traverse each element
-            if(chunkIdxRight != (rightQ.numOfChunks - 2))
-            {
-                for( ; idxRight < C_SIZE; ++idxRight)
-                    push(rightQ.chunks[chunkIdxRight][idxRight]);
-            }
-            else    // If the current chunk is the last one, traverse until the last element
-            {
-                for( ; idxRight < rightQ.nextBackIdx; ++idxRight)
-                    push(rightQ.chunks[chunkIdxRight][idxRight]);
-            }
+            pushedCount = std::min(room, static_cast<size_type>(last - first));
 
-            idxRight = 0;
+            std::memcpy(static_cast<void*>(destination), static_cast<const void*>(first), pushedCount * sizeof(T));
+            first += pushedCount;
+        }
+        else
+        {
+            try {
+                for( ; (pushedCount < room) && (first != last); ++pushedCount, ++first)
+                    std::allocator_traits<Allocator>::construct(allocator, destination + pushedCount, *first);
+            }catch(...){
+                sz          += pushedCount;
+                nextBackIdx += pushedCount;
+
+                throw;  // Propagate exception
+            }
         }
 
-        // Index adjustments made in push(..) method
-        return *this;
+        // Adjust size variables once per chunk
+        sz          += pushedCount;
+        nextBackIdx += pushedCount;
+
+        CONTAINER_STATS_RECORD(Queue, bytesCopied, pushedCount * sizeof(T));
     }
+
+    return *this;
 }
 
 /**
- * @brief   Comparison operator
- * @param   rightQ Queue that appears on the right side of the operator.
- * @return  true    If both Queue's are equal.
+ * @brief   Pops up to the given number of elements from the front
+ * @param   count   Maximum number of elements to be popped
+ * @return  Number of popped elements, limited by the size
+ * @note    Consumed chunks are released once, not per element.
  */
-template<class T, std::size_t C_SIZE, class Allocator>
-NODISCARD bool Queue<T, C_SIZE, Allocator>::operator==(const Queue& rightQ) const
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+typename Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::size_type Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::pop_n(size_type count)
 {
-    if(rightQ.sz != sz)
-        return false;
+    size_type poppedCount = 0;
 
-    size_type chunkIdxRight    = 0;
-    size_type chunkIdxLeft     = 0;
-    size_type idxRight  = rightQ.frontIdx;
-    size_type idxLeft   = frontIdx;
-
-    for(size_type compCounter = 0; compCounter < sz; ++compCounter)
+    while((poppedCount < count) && !empty())
     {
-        if(chunks[chunkIdxLeft][idxLeft++] != rightQ.chunks[chunkIdxRight][idxRight++])
-            return false;
+        const size_type available = std::min(count - poppedCount, std::min(sz, C_SIZE - frontIdx));
 
-        if(C_SIZE == idxLeft)
+        if constexpr(!std::is_trivially_destructible_v<T>)
         {
-            idxLeft = 0;    // Reset element index
-            ++chunkIdxLeft; // Increment left chunk index
-        }
+            pointer chunk = frontChunkPtr;
 
-        if(C_SIZE == idxRight)
-        {
-            idxRight = 0;    // Reset element indexs
-            ++chunkIdxRight; // Increment left chunk index
+            for(size_type idx = frontIdx; idx < frontIdx + available; ++idx)
+                std::allocator_traits<Allocator>::destroy(allocator, chunk + idx);
         }
+
+        consumeFront(available);
+        poppedCount += available;
     }
 
-    return true;
+    return poppedCount;
 }
 
 /**
- * @brief   Inequality operator
- * @param   rightQ  Queue that appears on the right side of the operator.
- * @return  true    If Queue's are not equal
+ * @brief   Moves up to the given number of elements from the front into the destination
+ * @param   count       Maximum number of elements to be popped
+ * @param   destination Output iterator to be assigned with the elements
+ * @return  Number of popped elements, limited by the size
+ * @note    Elements moved out before an exception are popped, the others are kept.
  */
-template<class T, std::size_t C_SIZE, class Allocator>
-NODISCARD bool Queue<T, C_SIZE, Allocator>::operator!=(const Queue& rightQ) const
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+template<class OutputIterator>
+typename Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::size_type Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::pop_n(size_type count, OutputIterator destination)
 {
-    return !(*this == rightQ);
+    size_type poppedCount = 0;
+
+    while((poppedCount < count) && !empty())
+    {
+        const size_type available = std::min(count - poppedCount, std::min(sz, C_SIZE - frontIdx));
+        pointer chunk = frontChunkPtr + frontIdx;
+        size_type movedCount = 0;
+
+        try {
+            for( ; movedCount < available; ++movedCount, ++destination)
+            {
+                *destination = std::move(chunk[movedCount]);
+                std::allocator_traits<Allocator>::destroy(allocator, chunk + movedCount);
+            }
+        }catch(...){
+            consumeFront(movedCount);
+
+            throw;  // Propagate exception
+        }
+
+        consumeFront(available);
+        poppedCount += available;
+    }
+
+    return poppedCount;
 }
 
 /**
- * @brief   Helper method for accessing back chunk of the queue
- * @return  Const lValue reference to the back chunk of the queue.
+ * @brief   Assignment operator
+ * @param   rightQ The Queue that appears on the right side of the operator
+ * @return  lvalue reference to support cascaded calls
+ * @throws  std::logic_error    When the source Queue is in an inconsistent state
+ * @note    The allocator is replaced only if it propagates on copy assignment.
  */
-template<class T, std::size_t C_SIZE, class Allocator>
-NODISCARD typename Queue<T, C_SIZE, Allocator>::const_pointer Queue<T, C_SIZE, Allocator>::backChunk() const
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>& Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::operator=(const Queue& rightQ)
 {
-    if(0 == numOfChunks)
-        throw;
+    if(this == &rightQ) // Check self assignment
+        return *this;
+
+    // Pop all the elements first, the chunks are kept as spare
+    flush();
+
+    if constexpr(std::allocator_traits<Allocator>::propagate_on_container_copy_assignment::value)
+    {
+        if(allocator != rightQ.allocator)  // Memory owned by the current allocator must be returned to it
+        {
+            destroyAll();
+            release_spare_chunks();
+        }
+
+        allocator   = rightQ.allocator;
+        chAllocator = rightQ.chAllocator;
+    }
+
+    if((0 == rightQ.numOfChunks) && (rightQ.size() != 0))
+        throw std::logic_error("Source Queue was in an inconsistent state!");
+
+    // Copy chunk by chunk, index adjustments are made in push_range(..) method
+    for(const segment sourceSegment : rightQ.segments())
+        push_range(sourceSegment.begin(), sourceSegment.end());
 
-    return chunks[numOfChunks-1];
+    return *this;
 }
 
 /**
- * @brief   Helper method for accessing back chunk of the queue
- * @return  lValue reference to the back chunk of the queue.
+ * @brief   Move assignment operator
+ * @param   rightQ The Queue that appears on the right side of the operator, left empty
+ * @return  lvalue reference to support cascaded calls
+ * @note    The chunks of the right Queue are taken over if the allocator propagates on move assignment or is equal,
+ *          the elements are moved one by one otherwise.
  */
-template<class T, std::size_t C_SIZE, class Allocator>
-NODISCARD typename Queue<T, C_SIZE, Allocator>::pointer Queue<T, C_SIZE, Allocator>::backChunk()
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>& Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::operator=(Queue&& rightQ) noexcept(isStealingAlwaysPossible())
 {
-    if(0 == numOfChunks)
-        throw;
+    if(this == &rightQ) // Check self assignment
+        return *this;
 
-    return chunks[numOfChunks-1];
+    constexpr bool propagate = std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value;
+
+    if(propagate || (allocator == rightQ.allocator))
+    {
+        // Release own chunks with the current allocator before replacing it
+        destroyAll();
+        release_spare_chunks();
+
+        if constexpr(propagate)
+        {
+            allocator   = std::move(rightQ.allocator);
+            chAllocator = std::move(rightQ.chAllocator);
+        }
+
+        swapContent(rightQ);
+    }
+    else    // The chunks belong to the other allocator
+    {
+        flush();
+
+        for(size_type position = 0; position < rightQ.sz; ++position)
+            emplace(std::move(rightQ.elementAt(position)));
+
+        rightQ.flush();
+    }
+
+    return *this;
 }
 
 /**
- * @brief   Helper method for accessing front chunk of the queue
- * @return  Const lValue reference to the front chunk of the queue.
+ * @brief   Comparison operator
+ * @param   rightQ Queue that appears on the right side of the operator.
+ * @return  true    If both Queue's are equal.
  */
-template<class T, std::size_t C_SIZE, class Allocator>
-NODISCARD typename Queue<T, C_SIZE, Allocator>::const_pointer Queue<T, C_SIZE, Allocator>::frontChunk() const
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+NODISCARD bool Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::operator==(const Queue& rightQ) const
 {
-    if(0 == numOfChunks)
-        throw;
+    if(rightQ.sz != sz)
+        return false;
+
+    // Compare the spans that are contiguous in both queues
+    for(size_type position = 0; position < sz; )
+    {
+        const segment leftSpan  = spanAt(position);
+        const segment rightSpan = rightQ.spanAt(position);
+        const size_type length  = std::min(leftSpan.length, rightSpan.length);
+
+        if(!SimdKernels::equal(leftSpan.data, rightSpan.data, length))
+            return false;
 
-    return chunks[0];
+        position += length;
+    }
+
+    return true;
 }
 
 /**
- * @brief   Helper method for accessing front chunk of the queue
- * @return  lValue reference to the front chunk of the queue.
+ * @brief   Inequality operator
+ * @param   rightQ  Queue that appears on the right side of the operator.
+ * @return  true    If Queue's are not equal
  */
-template<class T, std::size_t C_SIZE, class Allocator>
-NODISCARD typename Queue<T, C_SIZE, Allocator>::pointer Queue<T, C_SIZE, Allocator>::frontChunk()
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+NODISCARD bool Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::operator!=(const Queue& rightQ) const
 {
-    if(0 == numOfChunks)
-        throw;
-
-    return chunks[0];
+    return !(*this == rightQ);
 }
 
 /**
@@ -580,52 +902,49 @@ NODISCARD typename Queue<T, C_SIZE, Allocator>::pointer Queue<T, C_SIZE, Allocat
  * @throws  std::logic_error    If the Queue was in an inconsistent state
  * @throws  std::runtime_error  If the allocator fails to allocate chunks
  */
-template<class T, std::size_t C_SIZE, class Allocator>
-void Queue<T, C_SIZE, Allocator>::createNewChunk()
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+void Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::createNewChunk()
 {
     // Check the status of container
     // This function should only be called when there is need for a new chunk
     if(!isNewChunkNeeded())
         throw std::logic_error("Early call to chunk creator!");
 
-    // Allocate space for the new chunk
-    pointer newChunk = std::allocator_traits<Allocator>::allocate(allocator, C_SIZE);
+    // Take a spare chunk or allocate space for the new chunk
+    pointer newChunk = acquireChunk();
 
-    // Allocate space for chunk pointers
-    pointer* newChunks = std::allocator_traits<ch_allocator_type>::allocate(chAllocator, numOfChunks+1);
-
-    if((nullptr == newChunks) || (nullptr == newChunk))
+    if(nullptr == newChunk)
         throw std::runtime_error("Cannot allocate space for the new chunk!");
 
-    // Move the current chunk pointers
-    if(0 < numOfChunks)
+    if(numOfChunks == chunksCapacity)   // Is a bigger space needed for chunk pointers?
     {
-        if(nullptr == chunks)
-            throw std::logic_error("Chunks lost!");
+        try {
+            growChunkMap(numOfChunks + 1);
+        }catch(...){
+            releaseChunk(newChunk);
 
-        std::memcpy(newChunks, chunks, numOfChunks * sizeof(pointer));   // Copy pointers directly
-
-        // Deallocate old chunk array
-        std::allocator_traits<ch_allocator_type>::deallocate(chAllocator, chunks, numOfChunks);
+            throw;  // Propagate exception
+        }
     }
 
     // Append the new chunk
-    newChunks[numOfChunks] = newChunk;
+    chunkAt(numOfChunks) = newChunk;
 
-    // Change chunk array with the new one
-    chunks = newChunks;
+    if(0 == numOfChunks)    // The first chunk is also the front one
+        frontChunkPtr = newChunk;
 
     // Adjust current chunk variables
     ++numOfChunks;
-    nextBackIdx = 0;
+    nextBackIdx     = 0;
+    backChunkPtr    = newChunk;
 }
 
 /**
  * @brief   Removes the front chunk when it has no more elements to fetch
  * @throws  std::logic_error    If the Queue was in an inconsistent state
  */
-template<class T, std::size_t C_SIZE, class Allocator>
-void Queue<T, C_SIZE, Allocator>::removeFrontChunk()
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+void Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::removeFrontChunk()
 {
     if(isFrontChunkConsumed() == false)
         throw std::logic_error("Front chunks is not consumed yet!");
@@ -645,18 +964,197 @@ void Queue<T, C_SIZE, Allocator>::removeFrontChunk()
         return;
     }
 
-    // Deallocate front chunk
-    std::allocator_traits<Allocator>::deallocate(allocator, frontChunk(), C_SIZE);
-
-    /* There is no need to allocate new space for chunk pointers
-     * as the currently allocated area will be enough to contain
-     * the cropped version of previous pointer array */
-
-    // Move chunk pointers backwards
-    for(size_type idx = 0; idx < (numOfChunks-1); ++idx)
-        chunks[idx] = chunks[idx+1];
+    // Keep the front chunk as spare or deallocate it
+    releaseChunk(frontChunkPtr);
 
+    // The next chunk becomes the front one, no pointer is moved
+    firstChunkIdx = (firstChunkIdx + 1) & (chunksCapacity - 1);
+    frontChunkPtr = chunkAt(0);
     --numOfChunks;  // Decrement the number of chunks
 
     frontIdx = 0;    // Reset front index
 }
+
+/**
+ * @brief   Returns the cached empty chunks to the allocator
+ * @return  lvalue reference to support cascaded calls
+ */
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>& Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::release_spare_chunks()
+{
+    for( ; numOfSpareChunks > 0; --numOfSpareChunks)
+    {
+        std::allocator_traits<Allocator>::deallocate(allocator, spareChunks[numOfSpareChunks-1], C_SIZE);
+        CONTAINER_STATS_RECORD(Queue, chunkRemovals, 1);
+    }
+
+    return *this;
+}
+
+/**
+ * @brief   Helper method for accessing an element by its distance from the front element
+ * @param   position    Distance from the front element
+ * @return  Const lValue reference to the element
+ */
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+const T& Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::elementAt(size_type position) const
+{
+    const size_type offset = frontIdx + position;
+
+    return chunkAt(offset / C_SIZE)[offset % C_SIZE];
+}
+
+/**
+ * @brief   Helper method for accessing an element by its distance from the front element
+ * @param   position    Distance from the front element
+ * @return  lValue reference to the element
+ */
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+T& Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::elementAt(size_type position)
+{
+    const size_type offset = frontIdx + position;
+
+    return chunkAt(offset / C_SIZE)[offset % C_SIZE];
+}
+
+/**
+ * @brief   Takes a chunk from the spare chunk cache, allocates a new one if the cache is empty
+ * @return  Address of an uninitialized chunk
+ */
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+typename Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::pointer Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::acquireChunk()
+{
+    if(0 < numOfSpareChunks)
+        return spareChunks[--numOfSpareChunks];
+
+    pointer chunk = std::allocator_traits<Allocator>::allocate(allocator, C_SIZE);
+    CONTAINER_STATS_RECORD(Queue, chunkCreations, 1);
+
+    return chunk;
+}
+
+/**
+ * @brief   Caches an empty chunk for further usage, deallocates it if the cache is full
+ * @param   chunk   Chunk without any constructed element
+ */
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+void Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::releaseChunk(pointer chunk)
+{
+    if(numOfSpareChunks < SPARE_CHUNKS)
+    {
+        spareChunks[numOfSpareChunks++] = chunk;
+    }
+    else
+    {
+        std::allocator_traits<Allocator>::deallocate(allocator, chunk, C_SIZE);
+        CONTAINER_STATS_RECORD(Queue, chunkRemovals, 1);
+    }
+}
+
+/**
+ * @brief   Destroys all elements, releases all chunks and the chunk pointer array
+ * @note    Released chunks may be kept in the spare chunk cache.
+ */
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+void Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::destroyAll()
+{
+    // Destroy each element
+    for(size_type position = 0; position < sz; ++position)
+        std::allocator_traits<Allocator>::destroy(allocator, &elementAt(position));
+
+    // Release each chunk
+    for(size_type chunkPosition = 0; chunkPosition < numOfChunks; ++chunkPosition)
+        releaseChunk(chunkAt(chunkPosition));
+
+    // Destroy chunk pointer array
+    if(nullptr != chunks)
+        std::allocator_traits<ch_allocator_type>::deallocate(chAllocator, chunks, chunksCapacity);
+
+    sz              = 0;
+    frontIdx        = 0;
+    nextBackIdx     = 0;
+    numOfChunks     = 0;
+    firstChunkIdx   = 0;
+    chunksCapacity  = 0;
+    chunks          = nullptr;
+    frontChunkPtr   = nullptr;
+    backChunkPtr    = nullptr;
+}
+
+/**
+ * @brief   Reallocates the chunk map with a capacity that is at least doubled
+ * @param   minCapacity Minimum number of chunk pointers to be stored
+ * @throws  std::runtime_error  If the allocator fails to allocate the chunk map
+ * @note    Chunk pointers are unwrapped into the new map, the front chunk is placed at index 0.
+ */
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+void Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::growChunkMap(size_type minCapacity)
+{
+    // Keep the capacity a power of 2, so that wrapping around is a simple masking
+    size_type newCapacity = (0 == chunksCapacity) ? MIN_CHUNK_MAP_CAPACITY : (2 * chunksCapacity);
+
+    while(newCapacity < minCapacity)
+        newCapacity *= 2;
+
+    pointer* newChunks = std::allocator_traits<ch_allocator_type>::allocate(chAllocator, newCapacity);
+
+    if(nullptr == newChunks)
+        throw std::runtime_error("Cannot allocate chunks array!");
+
+    if(0 < numOfChunks)
+    {
+        // Copy pointers directly, the used part of the map may wrap around its end
+        const size_type firstPartLength = std::min(numOfChunks, chunksCapacity - firstChunkIdx);
+
+        std::memcpy(newChunks, chunks + firstChunkIdx, firstPartLength * sizeof(pointer));
+        std::memcpy(newChunks + firstPartLength, chunks, (numOfChunks - firstPartLength) * sizeof(pointer));
+    }
+
+    // Deallocate old chunk array
+    if(nullptr != chunks)
+        std::allocator_traits<ch_allocator_type>::deallocate(chAllocator, chunks, chunksCapacity);
+
+    // Change chunk array with the new one
+    chunks          = newChunks;
+    chunksCapacity  = newCapacity;
+    firstChunkIdx   = 0;
+}
+
+/**
+ * @brief   Advances the front index over the already destroyed elements
+ * @param   count   Number of destroyed elements, cannot exceed the front chunk
+ */
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+void Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::consumeFront(size_type count)
+{
+    frontIdx    += count;
+    sz          -= count;
+
+    if(isFrontChunkConsumed())
+        removeFrontChunk();
+}
+
+/**
+ * @brief   Helper method for finding the elements stored in a chunk
+ * @param   chunkPosition   Position of the chunk from the front, must be less than segmentCount()
+ * @return  Span of the elements in the chunk
+ */
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+typename Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::segment Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::segmentAt(size_type chunkPosition) const
+{
+    // The front chunk starts at the front index, the others start at their first element
+    return spanAt((0 == chunkPosition) ? 0 : ((chunkPosition * C_SIZE) - frontIdx));
+}
+
+/**
+ * @brief   Helper method for finding the contiguous elements starting from a position
+ * @param   position    Distance from the front element, must be less than the size
+ * @return  Span of the elements from the position to the end of its chunk or the back element
+ */
+template<class T, std::size_t C_SIZE, class Allocator, std::size_t SPARE_CHUNKS>
+typename Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::segment Queue<T, C_SIZE, Allocator, SPARE_CHUNKS>::spanAt(size_type position) const
+{
+    const size_type offset = frontIdx + position;
+
+    return segment{&elementAt(position), std::min(C_SIZE - (offset % C_SIZE), sz - position)};
+}
@@ -0,0 +1,361 @@
+/**
+ * @file        SimdKernels.h
+ * @details     Vectorized comparison kernels shared by the linear containers.
+ *              Provides equality, find, count and compaction operations over contiguous ranges.
+ *              Uses AVX2, SSE2 or NEON depending on the target, a scalar loop otherwise.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <cstddef>              // std::size_t
+#include <cstdint>              // Fixed width integers
+#include <cstring>              // std::memcpy, std::memmove
+#include <type_traits>          // Type traits
+
+/* The instruction set is selected at compile time, e.g. with -mavx2 or -march=native.
+ * Bit scanning builtins are needed to process the comparison masks. */
+#if defined(__GNUC__) || defined(__clang__)
+    #if defined(__AVX2__)
+        #include <immintrin.h>
+        #define SIMD_KERNELS_AVX2
+    #elif defined(__SSE2__)
+        #include <emmintrin.h>
+        #define SIMD_KERNELS_SSE2
+    #elif defined(__ARM_NEON) && defined(__aarch64__)
+        #include <arm_neon.h>
+        #define SIMD_KERNELS_NEON
+    #endif
+#endif
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Comparison Traits ***/
+/* Elements of trivially comparable types are equal if and only if their object representations are equal.
+ * Such elements are compared as unsigned integers of the same size by the vectorized kernels.
+ * Specialize this trait for types without padding whose operator== compares all bytes (e.g. a tag wrapper). */
+template<class T>
+struct is_trivially_comparable : std::bool_constant<std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>> {};
+
+template<class T>
+inline constexpr bool is_trivially_comparable_v = is_trivially_comparable<T>::value;
+
+namespace SimdKernels {
+
+// Element types which can be processed by the vectorized kernels
+template<class T>
+inline constexpr bool is_vectorizable_v =  (is_trivially_comparable_v<T> || std::is_same_v<T, float> || std::is_same_v<T, double>) &&
+                                            ((sizeof(T) == 1) || (sizeof(T) == 2) || (sizeof(T) == 4) || (sizeof(T) == 8));
+
+namespace Detail {
+
+#if defined(SIMD_KERNELS_AVX2) || defined(SIMD_KERNELS_SSE2) || defined(SIMD_KERNELS_NEON)
+#define SIMD_KERNELS_VECTORIZED
+
+/* Each comparison produces a mask holding BITS_PER_BYTE bits for each byte of the block.
+ * Bits of an element are either all set or all clear, as the lanes are compared with the element width. */
+#if defined(SIMD_KERNELS_AVX2)
+using Register  = __m256i;
+using Mask      = std::uint32_t;
+
+constexpr std::size_t BLOCK_BYTES   = 32;
+constexpr std::size_t BITS_PER_BYTE = 1;
+
+inline Register load(const void* source) noexcept { return _mm256_loadu_si256(static_cast<const __m256i*>(source)); }
+
+template<class T>
+inline Register broadcast(const T& value) noexcept
+{
+    if constexpr(sizeof(T) == 1)        { std::uint8_t  lane; std::memcpy(&lane, &value, 1); return _mm256_set1_epi8(char(lane)); }
+    else if constexpr(sizeof(T) == 2)   { std::uint16_t lane; std::memcpy(&lane, &value, 2); return _mm256_set1_epi16(short(lane)); }
+    else if constexpr(sizeof(T) == 4)   { std::uint32_t lane; std::memcpy(&lane, &value, 4); return _mm256_set1_epi32(int(lane)); }
+    else                                { std::uint64_t lane; std::memcpy(&lane, &value, 8); return _mm256_set1_epi64x((long long)(lane)); }
+}
+
+template<class T>
+inline Mask equalMask(Register left, Register right) noexcept
+{
+    Register result;
+
+    if constexpr(std::is_same_v<T, float>)          // Ordered comparison, NaN is not equal to anything
+        result = _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(left), _mm256_castsi256_ps(right), _CMP_EQ_OQ));
+    else if constexpr(std::is_same_v<T, double>)
+        result = _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(left), _mm256_castsi256_pd(right), _CMP_EQ_OQ));
+    else if constexpr(sizeof(T) == 1)
+        result = _mm256_cmpeq_epi8(left, right);
+    else if constexpr(sizeof(T) == 2)
+        result = _mm256_cmpeq_epi16(left, right);
+    else if constexpr(sizeof(T) == 4)
+        result = _mm256_cmpeq_epi32(left, right);
+    else
+        result = _mm256_cmpeq_epi64(left, right);
+
+    return Mask(_mm256_movemask_epi8(result));
+}
+
+#elif defined(SIMD_KERNELS_SSE2)
+using Register  = __m128i;
+using Mask      = std::uint32_t;
+
+constexpr std::size_t BLOCK_BYTES   = 16;
+constexpr std::size_t BITS_PER_BYTE = 1;
+
+inline Register load(const void* source) noexcept { return _mm_loadu_si128(static_cast<const __m128i*>(source)); }
+
+template<class T>
+inline Register broadcast(const T& value) noexcept
+{
+    if constexpr(sizeof(T) == 1)        { std::uint8_t  lane; std::memcpy(&lane, &value, 1); return _mm_set1_epi8(char(lane)); }
+    else if constexpr(sizeof(T) == 2)   { std::uint16_t lane; std::memcpy(&lane, &value, 2); return _mm_set1_epi16(short(lane)); }
+    else if constexpr(sizeof(T) == 4)   { std::uint32_t lane; std::memcpy(&lane, &value, 4); return _mm_set1_epi32(int(lane)); }
+    else                                { std::uint64_t lane; std::memcpy(&lane, &value, 8); return _mm_set1_epi64x((long long)(lane)); }
+}
+
+template<class T>
+inline Mask equalMask(Register left, Register right) noexcept
+{
+    Register result;
+
+    if constexpr(std::is_same_v<T, float>)          // Ordered comparison, NaN is not equal to anything
+        result = _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(left), _mm_castsi128_ps(right)));
+    else if constexpr(std::is_same_v<T, double>)
+        result = _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(left), _mm_castsi128_pd(right)));
+    else if constexpr(sizeof(T) == 1)
+        result = _mm_cmpeq_epi8(left, right);
+    else if constexpr(sizeof(T) == 2)
+        result = _mm_cmpeq_epi16(left, right);
+    else if constexpr(sizeof(T) == 4)
+        result = _mm_cmpeq_epi32(left, right);
+    else
+    {
+        // SSE2 lacks a 64-bit comparison, both 32-bit halves of a lane must be equal
+        const Register halves = _mm_cmpeq_epi32(left, right);
+        result = _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+    }
+
+    return Mask(_mm_movemask_epi8(result));
+}
+
+#elif defined(SIMD_KERNELS_NEON)
+using Register  = uint8x16_t;
+using Mask      = std::uint64_t;
+
+constexpr std::size_t BLOCK_BYTES   = 16;
+constexpr std::size_t BITS_PER_BYTE = 4;
+
+inline Register load(const void* source) noexcept { return vld1q_u8(static_cast<const std::uint8_t*>(source)); }
+
+template<class T>
+inline Register broadcast(const T& value) noexcept
+{
+    if constexpr(sizeof(T) == 1)        { std::uint8_t  lane; std::memcpy(&lane, &value, 1); return vdupq_n_u8(lane); }
+    else if constexpr(sizeof(T) == 2)   { std::uint16_t lane; std::memcpy(&lane, &value, 2); return vreinterpretq_u8_u16(vdupq_n_u16(lane)); }
+    else if constexpr(sizeof(T) == 4)   { std::uint32_t lane; std::memcpy(&lane, &value, 4); return vreinterpretq_u8_u32(vdupq_n_u32(lane)); }
+    else                                { std::uint64_t lane; std::memcpy(&lane, &value, 8); return vreinterpretq_u8_u64(vdupq_n_u64(lane)); }
+}
+
+template<class T>
+inline Mask equalMask(Register left, Register right) noexcept
+{
+    Register result;
+
+    if constexpr(std::is_same_v<T, float>)          // Ordered comparison, NaN is not equal to anything
+        result = vreinterpretq_u8_u32(vceqq_f32(vreinterpretq_f32_u8(left), vreinterpretq_f32_u8(right)));
+    else if constexpr(std::is_same_v<T, double>)
+        result = vreinterpretq_u8_u64(vceqq_f64(vreinterpretq_f64_u8(left), vreinterpretq_f64_u8(right)));
+    else if constexpr(sizeof(T) == 1)
+        result = vceqq_u8(left, right);
+    else if constexpr(sizeof(T) == 2)
+        result = vreinterpretq_u8_u16(vceqq_u16(vreinterpretq_u16_u8(left), vreinterpretq_u16_u8(right)));
+    else if constexpr(sizeof(T) == 4)
+        result = vreinterpretq_u8_u32(vceqq_u32(vreinterpretq_u32_u8(left), vreinterpretq_u32_u8(right)));
+    else
+        result = vreinterpretq_u8_u64(vceqq_u64(vreinterpretq_u64_u8(left), vreinterpretq_u64_u8(right)));
+
+    // NEON has no byte mask extraction, narrowing keeps 4 bits of each byte
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(result), 4)), 0);
+}
+#endif
+
+constexpr Mask FULL_MASK = Mask(~Mask(0)) >> ((sizeof(Mask) * 8) - (BLOCK_BYTES * BITS_PER_BYTE));
+
+inline std::size_t countBits(Mask mask)     noexcept { return std::size_t(__builtin_popcountll(mask)); }
+inline std::size_t firstBitIndex(Mask mask) noexcept { return std::size_t(__builtin_ctzll(mask)); }
+
+#endif // Vectorized targets
+
+} // namespace Detail
+
+/**
+ * @brief   Compares two ranges of the same length element by element
+ * @param   left    Starting point of the first range
+ * @param   right   Starting point of the second range
+ * @param   count   Number of elements in each range
+ * @return  true    If all elements are equal.
+ *          false   If any difference is detected.
+ * @note    Floating point elements keep their semantics, NaN is not equal to itself and -0.0 is equal to +0.0.
+ */
+template<class T>
+NODISCARD bool equal(const T* left, const T* right, std::size_t count)
+{
+    std::size_t index = 0;
+
+#ifdef SIMD_KERNELS_VECTORIZED
+    if constexpr(is_vectorizable_v<T>)
+    {
+        constexpr std::size_t STEP = Detail::BLOCK_BYTES / sizeof(T);
+
+        for( ; index + STEP <= count; index += STEP)
+            if(Detail::equalMask<T>(Detail::load(left + index), Detail::load(right + index)) != Detail::FULL_MASK)
+                return false;
+    }
+#endif
+
+    for( ; index < count; ++index)  // Remaining elements
+        if(!(left[index] == right[index]))
+            return false;
+
+    return true;
+}
+
+/**
+ * @brief   Finds the first element which is equal to the given value
+ * @param   first   Starting point of the range
+ * @param   count   Number of elements in the range
+ * @param   value   Value to be searched
+ * @return  Index of the first equal element, count if there is none.
+ */
+template<class T>
+NODISCARD std::size_t find(const T* first, std::size_t count, const T& value)
+{
+    std::size_t index = 0;
+
+#ifdef SIMD_KERNELS_VECTORIZED
+    if constexpr(is_vectorizable_v<T>)
+    {
+        constexpr std::size_t STEP          = Detail::BLOCK_BYTES / sizeof(T);
+        constexpr std::size_t BITS_PER_ITEM = Detail::BITS_PER_BYTE * sizeof(T);
+        const Detail::Register needle       = Detail::broadcast(value);
+
+        for( ; index + STEP <= count; index += STEP)
+        {
+            const Detail::Mask mask = Detail::equalMask<T>(Detail::load(first + index), needle);
+
+            if(0 != mask)
+                return index + (Detail::firstBitIndex(mask) / BITS_PER_ITEM);
+        }
+    }
+#endif
+
+    for( ; index < count; ++index)  // Remaining elements
+        if(first[index] == value)
+            return index;
+
+    return count;
+}
+
+/**
+ * @brief   Counts the elements which are equal to the given value
+ * @param   first   Starting point of the range
+ * @param   count   Number of elements in the range
+ * @param   value   Value to be counted
+ * @return  Number of equal elements
+ */
+template<class T>
+NODISCARD std::size_t count(const T* first, std::size_t count, const T& value)
+{
+    std::size_t index   = 0;
+    std::size_t result  = 0;
+
+#ifdef SIMD_KERNELS_VECTORIZED
+    if constexpr(is_vectorizable_v<T>)
+    {
+        constexpr std::size_t STEP          = Detail::BLOCK_BYTES / sizeof(T);
+        constexpr std::size_t BITS_PER_ITEM = Detail::BITS_PER_BYTE * sizeof(T);
+        const Detail::Register needle       = Detail::broadcast(value);
+
+        for( ; index + STEP <= count; index += STEP)
+            result += Detail::countBits(Detail::equalMask<T>(Detail::load(first + index), needle)) / BITS_PER_ITEM;
+    }
+#endif
+
+    for( ; index < count; ++index)  // Remaining elements
+        if(first[index] == value)
+            ++result;
+
+    return result;
+}
+
+/**
+ * @brief   Removes the elements which are equal to the given value by compacting the range in place
+ * @param   first   Starting point of the range
+ * @param   count   Number of elements in the range
+ * @param   value   Value to be removed, may refer to an element of the range
+ * @return  Number of the kept elements, which are moved to the beginning of the range in their order
+ * @note    Blocks without any equal element are moved at once, blocks full of equal elements are skipped.
+ *          The kept elements of the mixed blocks are compacted without branching on the comparison results.
+ * @note    Elements after the returned count are left with unspecified values.
+ */
+template<class T>
+NODISCARD std::size_t removeEqual(T* first, std::size_t count, const T& value)
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Elements must be trivially copyable!");
+
+    const T     key         = value;    // The referred element may be overwritten
+    std::size_t readIndex   = 0;
+    std::size_t writeIndex  = 0;
+
+#ifdef SIMD_KERNELS_VECTORIZED
+    if constexpr(is_vectorizable_v<T>)
+    {
+        constexpr std::size_t STEP          = Detail::BLOCK_BYTES / sizeof(T);
+        constexpr std::size_t BITS_PER_ITEM = Detail::BITS_PER_BYTE * sizeof(T);
+        const Detail::Register needle       = Detail::broadcast(key);
+
+        for( ; readIndex + STEP <= count; readIndex += STEP)
+        {
+            const Detail::Mask mask = Detail::equalMask<T>(Detail::load(first + readIndex), needle);
+
+            if(0 == mask)
+            {
+                if(writeIndex != readIndex)     // The block may overlap its destination
+                    std::memmove(static_cast<void*>(first + writeIndex), static_cast<const void*>(first + readIndex), Detail::BLOCK_BYTES);
+
+                writeIndex += STEP;
+            }
+            else if(Detail::FULL_MASK != mask)
+            {
+                for(std::size_t lane = 0; lane < STEP; ++lane)
+                {
+                    first[writeIndex] = first[readIndex + lane];
+                    writeIndex += std::size_t(((mask >> (lane * BITS_PER_ITEM)) & 1) ^ 1);
+                }
+            }
+        }
+    }
+#endif
+
+    for( ; readIndex < count; ++readIndex)  // Remaining elements
+    {
+        const bool isKept = !(first[readIndex] == key);
+
+        first[writeIndex] = first[readIndex];
+        writeIndex += std::size_t(isKept);
+    }
+
+    return writeIndex;
+}
+
+} // namespace SimdKernels
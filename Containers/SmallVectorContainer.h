@@ -0,0 +1,27 @@
+/**
+ * @file        SmallVectorContainer.h
+ * @details     A template vector container class with small buffer optimization.
+ *              Keeps up to N elements inside the object itself, the heap is only used for larger contents.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *                               -> Inline buffer moved into Vector as a template parameter, SmallVector is an alias of it.
+ *
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include "VectorContainer.h"    // Vector, PowerOf2Growth
+#include <cstddef>              // std::size_t
+#include <memory>               // std::allocator
+
+/*** Container Alias ***/
+/* The whole interface of Vector is available, including inline_capacity and is_inline().
+ * Differences to a vector without an inline buffer:
+ *  - The capacity is never smaller than N, shrink_to_fit() moves the content back to the inline buffer if it fits.
+ *  - Inline elements cannot be stolen, moving or swapping relocates them one by one and invalidates their iterators. */
+template<class T, std::size_t N, class Allocator = std::allocator<T>, class GrowthPolicy = PowerOf2Growth>
+using SmallVector = Vector<T, Allocator, GrowthPolicy, N>;
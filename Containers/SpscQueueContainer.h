@@ -0,0 +1,324 @@
+/**
+ * @file        SpscQueueContainer.h
+ * @details     A bounded lock-free single producer single consumer queue.
+ *              Elements are kept in a ring buffer, the producer and the consumer only
+ *              synchronize through the acquire/release ordering of two indexes.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <atomic>       // std::atomic, std::memory_order
+#include <cstddef>      // std::size_t
+#include <new>          // std::launder, placement new
+#include <stdexcept>    // std::logic_error
+#include <thread>       // std::this_thread::yield
+#include <utility>      // std::move, std::forward
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Container Class ***/
+/* Only one thread may call the producer methods (emplace, push, try_*push*, push_n)
+ * and only one thread may call the consumer methods (front, pop, try_pop, pop_n) at a time.
+ * Indexes increase monotonically, they are mapped to the ring by masking with (Capacity - 1). */
+template<class T, std::size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity != 0, "Capacity cannot be 0!");
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of 2!");
+
+public:
+    /*** C++ Standard Named Requirements for Containers ***/
+    using value_type        = T;
+    using reference         = T&;
+    using const_reference   = const T&;
+    using size_type         = std::size_t;
+
+    /*** Constructors and Destructor ***/
+    SpscQueue() = default;
+    SpscQueue(const SpscQueue&) = delete;   // Indexes are shared with other threads, the queue cannot be copied
+    SpscQueue(SpscQueue&&) = delete;        // Indexes are shared with other threads, the queue cannot be moved
+    ~SpscQueue();
+
+    SpscQueue& operator=(const SpscQueue&) = delete;
+    SpscQueue& operator=(SpscQueue&&) = delete;
+
+    /*** Producer Side ***/
+    template<class... Args>
+    NODISCARD bool try_emplace(Args&&... args);
+    NODISCARD bool try_push(const value_type& value)    { return try_emplace(value);            }
+    NODISCARD bool try_push(value_type&& value)         { return try_emplace(std::move(value)); }
+
+    template<class... Args>
+    void emplace(Args&&... args);
+    void push(const value_type& value)  { emplace(value);               }
+    void push(value_type&& value)       { emplace(std::move(value));    }
+
+    template<class InputIterator>
+    size_type push_n(InputIterator first, size_type count);
+
+    /*** Consumer Side ***/
+    NODISCARD reference front();
+    bool pop();
+    NODISCARD bool try_pop(value_type& destination);
+
+    template<class OutputIterator>
+    size_type pop_n(OutputIterator destination, size_type count);
+
+    /*** Status Checkers ***/
+    // The result is only a snapshot when the other side is active
+    NODISCARD bool      empty() const       { return (0 == size()); }
+    NODISCARD size_type size()  const;
+    NODISCARD static constexpr size_type capacity() { return Capacity; }
+
+private:
+    // Constant used instead of std::hardware_destructive_interference_size, which is not provided by every standard library
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+    static constexpr size_type   INDEX_MASK      = Capacity - 1;
+
+    NODISCARD T* slot(size_type index) noexcept { return std::launder(reinterpret_cast<T*>(buffer + ((index & INDEX_MASK) * sizeof(T)))); }
+    NODISCARD void* rawSlot(size_type index) noexcept { return static_cast<void*>(buffer + ((index & INDEX_MASK) * sizeof(T))); }
+    NODISCARD size_type freeSlots(size_type wanted = 1);      // Producer side
+    NODISCARD size_type filledSlots(size_type wanted = 1);    // Consumer side
+
+    /*** Members ***/
+    // Consumer's line, the producer keeps a cached copy of the head to avoid touching this line on every push
+    alignas(CACHE_LINE_SIZE) std::atomic<size_type> head{0};    // Index of the front element
+    size_type cachedTail = 0;                                   // Consumer's last known tail
+
+    // Producer's line, the consumer keeps a cached copy of the tail to avoid touching this line on every pop
+    alignas(CACHE_LINE_SIZE) std::atomic<size_type> tail{0};    // Index after the back element
+    size_type cachedHead = 0;                                   // Producer's last known head
+
+    alignas(CACHE_LINE_SIZE) alignas(T) unsigned char buffer[Capacity * sizeof(T)];
+};
+
+/**
+ * @brief   Destructor
+ * @note    Must not be called while the producer or the consumer is still active.
+ */
+template<class T, std::size_t Capacity>
+SpscQueue<T, Capacity>::~SpscQueue()
+{
+    const size_type lastIndex = tail.load(std::memory_order_acquire);
+
+    for(size_type index = head.load(std::memory_order_relaxed); index != lastIndex; ++index)
+        slot(index)->~T();
+}
+
+/**
+ * @brief   Constructs a new element at the back if there is room for it
+ * @param   args    Arguments to be forwarded to the constructor of the new element
+ * @return  true    If the element is pushed
+ * @note    Producer side, the queue is left unchanged if the constructor throws.
+ */
+template<class T, std::size_t Capacity>
+template<class... Args>
+bool SpscQueue<T, Capacity>::try_emplace(Args&&... args)
+{
+    if(0 == freeSlots())
+        return false;
+
+    const size_type index = tail.load(std::memory_order_relaxed);
+
+    ::new(rawSlot(index)) T(std::forward<Args>(args)...);
+    tail.store(index + 1, std::memory_order_release);   // Publish the element
+
+    return true;
+}
+
+/**
+ * @brief   Constructs a new element at the back, waits for the consumer while the queue is full
+ * @param   args    Arguments to be forwarded to the constructor of the new element
+ * @note    Producer side, the arguments are not consumed until there is room for the element.
+ */
+template<class T, std::size_t Capacity>
+template<class... Args>
+void SpscQueue<T, Capacity>::emplace(Args&&... args)
+{
+    while(0 == freeSlots())
+        std::this_thread::yield();
+
+    const size_type index = tail.load(std::memory_order_relaxed);
+
+    ::new(rawSlot(index)) T(std::forward<Args>(args)...);
+    tail.store(index + 1, std::memory_order_release);   // Publish the element
+}
+
+/**
+ * @brief   Pushes up to the given number of elements with a single publication
+ * @param   first   Starting element of source
+ * @param   count   Maximum number of elements to be pushed
+ * @return  Number of pushed elements, limited by the free space
+ * @note    Producer side, the elements constructed before an exception are still published.
+ */
+template<class T, std::size_t Capacity>
+template<class InputIterator>
+typename SpscQueue<T, Capacity>::size_type SpscQueue<T, Capacity>::push_n(InputIterator first, size_type count)
+{
+    const size_type available   = freeSlots(count);
+    const size_type firstIndex  = tail.load(std::memory_order_relaxed);
+    const size_type lastIndex   = firstIndex + ((count < available) ? count : available);
+    size_type index = firstIndex;
+
+    try {
+        for( ; index != lastIndex; ++index, ++first)
+            ::new(rawSlot(index)) T(*first);
+    }catch(...){
+        tail.store(index, std::memory_order_release);
+
+        throw;  // Propagate exception
+    }
+
+    tail.store(lastIndex, std::memory_order_release);   // Publish the whole batch
+
+    return (lastIndex - firstIndex);
+}
+
+/**
+ * @brief   Returns a reference to the front element
+ * @return  lValue reference to the front element
+ * @throws  std::logic_error    If the queue is empty
+ * @note    Consumer side, the element stays valid until it is popped.
+ */
+template<class T, std::size_t Capacity>
+T& SpscQueue<T, Capacity>::front()
+{
+    if(0 == filledSlots())
+        throw std::logic_error("Queue is empty!");
+
+    return *slot(head.load(std::memory_order_relaxed));
+}
+
+/**
+ * @brief   Destroys the front element
+ * @return  false   If the queue was empty
+ * @note    Consumer side
+ */
+template<class T, std::size_t Capacity>
+bool SpscQueue<T, Capacity>::pop()
+{
+    if(0 == filledSlots())
+        return false;
+
+    const size_type index = head.load(std::memory_order_relaxed);
+
+    slot(index)->~T();
+    head.store(index + 1, std::memory_order_release);   // Hand the slot back to the producer
+
+    return true;
+}
+
+/**
+ * @brief   Moves the front element out and destroys it
+ * @param   destination Object to be assigned with the front element
+ * @return  false   If the queue was empty
+ * @note    Consumer side, the element is kept in the queue if the assignment throws.
+ */
+template<class T, std::size_t Capacity>
+bool SpscQueue<T, Capacity>::try_pop(value_type& destination)
+{
+    if(0 == filledSlots())
+        return false;
+
+    const size_type index = head.load(std::memory_order_relaxed);
+    T* element = slot(index);
+
+    destination = std::move(*element);
+    element->~T();
+    head.store(index + 1, std::memory_order_release);   // Hand the slot back to the producer
+
+    return true;
+}
+
+/**
+ * @brief   Moves out up to the given number of elements and releases their slots with a single publication
+ * @param   destination Output iterator to be assigned with the elements
+ * @param   count       Maximum number of elements to be popped
+ * @return  Number of popped elements, limited by the current size
+ * @note    Consumer side, the elements moved out before an exception are still popped.
+ */
+template<class T, std::size_t Capacity>
+template<class OutputIterator>
+typename SpscQueue<T, Capacity>::size_type SpscQueue<T, Capacity>::pop_n(OutputIterator destination, size_type count)
+{
+    const size_type available   = filledSlots(count);
+    const size_type firstIndex  = head.load(std::memory_order_relaxed);
+    const size_type lastIndex   = firstIndex + ((count < available) ? count : available);
+    size_type index = firstIndex;
+
+    try {
+        for( ; index != lastIndex; ++index, ++destination)
+        {
+            T* element = slot(index);
+
+            *destination = std::move(*element);
+            element->~T();
+        }
+    }catch(...){
+        head.store(index, std::memory_order_release);
+
+        throw;  // Propagate exception
+    }
+
+    head.store(lastIndex, std::memory_order_release);   // Release the whole batch
+
+    return (lastIndex - firstIndex);
+}
+
+/**
+ * @brief   Returns the number of elements
+ * @return  Number of elements at the time of the call
+ */
+template<class T, std::size_t Capacity>
+typename SpscQueue<T, Capacity>::size_type SpscQueue<T, Capacity>::size() const
+{
+    // Load the head first, so that the tail can never be seen behind it
+    const size_type currentHead = head.load(std::memory_order_acquire);
+    const size_type currentTail = tail.load(std::memory_order_acquire);
+
+    return (currentTail - currentHead);
+}
+
+/**
+ * @brief   Helper method for the producer to find the number of free slots
+ * @param   wanted  Number of slots needed by the caller
+ * @return  Number of free slots, the shared head is only loaded when the cached one shows less than wanted
+ */
+template<class T, std::size_t Capacity>
+typename SpscQueue<T, Capacity>::size_type SpscQueue<T, Capacity>::freeSlots(size_type wanted)
+{
+    const size_type currentTail = tail.load(std::memory_order_relaxed);
+
+    if((Capacity - (currentTail - cachedHead)) < wanted)
+        cachedHead = head.load(std::memory_order_acquire);
+
+    return Capacity - (currentTail - cachedHead);
+}
+
+/**
+ * @brief   Helper method for the consumer to find the number of filled slots
+ * @param   wanted  Number of elements needed by the caller
+ * @return  Number of filled slots, the shared tail is only loaded when the cached one shows less than wanted
+ */
+template<class T, std::size_t Capacity>
+typename SpscQueue<T, Capacity>::size_type SpscQueue<T, Capacity>::filledSlots(size_type wanted)
+{
+    const size_type currentHead = head.load(std::memory_order_relaxed);
+
+    if((cachedTail - currentHead) < wanted)
+        cachedTail = tail.load(std::memory_order_acquire);
+
+    return (cachedTail - currentHead);
+}
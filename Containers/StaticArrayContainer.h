@@ -0,0 +1,253 @@
+/**
+ * @file        StaticArrayContainer.h
+ * @details     A template container class with a compile-time fixed size.
+ *              Elements are stored inline, there is no heap allocation and no virtual dispatch.
+ *              All operations are constexpr, so that the arrays can be built and used at compile time.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *                               -> Fill(..) and Swap(..) are noexcept only if the element operations are, Swap(..) finds the swap of T.
+ *
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <ostream>              // For output streams
+#include <cstddef>              // For size_t
+#include <stdexcept>            // For exceptions
+#include <type_traits>          // For std::is_nothrow_copy_assignable_v, std::is_nothrow_swappable_v
+#include <utility>              // For std::swap
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Container Class ***/
+/* The class is an aggregate, so that it can be initialized with braces(e.g. StaticArray<int, 3> arr{1, 2, 3}).
+ * Missing initializers value-initialize the remaining elements. */
+template<class T, size_t N>
+class StaticArray{
+    static_assert(N != 0, "Size cannot be 0!");
+
+public:
+    /*** Operator Overloadings ***/
+    NODISCARD constexpr const T& operator[](const size_t index) const;    // Subscript operator for const objects returns rValue
+    NODISCARD constexpr T& operator[](const size_t index);                // Subscript operator for non-const objects returns lValue
+
+    NODISCARD constexpr bool operator==(const StaticArray& rightArr) const noexcept;      // Array comparison
+    NODISCARD constexpr bool operator!=(const StaticArray& rightArr) const noexcept;      // Array comparison by inequality
+
+    /*** Element Access ***/
+    NODISCARD constexpr T& at(const size_t position)               { return (*this)[position]; }    // Invoke subscript operator
+    NODISCARD constexpr const T& at(const size_t position) const   { return (*this)[position]; }    // Invoke subscript operator
+    NODISCARD constexpr T& First() noexcept             { return elements[0];       }   // Size is never zero
+    NODISCARD constexpr const T& First() const noexcept { return elements[0];       }   // Size is never zero
+    NODISCARD constexpr T& Last() noexcept              { return elements[N - 1];   }   // Size is never zero
+    NODISCARD constexpr const T& Last() const noexcept  { return elements[N - 1];   }   // Size is never zero
+
+    /*** Modifiers ***/
+    constexpr StaticArray& Fill(const T& fillValue) noexcept(std::is_nothrow_copy_assignable_v<T>);
+    constexpr StaticArray& Swap(StaticArray& anotherArray) noexcept(std::is_nothrow_swappable_v<T>);
+
+    /*** Lookup ***/
+    NODISCARD constexpr T* Find(const T& value);                // First equal element or end()
+    NODISCARD constexpr const T* Find(const T& value) const;    // First equal element or end()
+    NODISCARD constexpr size_t Count(const T& value) const;     // Number of equal elements
+    NODISCARD constexpr bool Contains(const T& value) const     { return (Find(value) != end()); }
+
+    /*** Status Checkers ***/
+    NODISCARD static constexpr size_t getSize() noexcept { return N; }
+
+    /*** Iterators ***/
+    /* Pointers can be used as iterator as the data structure of the container is completely linear */
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    constexpr iterator begin()                noexcept { return elements;       }
+    constexpr iterator end()                  noexcept { return elements + N;   }
+    constexpr const_iterator begin()  const   noexcept { return elements;       }
+    constexpr const_iterator end()    const   noexcept { return elements + N;   }
+    constexpr const_iterator cbegin() const   noexcept { return elements;       }
+    constexpr const_iterator cend()   const   noexcept { return elements + N;   }
+
+    /*** Members ***/
+    // Public only to keep the class an aggregate, use the member functions instead
+    T elements[N];
+};
+
+/**
+ * @brief   Subscript operator for rValue return
+ * @param   index   Index of element to be fetched
+ * @return  rValue reference to the data at given index
+ * @throws  std::range_error When given index is out of container range
+ */
+template<class T, size_t N>
+constexpr const T& StaticArray<T, N>::operator[](const size_t index) const
+{
+    if(index < N)       // Check for out-of-range random access
+        return elements[index];
+
+    throw std::range_error("Out-of-range exception occured!");
+}
+
+/**
+ * @brief   Subscript operator for lValue return
+ * @param   index   Index of element to be fetched
+ * @return  lValue reference to the data at given index
+ * @throws  std::range_error When given index is out of container range
+ */
+template<class T, size_t N>
+constexpr T& StaticArray<T, N>::operator[](const size_t index)
+{
+    if(index < N)       // Check for out-of-range random access
+        return elements[index];
+
+    throw std::range_error("Out-of-range exception occured!");
+}
+
+/**
+ * @brief   Overloaded comparison operator
+ * @param   rightArr Array to be compared against
+ * @return  true     If arrays are equal.
+ *          false    If any difference is detected.
+ * @note    The loop bound is a constant, the compiler can unroll it completely.
+ */
+template<class T, size_t N>
+constexpr bool StaticArray<T, N>::operator==(const StaticArray& rightArr) const noexcept
+{
+    for(size_t index = 0; index < N; ++index)
+        if(!(elements[index] == rightArr.elements[index]))
+            return false;
+
+    return true;
+}
+
+/**
+ * @brief   Overloaded incomparison operator
+ * @param   rightArr    Array to be compared against
+ * @return  true        If arrays are not equal
+ *          false       If arrays are equal
+ */
+template<class T, size_t N>
+constexpr bool StaticArray<T, N>::operator!=(const StaticArray& rightArr) const noexcept
+{   // Inequality operator returns the opposite of equality operator
+    return !(*this == rightArr);
+}
+
+/**
+ * @brief   Fills the array with the given value
+ * @param   fillValue Value to be used to fill the array
+ * @return  lValue reference to support cascaded calls
+ */
+template<class T, size_t N>
+constexpr StaticArray<T, N>& StaticArray<T, N>::Fill(const T& fillValue) noexcept(std::is_nothrow_copy_assignable_v<T>)
+{
+    for(size_t index = 0; index < N; ++index)
+        elements[index] = fillValue;
+
+    return *this;
+}
+
+/**
+ * @brief   Swaps the content of two different array
+ * @param   anotherArray Array to be swapped with this
+ * @return  lValue reference to support cascaded calls
+ * @note    Elements are swapped one by one as they are stored inline, a swap(..) found by argument dependent lookup is preferred.
+ * @note    Usable at compile time from C++20 on, where std::swap(..) is constexpr.
+ */
+template<class T, size_t N>
+constexpr StaticArray<T, N>& StaticArray<T, N>::Swap(StaticArray& anotherArray) noexcept(std::is_nothrow_swappable_v<T>)
+{
+    using std::swap;
+
+    for(size_t index = 0; index < N; ++index)
+        swap(elements[index], anotherArray.elements[index]);
+
+    return *this;
+}
+
+/**
+ * @brief   Finds the first element which is equal to the given value
+ * @param   value   Value to be searched
+ * @return  Address of the found element, end() if not found
+ */
+template<class T, size_t N>
+constexpr T* StaticArray<T, N>::Find(const T& value)
+{
+    for(size_t index = 0; index < N; ++index)
+        if(elements[index] == value)
+            return elements + index;
+
+    return end();
+}
+
+/**
+ * @brief   Finds the first element which is equal to the given value
+ * @param   value   Value to be searched
+ * @return  Address of the found element, end() if not found
+ */
+template<class T, size_t N>
+constexpr const T* StaticArray<T, N>::Find(const T& value) const
+{
+    for(size_t index = 0; index < N; ++index)
+        if(elements[index] == value)
+            return elements + index;
+
+    return end();
+}
+
+/**
+ * @brief   Counts the elements which are equal to the given value
+ * @param   value   Value to be counted
+ * @return  Number of matching elements
+ */
+template<class T, size_t N>
+constexpr size_t StaticArray<T, N>::Count(const T& value) const
+{
+    size_t matchCount = 0;
+
+    for(size_t index = 0; index < N; ++index)
+        if(elements[index] == value)
+            ++matchCount;
+
+    return matchCount;
+}
+
+/**
+ * @brief   Builds an array by calling the generator for each index, usable for compile-time lookup tables
+ * @param   generator   Callable object taking the index and returning the element
+ * @return  Generated array
+ * @note    Element type must be default constructible.
+ */
+template<class T, size_t N, class Generator>
+NODISCARD constexpr StaticArray<T, N> GenerateStaticArray(Generator generator)
+{
+    StaticArray<T, N> result{};
+
+    for(size_t index = 0; index < N; ++index)
+        result.elements[index] = generator(index);
+
+    return result;
+}
+
+/**
+ * @brief   Overloaded output instertion operator
+ * @param   stream  Destination output stream for insertion
+ * @param   array   Array to be inserted
+ * @return  ostream reference to support cascaded insertions.
+ */
+template<class T, size_t N>
+std::ostream& operator<<(std::ostream& stream, const StaticArray<T, N>& array)
+{
+    for(const T& element : array)
+        stream << element << " ";
+
+    return stream;  // Return reference to support cascade streaming
+}
@@ -0,0 +1,266 @@
+/**
+ * @file        TextWriter.h
+ * @details     A buffered text writer rendering values and whole containers into a reusable buffer.
+ *              Arithmetic values are formatted with std::to_chars, the buffer is handed to the stream in large blocks.
+ *              Includes an output iterator adapter with the ergonomics of std::ostream_iterator.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *                               -> Wide characters and texts rejected at compile time instead of being written as numbers.
+ *
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <charconv>             // std::to_chars
+#include <cstddef>              // std::size_t, std::ptrdiff_t
+#include <cstring>              // std::memcpy
+#include <iterator>             // std::output_iterator_tag
+#include <memory>               // std::unique_ptr
+#include <ostream>              // std::ostream
+#include <string_view>          // std::string_view
+#include <type_traits>          // Type traits
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Writer Class ***/
+/* Values are appended to the buffer until it is full, then the whole buffer is written to the stream at once.
+ * Texts longer than the buffer bypass it. Types other than the arithmetic and the text types are inserted into the stream
+ * with their own operator<<, after the buffered text is flushed to keep the order.
+ * Floating point values are written in their shortest round-trip form, instead of the 6 digit default of the streams.
+ * The remaining text is flushed by the destructor, errors are reported by the state of the stream. */
+class TextWriter {
+public:
+    static constexpr std::size_t DEFAULT_BUFFER_SIZE = 64 * 1024;
+
+    /*** Constructors and Destructor ***/
+    explicit TextWriter(std::ostream& stream, const std::size_t bufferSize = DEFAULT_BUFFER_SIZE);
+    TextWriter(const TextWriter&) = delete;                 // Two writers would interleave the same stream
+    TextWriter& operator=(const TextWriter&) = delete;
+    ~TextWriter();
+
+    /*** Writing ***/
+    template<class T>
+    TextWriter& write(const T& value);                                                  // Formats a single value
+
+    template<class Range>
+    TextWriter& writeAll(const Range& range, const std::string_view separator = " ");  // Formats all elements with a separator in between
+
+    template<class T>
+    TextWriter& operator<<(const T& value) { return write(value); }
+
+    void flush();   // Hands the buffered text and then the stream content to the destination
+
+    /*** Status Checkers ***/
+    NODISCARD std::size_t bufferedBytes()   const noexcept { return used;           }
+    NODISCARD std::size_t capacity()        const noexcept { return bufferCapacity; }
+
+private:
+    static constexpr std::size_t MAX_NUMBER_LENGTH = 128;   // Longer than any number rendered by std::to_chars
+
+    // Character types without a narrow representation, the streams would write them as numbers or addresses
+    template<class C>
+    static constexpr bool isWideCharacter = std::is_same_v<C, wchar_t> || std::is_same_v<C, char16_t> || std::is_same_v<C, char32_t>
+#if defined(__cpp_char8_t)
+                                            || std::is_same_v<C, char8_t>
+#endif
+                                            ;
+
+    void writeText(const std::string_view text);
+    void flushBuffer();             // Writes the buffered text to the stream without flushing the stream
+
+    template<class T>
+    void writeNumber(const T value);
+
+    /*** Members ***/
+    std::ostream&           stream;
+    const std::size_t       bufferCapacity;
+    std::unique_ptr<char[]> buffer;
+    std::size_t             used = 0;   // Number of buffered characters
+};
+
+/**
+ * @brief   Constructs a writer with its own buffer
+ * @param   stream      Destination stream
+ * @param   bufferSize  Size of the buffer in characters, at least enough for a single number
+ */
+inline TextWriter::TextWriter(std::ostream& stream, const std::size_t bufferSize)
+: stream(stream), bufferCapacity((bufferSize < MAX_NUMBER_LENGTH) ? MAX_NUMBER_LENGTH : bufferSize),
+  buffer(new char[bufferCapacity])
+{ /* No operation */ }
+
+/**
+ * @brief   Destructor, writes the remaining text to the stream
+ * @note    Exceptions of the stream are not propagated, its state reports the failure.
+ */
+inline TextWriter::~TextWriter()
+{
+    try {
+        flushBuffer();
+    }catch(...){
+        // Destructors must not throw, the stream has already recorded the failure
+    }
+}
+
+/**
+ * @brief   Formats a single value into the buffer
+ * @param   value   Value to be written
+ * @return  lValue reference to the writer to support cascaded calls
+ * @note    bool is written as 1 or 0 and the character types as characters, as the streams do by default.
+ * @note    Wide characters and pointers to them are rejected at compile time, they must be converted to char first.
+ */
+template<class T>
+TextWriter& TextWriter::write(const T& value)
+{
+    static_assert(!isWideCharacter<std::remove_cv_t<std::remove_pointer_t<std::decay_t<T>>>>, "Wide characters cannot be written as narrow text!");
+
+    if constexpr(std::is_same_v<T, bool>)
+        writeText(value ? "1" : "0");
+    else if constexpr(std::is_same_v<T, char> || std::is_same_v<T, signed char> || std::is_same_v<T, unsigned char>)
+        writeText(std::string_view(reinterpret_cast<const char*>(&value), 1));
+    else if constexpr(std::is_integral_v<T>)
+        writeNumber(value);
+#if defined(__cpp_lib_to_chars)    // Floating point conversions are available
+    else if constexpr(std::is_floating_point_v<T>)
+        writeNumber(value);
+#endif
+    else if constexpr(std::is_convertible_v<const T&, std::string_view>)
+        writeText(std::string_view(value));
+    else
+    {
+        // Formatted by the stream, the buffered text must precede it
+        flushBuffer();
+        stream << value;
+    }
+
+    return *this;
+}
+
+/**
+ * @brief   Formats all elements of a range into the buffer
+ * @param   range       Any range usable in a range-based for loop (e.g. Vector, List, Array)
+ * @param   separator   Text written between two elements, not after the last one
+ * @return  lValue reference to the writer to support cascaded calls
+ */
+template<class Range>
+TextWriter& TextWriter::writeAll(const Range& range, const std::string_view separator)
+{
+    bool isFirst = true;
+
+    for(const auto& element : range)
+    {
+        if(!isFirst)
+            writeText(separator);
+
+        write(element);
+        isFirst = false;
+    }
+
+    return *this;
+}
+
+/**
+ * @brief   Writes the buffered text to the stream and flushes the stream
+ */
+inline void TextWriter::flush()
+{
+    flushBuffer();
+    stream.flush();
+}
+
+/**
+ * @brief   Appends a text to the buffer, the texts longer than the buffer are written directly
+ * @param   text    Text to be written
+ */
+inline void TextWriter::writeText(const std::string_view text)
+{
+    if(text.size() > (bufferCapacity - used))
+    {
+        flushBuffer();
+
+        if(text.size() > bufferCapacity)
+        {
+            stream.write(text.data(), std::streamsize(text.size()));
+            return;
+        }
+    }
+
+    std::memcpy(buffer.get() + used, text.data(), text.size());
+    used += text.size();
+}
+
+/**
+ * @brief   Writes the buffered text to the stream in a single call
+ */
+inline void TextWriter::flushBuffer()
+{
+    if(0 != used)
+    {
+        stream.write(buffer.get(), std::streamsize(used));
+        used = 0;
+    }
+}
+
+/**
+ * @brief   Renders an arithmetic value directly into the buffer
+ * @param   value   Value to be written
+ */
+template<class T>
+void TextWriter::writeNumber(const T value)
+{
+    if((bufferCapacity - used) < MAX_NUMBER_LENGTH)
+        flushBuffer();
+
+    char* const first = buffer.get() + used;
+    const std::to_chars_result result = std::to_chars(first, first + MAX_NUMBER_LENGTH, value);
+
+    used += std::size_t(result.ptr - first);
+}
+
+/*** Iterator Adapter ***/
+/* Drop-in replacement of std::ostream_iterator writing through a TextWriter.
+ * Copies of the iterator share the writer, as the algorithms take and return the iterators by value. */
+template<class T>
+class TextWriterIterator {
+public:
+    using iterator_category = std::output_iterator_tag;
+    using value_type        = void;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = void;
+    using reference         = void;
+
+    /**
+     * @brief   Constructs an iterator writing through the given writer
+     * @param   writer      Writer which buffers the output, must outlive the iterator
+     * @param   delimiter   Text written after each element, nothing if nullptr
+     */
+    TextWriterIterator(TextWriter& writer, const char* delimiter = nullptr) : writer(&writer), delimiter(delimiter)
+    { /* No operation */ }
+
+    TextWriterIterator& operator=(const T& value)
+    {
+        writer->write(value);
+
+        if(nullptr != delimiter)
+            writer->write(delimiter);
+
+        return *this;
+    }
+
+    NODISCARD TextWriterIterator& operator*()   { return *this; }   // No operation, as in std::ostream_iterator
+    TextWriterIterator& operator++()            { return *this; }
+    TextWriterIterator& operator++(int)         { return *this; }
+
+private:
+    TextWriter* writer;
+    const char* delimiter;
+};
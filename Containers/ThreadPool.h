@@ -0,0 +1,454 @@
+/**
+ * @file        ThreadPool.h
+ * @details     A work-stealing thread pool for fork-join parallelism.
+ *              Each worker has its own task deque, idle workers steal from the others.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *                             -> Worker deques replaced by lock-free Chase-Lev deques.
+ *                             -> submit(..) added, returning a future of the result.
+ *                             -> parallel_for(..) splits the range recursively, thieves split the stolen halves further.
+ *                             -> Optional pinning of the workers to the cores.
+ *                             -> Pending tasks counted before the push, started workers joined if the construction fails.
+ *
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include "ConcurrentQueueContainer.h"   // ConcurrentQueue
+#include "WorkStealingDeque.h"          // WorkStealingDeque
+#include <atomic>               // std::atomic
+#include <condition_variable>   // std::condition_variable
+#include <cstddef>              // std::size_t
+#include <exception>            // std::exception_ptr
+#include <future>               // std::future, std::packaged_task
+#include <memory>               // std::unique_ptr
+#include <mutex>                // std::mutex
+#include <thread>               // std::thread
+#include <tuple>                // std::tuple, std::apply
+#include <type_traits>          // std::decay_t, std::invoke_result_t
+#include <utility>              // std::move, std::forward
+#include <vector>               // std::vector
+
+#if defined(__linux__)
+#include <pthread.h>            // pthread_setaffinity_np
+#include <sched.h>              // sched_getaffinity, cpu_set_t
+#endif
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Scheduler Class ***/
+/* Tasks pushed from a worker go to the bottom of its own deque, the owner pops from the bottom(LIFO)
+ * and thieves take from the top(FIFO). Tasks pushed from the other threads go to a shared injection queue.
+ * Threads waiting for a parallel_for(..) run pending tasks instead of blocking, so that nested parallelism
+ * cannot deadlock the pool. */
+class ThreadPool {
+public:
+    /*** Constructors and Destructor ***/
+    explicit ThreadPool(std::size_t threadCount = std::thread::hardware_concurrency(), bool pinToCores = false);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    NODISCARD static ThreadPool& global();  // Pool shared by the whole process, sized by the hardware
+
+    /*** Scheduling ***/
+    template<class Function>
+    void execute(Function&& function);      // Fire and forget, exceptions leaving the task terminate the program
+
+    template<class Function, class... Args>
+    NODISCARD std::future<std::invoke_result_t<std::decay_t<Function>, std::decay_t<Args>...>> submit(Function&& function, Args&&... args);
+
+    template<class Body>
+    void parallel_for(std::size_t first, std::size_t last, std::size_t grainSize, Body&& body);
+
+    /*** Status Checkers ***/
+    NODISCARD std::size_t size() const noexcept { return threads.size(); }
+
+private:
+    struct TaskBase {
+        virtual ~TaskBase() = default;
+        virtual void run() = 0;
+    };
+
+    template<class Function>
+    struct TaskNode final : TaskBase {
+        template<class F>
+        explicit TaskNode(F&& function) : function(std::forward<F>(function)) { /* No operation */ }
+
+        void run() override { function(); }
+
+        Function function;
+    };
+
+    struct Worker {
+        WorkStealingDeque<TaskBase*> tasks;     // Pushed and popped only by the owner worker
+    };
+
+    template<class Body>
+    struct RangeState {
+        RangeState(Body& body, const std::size_t grainSize) : body(body), grainSize(grainSize) { /* No operation */ }
+
+        Body&                       body;
+        const std::size_t           grainSize;
+        std::atomic<std::size_t>    pendingRanges{1};
+        std::exception_ptr          firstException;
+        std::mutex                  exceptionMutex;
+    };
+
+    void schedule(TaskBase* task);
+    void stopWorkers() noexcept;            // Lets the workers finish the remaining tasks and joins them
+    NODISCARD bool tryRunOne();             // Runs a local, an injected or a stolen task
+    void workerLoop(std::size_t index);
+
+    template<class Body>
+    void runRange(RangeState<Body>& state, std::size_t begin, std::size_t end);
+
+    static void runTask(TaskBase* task) noexcept;
+    static void pinToCore(std::thread& thread, std::size_t index);
+
+    /*** Members ***/
+    std::vector<std::unique_ptr<Worker>>    workers;
+    std::vector<std::thread>                threads;
+    ConcurrentQueue<TaskBase*>              injectedTasks;          // Tasks submitted by the non-worker threads
+    std::atomic<std::size_t>                pendingTasks{0};
+    std::atomic<std::size_t>                sleepingWorkers{0};     // Submissions skip the notification while all workers are awake
+    std::mutex                              sleepMutex;
+    std::condition_variable                 wakeUp;
+    bool                                    stopping = false;       // Guarded by the sleep mutex
+
+    // Identity of the calling thread, set only for the worker threads
+    inline static thread_local ThreadPool*  currentPool     = nullptr;
+    inline static thread_local std::size_t  currentIndex    = 0;
+};
+
+/**
+ * @brief   Starts the worker threads
+ * @param   threadCount Number of workers, at least one worker is started
+ * @param   pinToCores  Binds each worker to a single core, in the order of the cores the process may run on
+ * @throws  std::system_error   If a thread cannot be started, the already started workers are joined first
+ * @note    Pinning is supported only on Linux and is ignored elsewhere.
+ */
+inline ThreadPool::ThreadPool(std::size_t threadCount, bool pinToCores)
+{
+    if(0 == threadCount)
+        threadCount = 1;
+
+    workers.reserve(threadCount);
+    for(std::size_t index = 0; index < threadCount; ++index)
+        workers.push_back(std::make_unique<Worker>());
+
+    threads.reserve(threadCount);
+
+    try {
+        for(std::size_t index = 0; index < threadCount; ++index)
+        {
+            threads.emplace_back([this, index] { workerLoop(index); });
+
+            if(pinToCores)
+                pinToCore(threads.back(), index);
+        }
+    }catch(...){
+        // The destructor is not called for a partially constructed pool, running workers would refer to a dead one
+        stopWorkers();
+        throw;  // Propagate exception
+    }
+}
+
+/**
+ * @brief   Runs the remaining tasks and joins the worker threads
+ */
+inline ThreadPool::~ThreadPool()
+{
+    stopWorkers();
+}
+
+/**
+ * @brief   Returns the process wide pool
+ * @return  lValue reference to the pool, created at the first call
+ */
+inline ThreadPool& ThreadPool::global()
+{
+    static ThreadPool pool;
+
+    return pool;
+}
+
+/**
+ * @brief   Schedules a function without a way to wait for it
+ * @param   function    Callable object without parameters
+ */
+template<class Function>
+void ThreadPool::execute(Function&& function)
+{
+    schedule(new TaskNode<std::decay_t<Function>>(std::forward<Function>(function)));
+}
+
+/**
+ * @brief   Schedules a function and returns a future of its result
+ * @param   function    Callable object
+ * @param   args        Arguments to be stored and passed to the function
+ * @return  Future of the result, exceptions thrown by the function are rethrown by the future
+ * @note    Waiting for the future inside a task blocks the worker, prefer parallel_for(..) for nested parallelism.
+ */
+template<class Function, class... Args>
+std::future<std::invoke_result_t<std::decay_t<Function>, std::decay_t<Args>...>> ThreadPool::submit(Function&& function, Args&&... args)
+{
+    using Result = std::invoke_result_t<std::decay_t<Function>, std::decay_t<Args>...>;
+
+    std::packaged_task<Result()> task(
+        [function = std::forward<Function>(function), arguments = std::make_tuple(std::forward<Args>(args)...)]() mutable {
+            return std::apply(std::move(function), std::move(arguments));
+        });
+
+    std::future<Result> result = task.get_future();
+
+    execute(std::move(task));
+
+    return result;
+}
+
+/**
+ * @brief   Runs the body over the index range in parallel and waits for the completion
+ * @param   first       Starting index
+ * @param   last        Ending index(excluded)
+ * @param   grainSize   Maximum number of indexes given to a single call of the body, 0 selects it automatically
+ * @param   body        Callable object taking a subrange as (begin, end)
+ * @throws  The first exception thrown by the body, after all subranges are completed
+ * @note    The calling thread runs a subrange itself and helps the workers while waiting.
+ */
+template<class Body>
+void ThreadPool::parallel_for(std::size_t first, std::size_t last, std::size_t grainSize, Body&& body)
+{
+    if(first >= last)
+        return;
+
+    const std::size_t length = last - first;
+
+    if(0 == grainSize)  // A few subranges per worker balances the load without too much scheduling
+        grainSize = (length + (size() * 4) - 1) / (size() * 4);
+
+    if(length <= grainSize)
+    {
+        body(first, last);
+        return;
+    }
+
+    RangeState<std::remove_reference_t<Body>> state(body, grainSize);
+
+    runRange(state, first, last);
+
+    // Help the workers instead of blocking
+    while(0 != state.pendingRanges.load(std::memory_order_acquire))
+        if(!tryRunOne())
+            std::this_thread::yield();
+
+    if(state.firstException)
+        std::rethrow_exception(state.firstException);
+}
+
+/**
+ * @brief   Splits off the upper halves of the range as tasks and runs the body on the remaining part
+ * @param   state   Shared state of the parallel_for(..) call
+ * @param   begin   Starting index of the range
+ * @param   end     Ending index of the range(excluded)
+ * @note    A stolen half is split again by the thief, so that the work spreads in logarithmic steps.
+ */
+template<class Body>
+void ThreadPool::runRange(RangeState<Body>& state, std::size_t begin, std::size_t end)
+{
+    try {
+        while((end - begin) > state.grainSize)
+        {
+            const std::size_t middle = begin + ((end - begin) / 2);
+
+            state.pendingRanges.fetch_add(1, std::memory_order_relaxed);
+
+            try {
+                execute([this, &state, middle, end] { runRange(state, middle, end); });
+            }catch(...){
+                state.pendingRanges.fetch_sub(1, std::memory_order_relaxed);
+                throw;  // Propagate exception
+            }
+
+            end = middle;
+        }
+
+        state.body(begin, end);
+    }catch(...){
+        std::lock_guard<std::mutex> lock(state.exceptionMutex);
+
+        if(!state.firstException)
+            state.firstException = std::current_exception();
+    }
+
+    state.pendingRanges.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+/**
+ * @brief   Pushes a task and wakes up a sleeping worker if there is any
+ * @param   task    Task to be scheduled, owned by the pool afterwards
+ */
+inline void ThreadPool::schedule(TaskBase* task)
+{
+    // Counted before the push, a thief may take and uncount the task before this thread continues
+    pendingTasks.fetch_add(1, std::memory_order_seq_cst);
+
+    try {
+        if(this == currentPool)
+            workers[currentIndex]->tasks.push(task);
+        else
+            injectedTasks.push(task);
+    }catch(...){
+        pendingTasks.fetch_sub(1, std::memory_order_relaxed);
+        delete task;
+        throw;  // Propagate exception
+    }
+
+    // A worker registers itself as sleeping before checking the pending tasks, so that one of the two sides sees the other
+    if(0 != sleepingWorkers.load(std::memory_order_seq_cst))
+    {
+        { std::lock_guard<std::mutex> lock(sleepMutex); }
+        wakeUp.notify_one();
+    }
+}
+
+/**
+ * @brief   Stops the started workers once the remaining tasks are run and joins them
+ */
+inline void ThreadPool::stopWorkers() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+
+    wakeUp.notify_all();
+
+    for(std::thread& thread : threads)
+        thread.join();
+}
+
+/**
+ * @brief   Runs a single task, taken from the own deque, the injection queue or another worker in this order
+ * @return  true    If a task was run
+ */
+inline bool ThreadPool::tryRunOne()
+{
+    if(0 == pendingTasks.load(std::memory_order_acquire))
+        return false;
+
+    const bool isWorker = (this == currentPool);
+    TaskBase* task      = nullptr;
+    bool found          = (isWorker && workers[currentIndex]->tasks.pop(task)) || injectedTasks.try_pop(task);
+
+    // Steal from the others, starting from the next worker to spread the thieves
+    const std::size_t startIndex = isWorker ? (currentIndex + 1) : 0;
+
+    for(std::size_t offset = 0; !found && (offset < workers.size()); ++offset)
+    {
+        const std::size_t victimIndex = (startIndex + offset) % workers.size();
+
+        if(!isWorker || (victimIndex != currentIndex))
+            found = workers[victimIndex]->tasks.steal(task);
+    }
+
+    if(!found)
+        return false;
+
+    pendingTasks.fetch_sub(1, std::memory_order_acq_rel);
+    runTask(task);
+
+    return true;
+}
+
+/**
+ * @brief   Main loop of a worker thread
+ * @param   index   Index of the worker
+ */
+inline void ThreadPool::workerLoop(std::size_t index)
+{
+    currentPool     = this;
+    currentIndex    = index;
+
+    for(;;)
+    {
+        if(tryRunOne())
+            continue;
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+
+        sleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+        wakeUp.wait(lock, [this] { return stopping || (0 != pendingTasks.load(std::memory_order_seq_cst)); });
+        sleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+
+        if(stopping && (0 == pendingTasks.load(std::memory_order_acquire)))
+            return;
+    }
+}
+
+/**
+ * @brief   Runs and releases a task
+ * @param   task    Task to be run
+ * @note    Being noexcept, an exception leaving the task terminates the program.
+ */
+inline void ThreadPool::runTask(TaskBase* task) noexcept
+{
+    std::unique_ptr<TaskBase> owner(task);
+
+    owner->run();
+}
+
+/**
+ * @brief   Binds a worker thread to a single core
+ * @param   thread  Worker thread
+ * @param   index   Index of the worker, wrapped around the available cores
+ * @note    Failures are ignored, an unpinned worker is still functional.
+ */
+inline void ThreadPool::pinToCore(std::thread& thread, std::size_t index)
+{
+#if defined(__linux__)
+    cpu_set_t allowedCores;
+    CPU_ZERO(&allowedCores);
+
+    if(0 != sched_getaffinity(0, sizeof(allowedCores), &allowedCores))
+        return;
+
+    const std::size_t coreCount = std::size_t(CPU_COUNT(&allowedCores));
+
+    if(0 == coreCount)
+        return;
+
+    // Find the core with the wrapped index among the allowed ones
+    std::size_t remaining = index % coreCount;
+
+    for(std::size_t core = 0; core < CPU_SETSIZE; ++core)
+    {
+        if(!CPU_ISSET(core, &allowedCores))
+            continue;
+
+        if(0 != remaining--)
+            continue;
+
+        cpu_set_t selectedCore;
+        CPU_ZERO(&selectedCore);
+        CPU_SET(core, &selectedCore);
+
+        pthread_setaffinity_np(thread.native_handle(), sizeof(selectedCore), &selectedCore);
+        return;
+    }
+#else
+    (void)thread;
+    (void)index;
+#endif
+}
@@ -0,0 +1,1447 @@
+/**
+ * @file        UnrolledListContainer.h
+ * @details     A template container class with an underlying unrolled doubly linked list structure.
+ *              Each node keeps up to K elements in place, so that the traversals mostly scan contiguous memory
+ *              and the link overhead is shared by K elements. The interface follows the List container.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *                               -> Sort(..) allocates the nodes before moving the elements, no element is lost if it throws.
+ *
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <algorithm>            // std::stable_sort, std::equal, std::is_sorted
+#include <cstddef>              // std::size_t, std::ptrdiff_t
+#include <functional>           // std::less
+#include <initializer_list>     // std::initializer_list
+#include <iterator>             // std::bidirectional_iterator_tag
+#include <memory>               // std::allocator, std::allocator_traits
+#include <new>                  // std::launder
+#include <ostream>              // For stream operators
+#include <stdexcept>            // std::logic_error
+#include <type_traits>          // std::conditional_t, std::enable_if_t, std::is_integral_v
+#include <utility>              // std::move, std::forward, std::swap
+#include "ContainerStats.h"     // CONTAINER_STATS_RECORD, ContainerStats::Snapshot
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#if __cplusplus >= 202002L
+#define NO_UNIQUE_ADDR [[no_unique_address]]
+#else
+#define NO_UNIQUE_ADDR
+#endif  // C++20 check
+#else
+#define NODISCARD
+#endif  // C++17 check
+
+/*** Container Class ***/
+/* Elements of a node occupy the slots [beginIdx, endIdx) of its inline storage.
+ * Appending fills the last node towards its end and prepending fills the first node towards its beginning,
+ * so that neither of them shifts the existing elements. New nodes are allocated only when the boundary node is full.
+ * Removals compact the elements inside their nodes and the neighbouring nodes are merged when they fit into one.
+ * Iterators are invalidated by any modifier, elements are not address stable as they are moved during the compaction. */
+template<class T, std::size_t K = ((sizeof(T) <= 32) ? (256 / sizeof(T)) : 8), class Allocator = std::allocator<T>>
+class UnrolledList {
+    static_assert(K >= 2, "At least two elements per node are required!");
+
+private:
+    /*** Forward declarations ***/
+    struct BlockNode;
+
+    template<bool IS_CONST>
+    class basic_iterator;
+
+public:
+    /*** C++ Standard Named Requirements for Containers ***/
+    using value_type      = T          ;
+    using size_type       = std::size_t;
+    using reference       = T&         ;
+    using const_reference = const T&   ;
+    using pointer         = T*         ;
+    using const_pointer   = const T*   ;
+    using difference_type = ptrdiff_t  ;
+    using allocator_type  = Allocator  ;
+    using iterator        = basic_iterator<false>;
+    using const_iterator  = basic_iterator<true>;
+
+    static constexpr size_type NODE_CAPACITY = K;   // Elements per node
+
+    /*** Constructors and Destructors ***/
+    UnrolledList() = default;                                   // Default constructor
+    explicit UnrolledList(const allocator_type& alloc);         // Construct with an allocator object
+    UnrolledList(const size_type n);                            // Construct with n elements initially
+
+    template<class... Args>
+    UnrolledList(const size_type n, Args&&... args);            // Construct with n elements initially using the arguments
+
+    template<class AnotherIteratorType, class = std::enable_if_t<!std::is_integral_v<AnotherIteratorType>>>
+    UnrolledList(AnotherIteratorType begin, AnotherIteratorType end);  // Range constructor
+
+    UnrolledList(const UnrolledList& anotherList);                      // Copy constructor
+    UnrolledList(UnrolledList&& anotherList) noexcept;                  // Move constructor
+    UnrolledList(std::initializer_list<T> initializerList);             // Initializer list constructor
+
+    virtual ~UnrolledList();    // Destructor
+
+    /*** Element Access ***/
+    NODISCARD const_reference First() const; // Get the first data as a constant lValue
+    NODISCARD const_reference Last() const;  // Get the last data as a constant lValue
+    NODISCARD reference First();             // Get the first data as an lValue
+    NODISCARD reference Last();              // Get the last data as an lValue
+
+    /*** Modifiers ***/
+    UnrolledList& Append(const_reference data);     // Add after the last element
+    UnrolledList& Prepend(const_reference data);    // Add before the first element
+
+    template <class... Args>
+    UnrolledList& EmplaceAppend(Args&&... args);    // Constructs the element inplace after the last element
+    template <class... Args>
+    UnrolledList& EmplacePrepend(Args&&... args);   // Constructs the element inplace before the first element
+
+    template<class RuleT>
+    UnrolledList& RemoveIf(const RuleT& Predicate); // Remove all fulfilling the condition of predicate
+
+    UnrolledList& RemoveFirst();                            // Remove the first element
+    UnrolledList& RemoveLast();                             // Remove the last element
+    UnrolledList& RemoveIf(const_reference data);           // Remove all samples of a specific data
+    UnrolledList& RemoveFirstOf(const_reference data);      // Remove the first sample of a specific data
+    UnrolledList& RemoveLastOf(const_reference data);       // Remove the last sample of a specific data
+    UnrolledList& RemoveIfNot(const_reference data);        // Remove all samples which are not of a specific data
+    UnrolledList& RemoveFirstNotOf(const_reference data);   // Remove the first sample that is not the given data
+    UnrolledList& RemoveLastNotOf(const_reference data);    // Remove the last sample that is not the given data
+    UnrolledList& EraseAll();                               // Remove all elements
+    void ReplaceAllWith(const_reference oldData, const_reference newData);
+    void ReplaceFirstWith(const_reference oldData, const_reference newData);
+    void ReplaceLastWith(const_reference oldData, const_reference newData);
+
+    /*** Operations ***/
+    void Swap(UnrolledList& anotherList) noexcept;                              // Exchanges the content of the list by the content of another list
+    void Resize(const size_type newSize, const_reference data = value_type());  // Resizes the list so that it contains newSize of elements
+    void MakeUnique();                                                          // Remove duplicate values
+    void Sort();                                                                // Sorts in ascending order
+    template<class Compare>
+    void Sort(Compare comp);                                                    // Sorts in the order given by the comparator
+    void Merge(UnrolledList& anotherList);                                      // Merges two sorted lists
+    template<class Compare>
+    void Merge(UnrolledList& anotherList, Compare comp);                        // Merges two lists sorted by the comparator
+    void Concatenate(UnrolledList& anotherList);                                // Concatenates two lists
+
+    /*** Status Checkers ***/
+    NODISCARD bool isEmpty() const              { return (numberOfElements == 0);                            }
+    NODISCARD size_type GetNodeCount() const    { return numberOfElements;                                   }  // Number of elements, named after List::GetNodeCount
+    NODISCARD size_type GetBlockCount() const   { return numberOfBlocks;                                     }  // Number of nodes holding the elements
+    NODISCARD bool isSorted() const             { return (!isEmpty() && std::is_sorted(cbegin(), cend()));   }
+
+    /*** Allocator ***/
+    NODISCARD allocator_type get_allocator() const { return allocator; }
+
+    /*** Statistics ***/
+    NODISCARD static ContainerStats::Snapshot stats() noexcept { return ContainerStats::snapshotOf<UnrolledList>(); }  // Zeros unless enabled
+
+    /*** Operator Overloadings ***/
+    NODISCARD bool operator==(const UnrolledList& anotherList) const    // Compare two lists element by element
+    { return (GetNodeCount() == anotherList.GetNodeCount()) && std::equal(cbegin(), cend(), anotherList.cbegin()); }
+    NODISCARD bool operator!=(const UnrolledList& anotherList) const    // Compare two lists by inequality
+    { return !operator==(anotherList); }
+
+    UnrolledList& operator=(const UnrolledList& sourceList);            // Copy assignment operator
+    UnrolledList& operator=(UnrolledList&& sourceList);                 // Move assignment operator
+    UnrolledList& operator=(std::initializer_list<T> initializerList);  // Copy assignment operator for transaction from initializer lists
+
+    /*** Iterators ***/
+    NODISCARD const_iterator  cbegin()    const   { return const_iterator(this, firstPtr, firstIndex());  }    // Constant iterator starting from the first element
+    NODISCARD const_iterator  cend()      const   { return const_iterator(this, nullptr, 0);              }    // Constant iterator starting from past the end
+    NODISCARD iterator        begin()             { return iterator(this, firstPtr, firstIndex());        }    // Iterator starting from the first element, the elements may be modified
+    NODISCARD const_iterator  begin()     const   { return cbegin();                                      }    // Iterator starting from the first element
+    NODISCARD iterator        end()               { return iterator(this, nullptr, 0);                    }    // Iterator starting from past the end, the elements may be modified
+    NODISCARD const_iterator  end()       const   { return cend();                                        }    // Constant iterator starting from past the end
+
+private:
+    struct BlockNode {
+        explicit BlockNode(const size_type startIdx) noexcept : beginIdx(startIdx), endIdx(startIdx)
+        { /* Empty constructor */ }
+
+        NODISCARD T* slot(const size_type idx) noexcept                 { return reinterpret_cast<T*>(storage + (idx * sizeof(T)));                     }   // Raw slot
+        NODISCARD T* element(const size_type idx) noexcept              { return std::launder(slot(idx));                                               }   // Living element
+        NODISCARD const T* element(const size_type idx) const noexcept  { return std::launder(reinterpret_cast<const T*>(storage + (idx * sizeof(T)))); }
+        NODISCARD size_type count() const noexcept                      { return (endIdx - beginIdx); }
+
+        BlockNode*  prevPtr = nullptr;
+        BlockNode*  nextPtr = nullptr;
+        size_type   beginIdx;                           // Slot of the first element
+        size_type   endIdx;                             // Slot past the last element
+        alignas(T) unsigned char storage[K * sizeof(T)];
+    };
+
+    // Bidirectional iterator keeping the node and the slot of the element, the end iterator has no node
+    template<bool IS_CONST>
+    class basic_iterator {
+        friend class UnrolledList;
+        friend class basic_iterator<!IS_CONST>;
+
+        using ListPtr = std::conditional_t<IS_CONST, const UnrolledList*, UnrolledList*>;
+        using NodePtr = std::conditional_t<IS_CONST, const BlockNode*, BlockNode*>;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::conditional_t<IS_CONST, const T*, T*>;
+        using reference         = std::conditional_t<IS_CONST, const T&, T&>;
+
+        basic_iterator() = default;
+
+        // Conversion from iterator to const_iterator
+        template<bool OTHER_CONST, class = std::enable_if_t<IS_CONST && !OTHER_CONST>>
+        basic_iterator(const basic_iterator<OTHER_CONST>& other) : list(other.list), node(other.node), index(other.index) { }
+
+        NODISCARD reference operator*()  const { return *node->element(index); }
+        NODISCARD pointer   operator->() const { return node->element(index);  }
+
+        basic_iterator& operator++()    { increment(); return *this; }
+        basic_iterator& operator--()    { decrement(); return *this; }
+        basic_iterator  operator++(int) { basic_iterator previous = *this; increment(); return previous; }
+        basic_iterator  operator--(int) { basic_iterator previous = *this; decrement(); return previous; }
+
+        NODISCARD bool operator==(const basic_iterator& other) const { return (node == other.node) && (index == other.index); }
+        NODISCARD bool operator!=(const basic_iterator& other) const { return !operator==(other); }
+
+    private:
+        basic_iterator(ListPtr list, NodePtr node, size_type index) : list(list), node(node), index(index) { }
+
+        void increment() noexcept
+        {
+            if(++index == node->endIdx)
+            {
+                node  = node->nextPtr;
+                index = (node != nullptr) ? node->beginIdx : 0;
+            }
+        }
+
+        void decrement() noexcept
+        {
+            if(node == nullptr)     // From the end to the last element
+                node = list->lastPtr;
+            else if(index != node->beginIdx)
+            {
+                --index;
+                return;
+            }
+            else
+                node = node->prevPtr;
+
+            index = node->endIdx - 1;
+        }
+
+        ListPtr     list    = nullptr;
+        NodePtr     node    = nullptr;
+        size_type   index   = 0;
+    };
+
+    // Position of an element, the node is nullptr past the end
+    struct Position {
+        BlockNode*  node;
+        size_type   index;
+    };
+
+    /*** Searching ***/
+    template<class RuleT>
+    NODISCARD Position FindIf(const RuleT& Predicate, Position from);      // First element fulfilling the predicate, starting from the given position
+    template<class RuleT>
+    NODISCARD Position FindLastIf(const RuleT& Predicate);                 // Last element fulfilling the predicate
+    NODISCARD static Position Next(const Position& position) noexcept;      // Position following the given one
+    NODISCARD size_type firstIndex() const noexcept { return (firstPtr != nullptr) ? firstPtr->beginIdx : 0; }
+
+    /*** Operations ***/
+    template<class... Args>
+    void ConstructBack(Args&&... args);                                     // Constructs an element after the last one
+    template<class... Args>
+    void ConstructFront(Args&&... args);                                    // Constructs an element before the first one
+    template<class RuleT>
+    void CompactFrom(Position from, const RuleT& Predicate);                // Removes the fulfilling elements by compacting each node
+    void RemoveAt(const Position& position);                                // Removes a single element and merges the neighbour nodes
+    void Truncate(BlockNode* node, const size_type newEndIdx) noexcept;     // Destroys the tail of a node, unlinks the node if it gets empty
+    BlockNode* MergeIfFits(BlockNode* node);                                // Merges the node with the next one if their elements fit into one
+    void ShiftToFront(BlockNode* node) noexcept;                            // Moves the elements of a node to its first slots
+    void Rebalance();                                                       // Merges all neighbour nodes fitting into one
+    void SwapContent(UnrolledList& anotherList) noexcept;                   // Swaps all members except the allocators
+
+    template<class... Args>
+    static void RecordConstruction() noexcept;                              // Counts the copies and moves of the elements
+
+    /*** Node Management ***/
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<BlockNode>;
+    using NodeTraits    = std::allocator_traits<NodeAllocator>;
+    using ElementTraits = std::allocator_traits<Allocator>;
+
+    NODISCARD BlockNode* CreateNode(const size_type startIdx);  // Allocate and construct a detached empty node
+    void DestroyNode(BlockNode* node) noexcept;                 // Destruct and deallocate a detached empty node
+    void UnlinkNode(BlockNode* node) noexcept;                  // Unlink and destroy an empty node
+
+    /*** Members ***/
+    BlockNode*  firstPtr            = nullptr;  // First node of the list
+    BlockNode*  lastPtr             = nullptr;  // Last node of the list
+    size_type   numberOfElements    = 0;        // Element count
+    size_type   numberOfBlocks      = 0;        // Node count
+    NO_UNIQUE_ADDR  Allocator       allocator;      // Allocator policy for constructing the elements
+    NO_UNIQUE_ADDR  NodeAllocator   nodeAllocator;  // Allocator rebound to the node type
+};
+
+/**
+ * @brief   Default constructor with allocator object
+ * @param   alloc   Allocator object
+ * @note    Container will use a copy of this allocator object, rebound to the node type for the nodes.
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>::UnrolledList(const allocator_type& alloc)
+: allocator(alloc), nodeAllocator(alloc)
+{ /* Empty constructor */ }
+
+/**
+ * @brief   Constructs a container with n value initialized elements.
+ * @param   n   Number of initial elements.
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>::UnrolledList(const size_type n)
+{
+    try {
+        while(GetNodeCount() < n)
+            EmplaceAppend();
+    }catch(...){
+        EraseAll();
+
+        throw;  // Propagate exception
+    }
+}
+
+/**
+ * @brief   Constructs a container with n elements initially using the given arguments.
+ * @param   n       Number of initial elements.
+ * @param   args    Construction arguments for initial elements.
+ */
+template<class T, std::size_t K, class Allocator>
+template<class... Args>
+UnrolledList<T, K, Allocator>::UnrolledList(const size_type n, Args&&... args)
+{
+    try {
+        while(GetNodeCount() < n)
+            EmplaceAppend(args...);
+    }catch(...){
+        EraseAll();
+
+        throw;  // Propagate exception
+    }
+}
+
+/**
+ * @brief   Constructs a container with a copy of each element in the range [begin, end), in the same order.
+ * @param   begin   Input iterator to the initial position in a range.
+ * @param   end     Input iterator to the final position in a range, excluded.
+ */
+template<class T, std::size_t K, class Allocator>
+template<class AnotherIteratorType, class>
+UnrolledList<T, K, Allocator>::UnrolledList(AnotherIteratorType begin, AnotherIteratorType end)
+{
+    try {
+        for(; begin != end; ++begin)
+            EmplaceAppend(*begin);
+    }catch(...){
+        EraseAll();
+
+        throw;  // Propagate exception
+    }
+}
+
+/**
+ * @brief   Constructs a list with a copy of each of the elements from another list, in the same order.
+ * @param   anotherList List to be copied from.
+ * @note    The nodes of the new list are filled completely, regardless of the occupancy of the source nodes.
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>::UnrolledList(const UnrolledList& anotherList)
+: allocator(ElementTraits::select_on_container_copy_construction(anotherList.allocator)), nodeAllocator(allocator)
+{
+    try {
+        for(const_reference element : anotherList)
+            Append(element);
+    }catch(...){
+        EraseAll();
+
+        throw;  // Propagate exception
+    }
+}
+
+/**
+ * @brief   Move constructor, steals the nodes of the given list.
+ * @param   anotherList Source list, left empty.
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>::UnrolledList(UnrolledList&& anotherList) noexcept
+: allocator(anotherList.allocator), nodeAllocator(anotherList.nodeAllocator)   // Copied, the source list may still allocate new nodes
+{
+    SwapContent(anotherList);
+}
+
+/**
+ * @brief   Construction with initializer list
+ * @param   initializerList   Initializer list
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>::UnrolledList(std::initializer_list<T> initializerList)
+: UnrolledList(initializerList.begin(), initializerList.end())
+{ /* Empty constructor */ }
+
+/**
+ * @brief Destroys all elements and nodes
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>::~UnrolledList()
+{
+    EraseAll();
+}
+
+/**
+ * @brief   Copy assignment operator
+ * @param   sourceList  List to be copied from
+ * @return  lValue reference to the current list
+ * @note    The allocator is replaced only if it propagates on copy assignment.
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>& UnrolledList<T, K, Allocator>::operator=(const UnrolledList& sourceList)
+{
+    if(this == &sourceList)
+        return *this;
+
+    EraseAll();     // Nodes must be released by the allocator which created them
+
+    if constexpr(ElementTraits::propagate_on_container_copy_assignment::value)
+    {
+        allocator       = sourceList.allocator;
+        nodeAllocator   = NodeAllocator(allocator);
+    }
+
+    for(const_reference element : sourceList)
+        Append(element);
+
+    return *this;
+}
+
+/**
+ * @brief   Move assignment operator
+ * @param   sourceList  List to be moved from, left empty
+ * @return  lValue reference to the current list
+ * @note    Nodes are stolen if the allocator propagates or both allocators are equal,
+ *          otherwise the elements are moved one by one into the nodes of this list.
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>& UnrolledList<T, K, Allocator>::operator=(UnrolledList&& sourceList)
+{
+    if(this == &sourceList)
+        return *this;
+
+    EraseAll();
+
+    if constexpr(ElementTraits::propagate_on_container_move_assignment::value)
+    {
+        allocator       = sourceList.allocator;
+        nodeAllocator   = sourceList.nodeAllocator;
+        SwapContent(sourceList);
+    }
+    else if(allocator == sourceList.allocator)
+        SwapContent(sourceList);
+    else
+    {
+        for(reference element : sourceList)
+            EmplaceAppend(std::move(element));
+
+        sourceList.EraseAll();
+    }
+
+    return *this;
+}
+
+/**
+ * @brief   Copy assignment operator for transaction from initializer lists
+ * @param   initializerList Initializer list containing the source elements
+ * @return  lValue reference to the current list
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>& UnrolledList<T, K, Allocator>::operator=(std::initializer_list<T> initializerList)
+{
+    EraseAll();
+
+    for(const_reference element : initializerList)
+        Append(element);
+
+    return *this;
+}
+
+/**
+ * @brief   Returns the first element.
+ * @return  Constant lValue reference to the first element.
+ * @throws  std::logic_error If the list is empty
+ */
+template<class T, std::size_t K, class Allocator>
+const T& UnrolledList<T, K, Allocator>::First() const
+{
+    if(isEmpty() == true)
+        throw std::logic_error("List is empty!");
+
+    return *firstPtr->element(firstPtr->beginIdx);
+}
+
+/**
+ * @brief   Returns the last element.
+ * @return  Constant lValue reference to the last element.
+ * @throws  std::logic_error If the list is empty
+ */
+template<class T, std::size_t K, class Allocator>
+const T& UnrolledList<T, K, Allocator>::Last() const
+{
+    if(isEmpty() == true)
+        throw std::logic_error("List is empty!");
+
+    return *lastPtr->element(lastPtr->endIdx - 1);
+}
+
+/**
+ * @brief   Returns the first element.
+ * @return  lValue reference to the first element.
+ * @throws  std::logic_error If the list is empty
+ */
+template<class T, std::size_t K, class Allocator>
+T& UnrolledList<T, K, Allocator>::First()
+{
+    if(isEmpty() == true)
+        throw std::logic_error("List is empty!");
+
+    return *firstPtr->element(firstPtr->beginIdx);
+}
+
+/**
+ * @brief   Returns the last element.
+ * @return  lValue reference to the last element.
+ * @throws  std::logic_error If the list is empty
+ */
+template<class T, std::size_t K, class Allocator>
+T& UnrolledList<T, K, Allocator>::Last()
+{
+    if(isEmpty() == true)
+        throw std::logic_error("List is empty!");
+
+    return *lastPtr->element(lastPtr->endIdx - 1);
+}
+
+/**
+ * @brief   Appends the given data after the last element
+ * @param   data      Data to be appended
+ * @return  lValue reference to the current list to support cascades
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>& UnrolledList<T, K, Allocator>::Append(const_reference data)
+{
+    ConstructBack(data);
+
+    return *this;   // Support cascaded appends
+}
+
+/**
+ * @brief   Prepends the given data before the first element
+ * @param   data      Data to be prepended
+ * @return  lValue reference to the current list to support cascades
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>& UnrolledList<T, K, Allocator>::Prepend(const_reference data)
+{
+    ConstructFront(data);
+
+    return *this;   // Support cascaded prepends
+}
+
+/**
+ * @brief   Constructs an element inplace after the last element
+ * @param   args    Arguments forwarded to construct the new element.
+ * @return  lValue reference to the current list to support cascades
+ */
+template<class T, std::size_t K, class Allocator>
+template<class... Args>
+UnrolledList<T, K, Allocator>& UnrolledList<T, K, Allocator>::EmplaceAppend(Args&&... args)
+{
+    ConstructBack(std::forward<Args>(args)...);
+
+    return *this;   // Support cascaded appends
+}
+
+/**
+ * @brief   Constructs an element inplace before the first element
+ * @param   args    Arguments forwarded to construct the new element.
+ * @return  lValue reference to the current list to support cascades
+ */
+template<class T, std::size_t K, class Allocator>
+template<class... Args>
+UnrolledList<T, K, Allocator>& UnrolledList<T, K, Allocator>::EmplacePrepend(Args&&... args)
+{
+    ConstructFront(std::forward<Args>(args)...);
+
+    return *this;   // Support cascaded prepends
+}
+
+/**
+ * @brief   Removes from the list all the elements for which Predicate returns true.
+ * @param   Predicate   Unary predicate taking a constant reference to an element,
+ *                      returns true for those elements to be removed from the list.
+ * @return  lValue reference to the current list to support cascaded calls
+ * @note    Each node is compacted in a single pass, the remaining elements keep their order.
+ * @note    If the predicate throws, the elements examined until then are removed and the others are kept.
+ */
+template<class T, std::size_t K, class Allocator>
+template<class RuleT>
+UnrolledList<T, K, Allocator>& UnrolledList<T, K, Allocator>::RemoveIf(const RuleT& Predicate)
+{
+    CompactFrom(Position{firstPtr, firstIndex()}, Predicate);
+    Rebalance();
+
+    return *this; // Support cascaded calls
+}
+
+/**
+ * @brief   Removes the first element
+ * @return  lValue reference to the current list to support cascaded calls
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>& UnrolledList<T, K, Allocator>::RemoveFirst()
+{
+    if(isEmpty() == false)
+    {
+        ElementTraits::destroy(allocator, firstPtr->element(firstPtr->beginIdx));
+        ++firstPtr->beginIdx;
+        --numberOfElements;
+
+        if(firstPtr->count() == 0)
+            UnlinkNode(firstPtr);
+    }
+
+    return *this;   // Support cascaded remove calls
+}
+
+/**
+ * @brief   Removes the last element
+ * @return  lValue reference to the current list to support cascaded calls
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>& UnrolledList<T, K, Allocator>::RemoveLast()
+{
+    if(isEmpty() == false)
+        Truncate(lastPtr, lastPtr->endIdx - 1);
+
+    return *this;   // Support cascaded remove calls
+}
+
+/**
+ * @brief   Removes all samples of a specific kind of data
+ * @param   data    Value to be removed, copied before the removal so that it may refer to an element of the list
+ * @return  lValue reference to the list to support cascaded calls
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>& UnrolledList<T, K, Allocator>::RemoveIf(const_reference data)
+{
+    const value_type key(data);
+
+    return RemoveIf([&key](const_reference element) { return (element == key); });
+}
+
+/**
+ * @brief   Removes the first sample of given data.
+ * @param   data Search key
+ * @return  lValue reference to the list to support cascaded calls
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>& UnrolledList<T, K, Allocator>::RemoveFirstOf(const_reference data)
+{
+    const Position position = FindIf([&data](const_reference element) { return (element == data); }, Position{firstPtr, firstIndex()});
+
+    if(position.node != nullptr)
+        RemoveAt(position);
+
+    return *this;
+}
+
+/**
+ * @brief   Removes the last sample of given data.
+ * @param   data Search key
+ * @return  lValue reference to the list to support cascaded calls
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>& UnrolledList<T, K, Allocator>::RemoveLastOf(const_reference data)
+{
+    const Position position = FindLastIf([&data](const_reference element) { return (element == data); });
+
+    if(position.node != nullptr)
+        RemoveAt(position);
+
+    return *this;
+}
+
+/**
+ * @brief   Removes all samples which are not of the given data.
+ * @param   data    Value to be kept, copied before the removal so that it may refer to an element of the list
+ * @return  lValue reference to the list to support cascaded calls
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>& UnrolledList<T, K, Allocator>::RemoveIfNot(const_reference data)
+{
+    const value_type key(data);
+
+    return RemoveIf([&key](const_reference element) { return !(element == key); });
+}
+
+/**
+ * @brief   Removes the first sample which is not the given data.
+ * @param   data Search key
+ * @return  lValue reference to the list to support cascaded calls
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>& UnrolledList<T, K, Allocator>::RemoveFirstNotOf(const_reference data)
+{
+    const Position position = FindIf([&data](const_reference element) { return !(element == data); }, Position{firstPtr, firstIndex()});
+
+    if(position.node != nullptr)
+        RemoveAt(position);
+
+    return *this;
+}
+
+/**
+ * @brief   Removes the last sample which is not the given data.
+ * @param   data Search key
+ * @return  lValue reference to the list to support cascaded calls
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>& UnrolledList<T, K, Allocator>::RemoveLastNotOf(const_reference data)
+{
+    const Position position = FindLastIf([&data](const_reference element) { return !(element == data); });
+
+    if(position.node != nullptr)
+        RemoveAt(position);
+
+    return *this;
+}
+
+/**
+ * @brief   Removes all elements and releases all nodes
+ * @return  lValue reference to the list to support cascaded calls
+ */
+template<class T, std::size_t K, class Allocator>
+UnrolledList<T, K, Allocator>& UnrolledList<T, K, Allocator>::EraseAll()
+{
+    while(lastPtr != nullptr)
+        Truncate(lastPtr, lastPtr->beginIdx);
+
+    return *this;
+}
+
+/**
+ * @brief   Replaces all elements equal to the oldData with the newData
+ * @param   oldData Data key to be replaced
+ * @param   newData Replace value
+ * @note    Elements of each node are scanned contiguously.
+ */
+template<class T, std::size_t K, class Allocator>
+void UnrolledList<T, K, Allocator>::ReplaceAllWith(const_reference oldData, const_reference newData)
+{
+    for(BlockNode* node = firstPtr; node != nullptr; node = node->nextPtr)
+        for(size_type idx = node->beginIdx; idx < node->endIdx; ++idx)
+            if(*node->element(idx) == oldData)
+                *node->element(idx) = newData;
+}
+
+/**
+ * @brief   Replaces the first element equal to the oldData with the newData
+ * @param   oldData Data key to be replaced
+ * @param   newData Replace value
+ */
+template<class T, std::size_t K, class Allocator>
+void UnrolledList<T, K, Allocator>::ReplaceFirstWith(const_reference oldData, const_reference newData)
+{
+    const Position position = FindIf([&oldData](const_reference element) { return (element == oldData); }, Position{firstPtr, firstIndex()});
+
+    if(position.node != nullptr)
+        *position.node->element(position.index) = newData;
+}
+
+/**
+ * @brief   Replaces the last element equal to the oldData with the newData
+ * @param   oldData Data key to be replaced
+ * @param   newData Replace value
+ */
+template<class T, std::size_t K, class Allocator>
+void UnrolledList<T, K, Allocator>::ReplaceLastWith(const_reference oldData, const_reference newData)
+{
+    const Position position = FindLastIf([&oldData](const_reference element) { return (element == oldData); });
+
+    if(position.node != nullptr)
+        *position.node->element(position.index) = newData;
+}
+
+/**
+ * @brief   Swaps the contents of two lists.
+ * @param   anotherList     List to be swapped with this.
+ * @note    The allocators are swapped only if they propagate on swap, otherwise they must be equal.
+ */
+template<class T, std::size_t K, class Allocator>
+void UnrolledList<T, K, Allocator>::Swap(UnrolledList& anotherList) noexcept
+{
+    if(this == &anotherList)
+        return;     // Self swap is not required
+
+    SwapContent(anotherList);
+
+    if constexpr(ElementTraits::propagate_on_container_swap::value)
+    {
+        using std::swap;
+        swap(allocator,     anotherList.allocator);
+        swap(nodeAllocator, anotherList.nodeAllocator);
+    }
+}
+
+/**
+ * @brief Resizes the list so that it contains n elements
+ * @param newSize   New list size, expressed in number of elements
+ * @param data      Object whose content is copied to the appended elements
+ */
+template<class T, std::size_t K, class Allocator>
+void UnrolledList<T, K, Allocator>::Resize(const size_type newSize, const_reference data)
+{
+    // Remove excessive elements if exists
+    while(newSize < GetNodeCount())
+        RemoveLast();
+
+    // Append new elements if needed
+    while(newSize > GetNodeCount())
+        Append(data);
+}
+
+/**
+ * @brief   Removes all but the first sample of each value, as List::MakeUnique does.
+ * @note    The following elements are compacted once for each kept element, the nodes are merged at the end.
+ */
+template<class T, std::size_t K, class Allocator>
+void UnrolledList<T, K, Allocator>::MakeUnique()
+{
+    for(Position current{firstPtr, firstIndex()}; current.node != nullptr; current = Next(current))
+    {
+        // The current element is never moved, the compaction starts after it
+        const_reference key = *current.node->element(current.index);
+
+        CompactFrom(Next(current), [&key](const_reference element) { return (element == key); });
+    }
+
+    Rebalance();
+}
+
+/**
+ * @brief Sorts the elements in ascending order.
+ */
+template<class T, std::size_t K, class Allocator>
+void UnrolledList<T, K, Allocator>::Sort()
+{
+    Sort(std::less<value_type>());
+}
+
+/**
+ * @brief   Sorts the elements with a stable sort.
+ * @param   comp    Binary predicate that returns true if the first argument shall precede the second one.
+ * @note    The addresses of the elements are sorted first, then the elements are moved into new nodes in the sorted order.
+ * @note    All nodes are allocated before any element is moved, and the elements are copied instead if their move
+ *          constructor may throw. So the list is not modified if anything throws, except for the elements of a type
+ *          with a throwing move constructor and no copy constructor.
+ */
+template<class T, std::size_t K, class Allocator>
+template<class Compare>
+void UnrolledList<T, K, Allocator>::Sort(Compare comp)
+{
+    // At least two elements required for sorting
+    if(GetNodeCount() < 2)
+        return;
+
+    using AddressAllocator  = typename ElementTraits::template rebind_alloc<value_type*>;
+    using AddressTraits     = std::allocator_traits<AddressAllocator>;
+
+    AddressAllocator addressAllocator(allocator);
+    value_type** addresses = AddressTraits::allocate(addressAllocator, GetNodeCount());
+    size_type count = 0;
+
+    for(BlockNode* node = firstPtr; node != nullptr; node = node->nextPtr)
+        for(size_type idx = node->beginIdx; idx < node->endIdx; ++idx)
+            addresses[count++] = node->element(idx);
+
+    UnrolledList sortedList(allocator);
+    BlockNode* spareNodes = nullptr;    // Detached nodes of the sorted list, chained by their next pointers
+
+    try {
+        for(size_type remaining = count; remaining > 0; remaining -= ((remaining < K) ? remaining : K))
+        {
+            BlockNode* node = sortedList.CreateNode(0);
+
+            node->nextPtr   = spareNodes;
+            spareNodes      = node;
+        }
+
+        std::stable_sort(addresses, addresses + count, [&comp](const value_type* left, const value_type* right) { return comp(*left, *right); });
+
+        // Nodes are filled while detached, so that the sorted list never holds a partially constructed node
+        for(size_type idx = 0; idx < count; )
+        {
+            BlockNode* node = spareNodes;
+
+            try {
+                for( ; (node->endIdx < K) && (idx < count); ++idx, ++node->endIdx)
+                {
+                    ElementTraits::construct(sortedList.allocator, node->slot(node->endIdx), std::move_if_noexcept(*addresses[idx]));
+                    RecordConstruction<decltype(std::move_if_noexcept(*addresses[idx]))>();
+                }
+            }catch(...){
+                for( ; node->endIdx > 0; --node->endIdx)
+                    ElementTraits::destroy(sortedList.allocator, node->element(node->endIdx - 1));
+
+                throw;  // Propagate exception
+            }
+
+            spareNodes      = node->nextPtr;
+            node->nextPtr   = nullptr;
+            node->prevPtr   = sortedList.lastPtr;
+            ((sortedList.lastPtr != nullptr) ? sortedList.lastPtr->nextPtr : sortedList.firstPtr) = node;
+            sortedList.lastPtr = node;
+            sortedList.numberOfElements += node->count();
+        }
+    }catch(...){
+        for(BlockNode* nextNode; spareNodes != nullptr; spareNodes = nextNode)
+        {
+            nextNode = spareNodes->nextPtr;
+            sortedList.DestroyNode(spareNodes);
+        }
+
+        AddressTraits::deallocate(addressAllocator, addresses, count);
+
+        throw;  // Propagate exception
+    }
+
+    AddressTraits::deallocate(addressAllocator, addresses, count);
+
+    EraseAll();
+    SwapContent(sortedList);
+}
+
+/**
+ * @brief   Merges two sorted lists into a single sorted list.
+ * @param   anotherList List to be merged
+ * @note    The second list will be completely flushed after this operation.
+ */
+template<class T, std::size_t K, class Allocator>
+void UnrolledList<T, K, Allocator>::Merge(UnrolledList& anotherList)
+{
+    Merge(anotherList, std::less<value_type>());
+}
+
+/**
+ * @brief   Merges two lists sorted by the given comparator into a single sorted list.
+ * @param   anotherList List to be merged
+ * @param   comp        Binary predicate that returns true if the first argument shall precede the second one.
+ * @note    Both lists must already be sorted by the comparator, sortedness is not checked.
+ * @note    The second list will be completely flushed after this operation.
+ * @note    Equal elements of this list precede the ones of the second list.
+ * @note    Elements are moved into new nodes in a single pass. If the comparator throws,
+ *          the elements moved until then are left in a valid but unspecified state.
+ */
+template<class T, std::size_t K, class Allocator>
+template<class Compare>
+void UnrolledList<T, K, Allocator>::Merge(UnrolledList& anotherList, Compare comp)
+{
+    if((this == &anotherList) || (anotherList.isEmpty() == true))
+        return;
+
+    UnrolledList mergedList(allocator);
+    iterator left = begin(), right = anotherList.begin();
+
+    while((left != end()) && (right != anotherList.end()))
+    {
+        if(comp(*right, *left))
+            mergedList.EmplaceAppend(std::move(*right++));
+        else
+            mergedList.EmplaceAppend(std::move(*left++));
+    }
+
+    for(; left != end(); ++left)
+        mergedList.EmplaceAppend(std::move(*left));
+
+    for(; right != anotherList.end(); ++right)
+        mergedList.EmplaceAppend(std::move(*right));
+
+    anotherList.EraseAll();
+    EraseAll();
+    SwapContent(mergedList);
+}
+
+/**
+ * @brief   Concatenates two lists
+ * @param   anotherList List to be appended to the end of this list, flushed after this operation
+ * @note    Nodes are relinked if both allocators are equal, the elements are moved one by one otherwise.
+ */
+template<class T, std::size_t K, class Allocator>
+void UnrolledList<T, K, Allocator>::Concatenate(UnrolledList& anotherList)
+{
+    if((this == &anotherList) || (anotherList.isEmpty() == true))
+        return;
+
+    if(allocator == anotherList.allocator)
+    {
+        BlockNode* seamNode = lastPtr;
+
+        if(seamNode == nullptr)
+            firstPtr = anotherList.firstPtr;
+        else
+        {
+            seamNode->nextPtr               = anotherList.firstPtr;
+            anotherList.firstPtr->prevPtr   = seamNode;
+        }
+
+        lastPtr             = anotherList.lastPtr;
+        numberOfElements   += anotherList.numberOfElements;
+        numberOfBlocks     += anotherList.numberOfBlocks;
+
+        anotherList.firstPtr            = nullptr;
+        anotherList.lastPtr             = nullptr;
+        anotherList.numberOfElements    = 0;
+        anotherList.numberOfBlocks      = 0;
+
+        if(seamNode != nullptr)
+            MergeIfFits(seamNode);
+    }
+    else
+    {
+        for(reference element : anotherList)
+            EmplaceAppend(std::move(element));
+
+        anotherList.EraseAll();
+    }
+}
+
+/**
+ * @brief   Searches the first element fulfilling the predicate
+ * @param   Predicate   Unary predicate taking a constant reference to an element
+ * @param   from        Position where the search begins
+ * @return  Position of the element, its node is nullptr if none found
+ */
+template<class T, std::size_t K, class Allocator>
+template<class RuleT>
+typename UnrolledList<T, K, Allocator>::Position UnrolledList<T, K, Allocator>::FindIf(const RuleT& Predicate, Position from)
+{
+    for(size_type idx = from.index; from.node != nullptr; from.node = from.node->nextPtr)
+    {
+        for(idx = (idx < from.node->beginIdx) ? from.node->beginIdx : idx; idx < from.node->endIdx; ++idx)
+            if(Predicate(*from.node->element(idx)))
+                return Position{from.node, idx};
+
+        idx = 0;
+    }
+
+    return Position{nullptr, 0};
+}
+
+/**
+ * @brief   Searches the last element fulfilling the predicate
+ * @param   Predicate   Unary predicate taking a constant reference to an element
+ * @return  Position of the element, its node is nullptr if none found
+ */
+template<class T, std::size_t K, class Allocator>
+template<class RuleT>
+typename UnrolledList<T, K, Allocator>::Position UnrolledList<T, K, Allocator>::FindLastIf(const RuleT& Predicate)
+{
+    for(BlockNode* node = lastPtr; node != nullptr; node = node->prevPtr)
+        for(size_type idx = node->endIdx; idx > node->beginIdx; --idx)
+            if(Predicate(*node->element(idx - 1)))
+                return Position{node, idx - 1};
+
+    return Position{nullptr, 0};
+}
+
+/**
+ * @brief   Returns the position following the given one
+ * @param   position    Position of an element
+ * @return  Position of the next element, its node is nullptr past the end
+ */
+template<class T, std::size_t K, class Allocator>
+typename UnrolledList<T, K, Allocator>::Position UnrolledList<T, K, Allocator>::Next(const Position& position) noexcept
+{
+    if((position.index + 1) < position.node->endIdx)
+        return Position{position.node, position.index + 1};
+
+    BlockNode* nextNode = position.node->nextPtr;
+
+    return Position{nextNode, (nextNode != nullptr) ? nextNode->beginIdx : 0};
+}
+
+/**
+ * @brief   Constructs an element after the last one, a new node is linked if the last node is full.
+ * @param   args    Arguments forwarded to construct the element.
+ * @note    The list is not modified if the construction throws.
+ */
+template<class T, std::size_t K, class Allocator>
+template<class... Args>
+void UnrolledList<T, K, Allocator>::ConstructBack(Args&&... args)
+{
+    const bool isNewNode    = (lastPtr == nullptr) || (lastPtr->endIdx == K);
+    BlockNode* node         = isNewNode ? CreateNode(0) : lastPtr;
+
+    try {
+        ElementTraits::construct(allocator, node->slot(node->endIdx), std::forward<Args>(args)...);
+    }catch(...){
+        if(isNewNode)
+            DestroyNode(node);
+
+        throw;  // Propagate exception
+    }
+
+    if(isNewNode)
+    {
+        node->prevPtr = lastPtr;
+        ((lastPtr != nullptr) ? lastPtr->nextPtr : firstPtr) = node;
+        lastPtr = node;
+    }
+
+    ++node->endIdx;
+    ++numberOfElements;
+
+    RecordConstruction<Args...>();
+}
+
+/**
+ * @brief   Constructs an element before the first one, a new node is linked if the first node is full.
+ * @param   args    Arguments forwarded to construct the element.
+ * @note    The list is not modified if the construction throws.
+ */
+template<class T, std::size_t K, class Allocator>
+template<class... Args>
+void UnrolledList<T, K, Allocator>::ConstructFront(Args&&... args)
+{
+    const bool isNewNode    = (firstPtr == nullptr) || (firstPtr->beginIdx == 0);
+    BlockNode* node         = isNewNode ? CreateNode(K) : firstPtr;   // New nodes are filled from their end
+
+    try {
+        ElementTraits::construct(allocator, node->slot(node->beginIdx - 1), std::forward<Args>(args)...);
+    }catch(...){
+        if(isNewNode)
+            DestroyNode(node);
+
+        throw;  // Propagate exception
+    }
+
+    if(isNewNode)
+    {
+        node->nextPtr = firstPtr;
+        ((firstPtr != nullptr) ? firstPtr->prevPtr : lastPtr) = node;
+        firstPtr = node;
+    }
+
+    --node->beginIdx;
+    ++numberOfElements;
+
+    RecordConstruction<Args...>();
+}
+
+/**
+ * @brief   Removes the elements fulfilling the predicate, starting from the given position
+ * @param   from        Position of the first element to be checked, its node may be nullptr
+ * @param   Predicate   Unary predicate taking a constant reference to an element
+ * @note    The kept elements of each node are moved towards the first removed slot, emptied nodes are unlinked.
+ *          The elements before the given position are neither moved nor checked.
+ */
+template<class T, std::size_t K, class Allocator>
+template<class RuleT>
+void UnrolledList<T, K, Allocator>::CompactFrom(Position from, const RuleT& Predicate)
+{
+    for(BlockNode* node = from.node; node != nullptr;)
+    {
+        size_type readIdx = (node == from.node) ? from.index : node->beginIdx;
+        size_type writeIdx = readIdx;
+
+        try {
+            for(; readIdx < node->endIdx; ++readIdx)
+            {
+                if(Predicate(*node->element(readIdx)))
+                    continue;
+
+                if(writeIdx != readIdx)
+                    *node->element(writeIdx) = std::move(*node->element(readIdx));
+
+                ++writeIdx;
+            }
+        }catch(...){
+            // Keep the unchecked elements by closing the gap of the removed ones
+            for(; readIdx < node->endIdx; ++readIdx, ++writeIdx)
+                if(writeIdx != readIdx)
+                    *node->element(writeIdx) = std::move(*node->element(readIdx));
+
+            Truncate(node, writeIdx);
+
+            throw;  // Propagate exception
+        }
+
+        BlockNode* nextNode = node->nextPtr;
+
+        Truncate(node, writeIdx);
+        node = nextNode;
+    }
+}
+
+/**
+ * @brief   Removes a single element, the shorter side of its node is shifted
+ * @param   position    Position of the element
+ */
+template<class T, std::size_t K, class Allocator>
+void UnrolledList<T, K, Allocator>::RemoveAt(const Position& position)
+{
+    BlockNode* node = position.node;
+
+    if((position.index - node->beginIdx) < (node->endIdx - position.index))
+    {
+        for(size_type idx = position.index; idx > node->beginIdx; --idx)
+            *node->element(idx) = std::move(*node->element(idx - 1));
+
+        ElementTraits::destroy(allocator, node->element(node->beginIdx));
+        ++node->beginIdx;
+    }
+    else
+    {
+        for(size_type idx = position.index + 1; idx < node->endIdx; ++idx)
+            *node->element(idx - 1) = std::move(*node->element(idx));
+
+        ElementTraits::destroy(allocator, node->element(node->endIdx - 1));
+        --node->endIdx;
+    }
+
+    --numberOfElements;
+
+    if(node->count() == 0)
+    {
+        UnlinkNode(node);
+        return;
+    }
+
+    // Merge with the neighbours, the survivor of the first merge follows the previous node
+    BlockNode* const prevNode = node->prevPtr;
+
+    MergeIfFits(node);
+
+    if(prevNode != nullptr)
+        MergeIfFits(prevNode);
+}
+
+/**
+ * @brief   Destroys the elements of a node starting from the given slot
+ * @param   node        Node to be truncated
+ * @param   newEndIdx   Slot of the first element to be destroyed
+ * @note    The node is unlinked and released if it gets empty.
+ */
+template<class T, std::size_t K, class Allocator>
+void UnrolledList<T, K, Allocator>::Truncate(BlockNode* node, const size_type newEndIdx) noexcept
+{
+    for(size_type idx = newEndIdx; idx < node->endIdx; ++idx)
+        ElementTraits::destroy(allocator, node->element(idx));
+
+    numberOfElements   -= (node->endIdx - newEndIdx);
+    node->endIdx        = newEndIdx;
+
+    if(node->count() == 0)
+        UnlinkNode(node);
+}
+
+/**
+ * @brief   Merges the node with the next one if their elements fit into one of them
+ * @param   node    Node to be merged with the next one
+ * @return  Node to continue merging from, the surviving node if merged, the next node otherwise
+ * @note    The elements are moved one by one, so that the list is consistent even if a move throws.
+ */
+template<class T, std::size_t K, class Allocator>
+typename UnrolledList<T, K, Allocator>::BlockNode* UnrolledList<T, K, Allocator>::MergeIfFits(BlockNode* node)
+{
+    BlockNode* const nextNode = node->nextPtr;
+
+    if(nextNode == nullptr)
+        return nullptr;
+
+    // Gathering the elements to the first slots cannot leave a gap when the moves cannot throw
+    if constexpr(std::is_nothrow_move_constructible_v<T>)
+        if((nextNode->count() > (K - node->endIdx)) && ((node->count() + nextNode->count()) <= K))
+            ShiftToFront(node);
+
+    if(nextNode->count() <= (K - node->endIdx))     // Elements of the next node fit after the last element
+    {
+        while(nextNode->beginIdx != nextNode->endIdx)
+        {
+            ElementTraits::construct(allocator, node->slot(node->endIdx), std::move(*nextNode->element(nextNode->beginIdx)));
+            ++node->endIdx;
+
+            ElementTraits::destroy(allocator, nextNode->element(nextNode->beginIdx));
+            ++nextNode->beginIdx;
+
+            CONTAINER_STATS_RECORD(UnrolledList, bytesMoved, sizeof(T));
+        }
+
+        UnlinkNode(nextNode);
+        return node;
+    }
+
+    if(node->count() <= nextNode->beginIdx)         // Elements of the node fit before the first element of the next one
+    {
+        while(node->beginIdx != node->endIdx)
+        {
+            ElementTraits::construct(allocator, nextNode->slot(nextNode->beginIdx - 1), std::move(*node->element(node->endIdx - 1)));
+            --nextNode->beginIdx;
+
+            ElementTraits::destroy(allocator, node->element(node->endIdx - 1));
+            --node->endIdx;
+
+            CONTAINER_STATS_RECORD(UnrolledList, bytesMoved, sizeof(T));
+        }
+
+        UnlinkNode(node);
+    }
+
+    return nextNode;
+}
+
+/**
+ * @brief   Moves the elements of a node to its first slots
+ * @param   node    Node whose elements are moved
+ * @note    Used only for the elements which cannot throw while being moved.
+ */
+template<class T, std::size_t K, class Allocator>
+void UnrolledList<T, K, Allocator>::ShiftToFront(BlockNode* node) noexcept
+{
+    const size_type count = node->count();
+
+    if(node->beginIdx == 0)
+        return;
+
+    // A destination slot is either unused or has already been moved from
+    for(size_type idx = 0; idx < count; ++idx)
+    {
+        ElementTraits::construct(allocator, node->slot(idx), std::move(*node->element(node->beginIdx + idx)));
+        ElementTraits::destroy(allocator, node->element(node->beginIdx + idx));
+    }
+
+    CONTAINER_STATS_RECORD(UnrolledList, bytesMoved, count * sizeof(T));
+
+    node->beginIdx  = 0;
+    node->endIdx    = count;
+}
+
+/**
+ * @brief   Merges all neighbour nodes whose elements fit into one node
+ */
+template<class T, std::size_t K, class Allocator>
+void UnrolledList<T, K, Allocator>::Rebalance()
+{
+    for(BlockNode* node = firstPtr; node != nullptr;)
+        node = MergeIfFits(node);
+}
+
+/**
+ * @brief   Swaps all members except the allocators
+ * @param   anotherList List to be swapped with
+ */
+template<class T, std::size_t K, class Allocator>
+void UnrolledList<T, K, Allocator>::SwapContent(UnrolledList& anotherList) noexcept
+{
+    std::swap(firstPtr,         anotherList.firstPtr);
+    std::swap(lastPtr,          anotherList.lastPtr);
+    std::swap(numberOfElements, anotherList.numberOfElements);
+    std::swap(numberOfBlocks,   anotherList.numberOfBlocks);
+}
+
+/**
+ * @brief   Counts a construction from another element as a copy or a move
+ */
+template<class T, std::size_t K, class Allocator>
+template<class... Args>
+void UnrolledList<T, K, Allocator>::RecordConstruction() noexcept
+{
+    if constexpr((1 == sizeof...(Args)) && (std::is_same_v<std::decay_t<Args>, T> && ...))
+    {
+        if constexpr((std::is_lvalue_reference_v<Args> && ...))
+            CONTAINER_STATS_RECORD(UnrolledList, bytesCopied, sizeof(T));
+        else
+            CONTAINER_STATS_RECORD(UnrolledList, bytesMoved, sizeof(T));
+    }
+}
+
+/**
+ * @brief   Allocates and constructs a detached empty node.
+ * @param   startIdx    Slot where the first element will be placed at.
+ * @return  Address of the new node.
+ */
+template<class T, std::size_t K, class Allocator>
+typename UnrolledList<T, K, Allocator>::BlockNode* UnrolledList<T, K, Allocator>::CreateNode(const size_type startIdx)
+{
+    BlockNode* newNode = NodeTraits::allocate(nodeAllocator, 1);
+
+    NodeTraits::construct(nodeAllocator, newNode, startIdx);   // Cannot throw
+    ++numberOfBlocks;
+
+    CONTAINER_STATS_RECORD(UnrolledList, nodeAllocations, 1);
+
+    return newNode;
+}
+
+/**
+ * @brief   Destructs and deallocates a detached empty node.
+ * @param   node    Node to be destroyed.
+ */
+template<class T, std::size_t K, class Allocator>
+void UnrolledList<T, K, Allocator>::DestroyNode(BlockNode* node) noexcept
+{
+    NodeTraits::destroy(nodeAllocator, node);
+    NodeTraits::deallocate(nodeAllocator, node, 1);
+    --numberOfBlocks;
+
+    CONTAINER_STATS_RECORD(UnrolledList, nodeDeallocations, 1);
+}
+
+/**
+ * @brief   Unlinks an empty node from the list and destroys it.
+ * @param   node    Node to be removed.
+ */
+template<class T, std::size_t K, class Allocator>
+void UnrolledList<T, K, Allocator>::UnlinkNode(BlockNode* node) noexcept
+{
+    ((node->prevPtr != nullptr) ? node->prevPtr->nextPtr : firstPtr) = node->nextPtr;
+    ((node->nextPtr != nullptr) ? node->nextPtr->prevPtr : lastPtr)  = node->prevPtr;
+
+    DestroyNode(node);
+}
+
+/**
+ * @brief   Output insertion overloaded to be used with an unrolled list
+ * @param   stream  Output stream where the list will be inserted to.
+ * @param   list    List to be inserted.
+ * @return  lValue reference to stream to support cascaded calls.
+ */
+template<class T, std::size_t K, class Allocator>
+std::ostream& operator<<(std::ostream& stream, const UnrolledList<T, K, Allocator>& list)
+{
+    if(list.isEmpty() == true)
+        stream << "-- empty list --";
+    else
+        for(const T& element : list)
+            stream << element << " ";
+
+    return stream; // Support cascaded streams
+}
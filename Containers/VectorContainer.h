@@ -16,6 +16,20 @@
  *              April 24, 2021 -> Memory leakeages caused by exceptions during container construction prevented.
  *              May 2, 2021    -> Vulnerability against exceptions caused by modifier functions fixed.
  *                             -> get_allocator() function added
+ *              October 14, 2026 -> Trivially relocatable types are relocated with bulk memory copies.
+ *                             -> Reallocations move elements if the move constructor cannot throw.
+ *                             -> Insertion and emplacement share a single gap opening mechanism.
+ *                             -> Growth policy added as a template parameter, power of 2 growth kept as default.
+ *                             -> Inline buffer support added for derived containers.
+ *                             -> append(..), resize_uninitialized(..) and resize_and_overwrite(..) added for buffer filling.
+ *                             -> Comparison, find(..), count(..) and contains(..) use vectorized kernels for arithmetic types.
+ *                             -> Opt-in reallocation and copy/move statistics added, see ContainerStats.h.
+ *                             -> Allocator propagation traits honoured by assignments and swap, allocators moved with the content.
+ *                             -> Ambiguity between the copy constructors fixed.
+ *                             -> erase_if(..) and remove_all(..) added, the elements are compacted in a single pass.
+ *                             -> Empty insertions no longer relocate the elements onto themselves.
+ *                             -> Insertions do not shift elements whose move may throw, they are copied into a new space.
+ *                             -> Inline buffer given as a template parameter, a vector without it keeps its three words.
  *
  *  @note       Feel free to contact for questions, bugs or any other thing.
  *  @copyright  No copyright.
@@ -30,9 +44,13 @@
 #include <stdexcept>            // exceptions
 #include <iterator>             // std::distance
 #include <cstddef>              // std::size_t, ptrdiff_t
+#include <cstdint>              // SIZE_MAX
+#include <cstring>              // std::memcpy, std::memmove
 #include <utility>              // std::move
 #include <ostream>              // std::cout
 #include <memory>               // std::allocator, std::allocator_traits
+#include "SimdKernels.h"        // SimdKernels::equal, SimdKernels::find, SimdKernels::count
+#include "ContainerStats.h"     // CONTAINER_STATS_RECORD, ContainerStats::Snapshot
 
 /*** Special definitions ***/
 // If the C++ version is greater or equal to 2017xx
@@ -42,9 +60,129 @@
 #define NODISCARD
 #endif
 
+/*** Relocation Traits ***/
+/* Elements of trivially relocatable types are moved to a new location by copying their bytes.
+ * The source objects are not destroyed afterwards as their lifetime is transferred to the copies.
+ * Specialize this trait for types which do not depend on their own address (e.g. a pointer owner). */
+template<class T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template<class T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+/*** Growth Policies ***/
+/* Growth policies determine the new capacity when the current capacity cannot hold the required number of elements.
+ * Each policy provides a static nextCapacity(currentCap, requiredCap, elementSize) method whose result
+ * must not be smaller than the required capacity. The element size is given in bytes. */
+
+// Grows to the smallest power of 2 which can hold the required number of elements
+class PowerOf2Growth {
+public:
+    NODISCARD static constexpr std::size_t nextCapacity(std::size_t /* currentCap */, std::size_t requiredCap, std::size_t /* elementSize */) noexcept
+    {
+        std::size_t newCap = 1u;
+
+        while(newCap < requiredCap)
+        {
+            if(newCap > (SIZE_MAX >> 1))    // Next power of 2 is not representable
+                return requiredCap;
+
+            newCap <<= 1;
+        }
+
+        return (0 == requiredCap) ? 0 : newCap;
+    }
+};
+
+// Doubles the current capacity
+class DoublingGrowth {
+public:
+    NODISCARD static constexpr std::size_t nextCapacity(std::size_t currentCap, std::size_t requiredCap, std::size_t /* elementSize */) noexcept
+    {
+        const std::size_t newCap = (currentCap > (SIZE_MAX >> 1)) ? SIZE_MAX : (currentCap << 1);
+
+        return (newCap < requiredCap) ? requiredCap : newCap;
+    }
+};
+
+// Grows the current capacity by half, so that the previously released blocks can be reused by the allocator
+class OneAndHalfGrowth {
+public:
+    NODISCARD static constexpr std::size_t nextCapacity(std::size_t currentCap, std::size_t requiredCap, std::size_t /* elementSize */) noexcept
+    {
+        const std::size_t newCap = (currentCap > (SIZE_MAX - (currentCap >> 1))) ? SIZE_MAX : (currentCap + (currentCap >> 1));
+
+        return (newCap < requiredCap) ? requiredCap : newCap;
+    }
+};
+
+// Grows the current capacity by a fixed number of elements, trades reallocation count against memory usage
+template<std::size_t INCREMENT = 64>
+class FixedIncrementGrowth {
+    static_assert(INCREMENT != 0, "Increment cannot be 0!");
+
+public:
+    NODISCARD static constexpr std::size_t nextCapacity(std::size_t currentCap, std::size_t requiredCap, std::size_t /* elementSize */) noexcept
+    {
+        if(requiredCap <= currentCap)
+            return requiredCap;
+
+        // Number of increments needed to reach the required capacity
+        const std::size_t steps = ((requiredCap - currentCap - 1) / INCREMENT) + 1;
+
+        if(steps > ((SIZE_MAX - currentCap) / INCREMENT))   // Overflow check
+            return requiredCap;
+
+        return currentCap + (steps * INCREMENT);
+    }
+};
+
+// Doubles the current capacity and rounds the allocation size up to a multiple of huge pages when it exceeds a single page
+template<std::size_t PAGE_SIZE = (2u << 20)>
+class HugePageGrowth {
+    static_assert(PAGE_SIZE != 0, "Page size cannot be 0!");
+
+public:
+    NODISCARD static constexpr std::size_t nextCapacity(std::size_t currentCap, std::size_t requiredCap, std::size_t elementSize) noexcept
+    {
+        const std::size_t newCap = DoublingGrowth::nextCapacity(currentCap, requiredCap, elementSize);
+
+        if((0 == elementSize) || (newCap > (SIZE_MAX / elementSize)))  // Byte size is not representable
+            return newCap;
+
+        const std::size_t newBytes = newCap * elementSize;
+
+        if((newBytes < PAGE_SIZE) || (newBytes > (SIZE_MAX - PAGE_SIZE)))
+            return newCap;
+
+        // Round up to the page boundary and use the whole area for elements
+        return (((newBytes + PAGE_SIZE - 1) / PAGE_SIZE) * PAGE_SIZE) / elementSize;
+    }
+};
+
+/*** Inline Buffer ***/
+/* Uninitialized space for the first elements of a vector, used until the content outgrows it (see SmallVector).
+ * The buffer is a base of the vector, so that it is alive during the whole lifetime of the members.
+ * Without an inline capacity the base is empty and takes no space. */
+template<class T, std::size_t InlineCapacity>
+class VectorInlineBuffer {
+protected:
+    NODISCARD T* inlineBuffer() noexcept                { return reinterpret_cast<T*>(buffer);          }
+    NODISCARD const T* inlineBuffer() const noexcept    { return reinterpret_cast<const T*>(buffer);    }
+
+private:
+    alignas(T) unsigned char buffer[InlineCapacity * sizeof(T)];
+};
+
+template<class T>
+class VectorInlineBuffer<T, 0> {
+protected:
+    NODISCARD static constexpr T* inlineBuffer() noexcept { return nullptr; }
+};
+
 /*** Container Class ***/
-template<class T, class Allocator = std::allocator<T>>
-class Vector{
+template<class T, class Allocator = std::allocator<T>, class GrowthPolicy = PowerOf2Growth, std::size_t InlineCapacity = 0>
+class Vector : private VectorInlineBuffer<T, InlineCapacity> {
 public:
     /*** C++ Standard Named Requirements for Containers ***/
     using value_type        = T;
@@ -56,6 +194,8 @@ public:
     using size_type         = std::size_t;
     using allocator_type    = Allocator;
 
+    static constexpr size_type inline_capacity = InlineCapacity;   // Number of elements kept inside the object
+
     /*** Constructors and Destructor ***/
     // Default constructors
     Vector() noexcept;
@@ -71,11 +211,11 @@ public:
 
     // Copy constructors
     Vector(const Vector& copyVector);
-    Vector(const Vector& copyVector, const allocator_type& alloc = allocator_type());
+    Vector(const Vector& copyVector, const allocator_type& alloc);
 
     // Move constructors
-    Vector(Vector&& moveVector) noexcept(std::is_nothrow_swappable_v<T*>);
-    Vector(Vector&& moveVector, const allocator_type& alloc) noexcept(std::is_nothrow_swappable_v<T*>);
+    Vector(Vector&& moveVector) noexcept(isInlineRelocationNothrow());
+    Vector(Vector&& moveVector, const allocator_type& alloc) noexcept(std::allocator_traits<Allocator>::is_always_equal::value && isInlineRelocationNothrow());
 
     // Initializer List constructor
     Vector(std::initializer_list<value_type> initializerList, const allocator_type& alloc = allocator_type());
@@ -85,7 +225,7 @@ public:
     /*** Operator Overloadings ***/
     Vector& operator=(const Vector& copyVector);                            // Copy assignment operator
     Vector& operator=(std::initializer_list<value_type> initializerList);   // Initializer list assignment operator
-    Vector& operator=(Vector&& moveVector) noexcept(std::is_nothrow_destructible_v<T> && std::is_nothrow_swappable_v<T*>);     // Move assignment operator
+    Vector& operator=(Vector&& moveVector) noexcept(std::is_nothrow_destructible_v<T> && isStealingAlwaysPossible() && isInlineRelocationNothrow()); // Move assignment operator
 
     NODISCARD reference       operator[](const size_type position)        { return data[position]; }  // Element access by lValue
     NODISCARD const_reference operator[](const size_type position) const  { return data[position]; }  // Element access by const lValue
@@ -101,6 +241,12 @@ public:
     NODISCARD reference       back()          { return data[sz - 1]; }      // Access to the last element
     NODISCARD const_reference back() const    { return data[sz - 1]; }      // Access to the last element
 
+    /*** Lookup ***/
+    NODISCARD iterator       find(const_reference value)        { return data + SimdKernels::find(data, sz, value); }   // First equal element or end()
+    NODISCARD const_iterator find(const_reference value) const  { return data + SimdKernels::find(data, sz, value); }   // First equal element or end()
+    NODISCARD size_type count(const_reference value) const      { return SimdKernels::count(data, sz, value);       }   // Number of equal elements
+    NODISCARD bool contains(const_reference value) const        { return (find(value) != end());                    }   // Has an equal element or not
+
     /*** Iterators ***/
     NODISCARD iterator begin() noexcept     { return data;      }   // Iterator starting from the first element
     NODISCARD iterator end() noexcept       { return data + sz; }   // Iterator starting from the next of the last element
@@ -128,7 +274,11 @@ public:
 
     iterator erase(iterator position);              // Single element erase
     iterator erase(iterator first, iterator last);  // Iterator based multiple erase
-    void swap(Vector& swapVector) noexcept(std::is_nothrow_swappable_v<T*>);  // Swap
+
+    template<class Predicate>
+    size_type erase_if(Predicate pred);             // Erases all elements fulfilling the predicate in a single pass
+    size_type remove_all(const_reference value);    // Erases all elements equal to the value in a single pass
+    void swap(Vector& swapVector) noexcept(isInlineRelocationNothrow());    // Swap
     void clear() noexcept(std::is_nothrow_destructible_v<T>) { destroyRange(begin(), end()); sz = 0; }
 
     template <class... Args>
@@ -138,6 +288,13 @@ public:
     void emplace_back(Args&&... args);
     void resize(const size_type newSize);  // Simple resize
     void resize(const size_type newSize, const_reference fillValue);  // Resize and fill
+    void resize_uninitialized(const size_type newSize);              // Resize without initializing, trivial types only
+
+    template<class Operation>
+    void resize_and_overwrite(const size_type maxSize, Operation op);  // Resize and let the operation fill the content
+
+    template<class InputIterator>
+    void append(InputIterator first, InputIterator last);  // Range append with a single capacity check
     void reserve(const size_type reservationSize);
     void shrink_to_fit();
 
@@ -146,18 +303,43 @@ public:
     NODISCARD size_type size()     const noexcept { return sz;          }
     NODISCARD size_type capacity() const noexcept { return cap;         }
     NODISCARD size_type max_size() const noexcept { return std::allocator_traits<Allocator>::max_size(allocator); }
+    NODISCARD bool is_inline() const noexcept { return (0 != InlineCapacity) && (data == inlineBuffer()); }   // Elements are kept inside the object
 
     /** Allocator **/
     NODISCARD allocator_type get_allocator() const noexcept { return  allocator; }
 
+    /*** Statistics ***/
+    NODISCARD static ContainerStats::Snapshot stats() noexcept { return ContainerStats::snapshotOf<Vector>(); }   // Zeros unless enabled
+
 private:
+    using VectorInlineBuffer<T, InlineCapacity>::inlineBuffer;
+
     /*** Members ***/
-    size_type sz    = 0;
-    size_type cap   = 0;
-    T* data         = nullptr;
+    size_type sz        = 0;
+    size_type cap       = InlineCapacity;
+    T* data             = inlineBuffer();   // Either the inline buffer or a space of the allocator
     Allocator allocator;
 
     /*** Helper Functions ***/
+    // Storage of an rvalue can always be taken over if the allocator follows it or cannot differ
+    NODISCARD static constexpr bool isStealingAlwaysPossible() noexcept
+    {
+        return std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value ||
+               std::allocator_traits<Allocator>::is_always_equal::value;
+    }
+
+    // Elements can be shifted inside the storage only if no relocation can throw, otherwise a new storage is filled by copying
+    NODISCARD static constexpr bool isShiftingNothrow() noexcept
+    {
+        return is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>;
+    }
+
+    // Inline elements cannot be stolen, moving or swapping vectors relocates them one by one
+    NODISCARD static constexpr bool isInlineRelocationNothrow() noexcept
+    {
+        return (0 == InlineCapacity) || isShiftingNothrow();
+    }
+
     template<class InputIterator>
     void assignRangeForward(InputIterator from, InputIterator to, iterator destination); // TODO: snake_case or camelCase standardization
 
@@ -175,34 +357,26 @@ private:
     template<class InputIterator>
     void copyRangeBackward(InputIterator from, InputIterator to, iterator destination);
 
+    NODISCARD static size_type recommendCapacity(size_type currentCap, size_type requiredCap) noexcept;
     NODISCARD T* grow(size_type newCap, bool copy = false, size_type gapIndex = 0, size_type gapSize = 0);
 
+    void relocateContent(iterator newData, size_type gapIndex = 0, size_type gapSize = 0);
+    void relocateRange(iterator from, iterator to, iterator destination);
+    void replaceStorage(iterator newData, size_type newCap);
+    void stealContent(Vector& source);
+    void openGap(size_type gapIndex, size_type gapSize) noexcept;
+    void closeGap(size_type gapIndex, size_type gapSize) noexcept;
+
     void destroyRange(iterator from, iterator to);
-    void destroyPointer(iterator ptr);
+    void destroyPointer(iterator ptr, size_type capacity);
 };
 
-// Finds the next power of 2 which is greater than N.
-std::size_t nextPowerOf2(std::size_t N)
-{
-    if(0 == N)
-        return 1u;
-
-    std::size_t maxValuedBit = 1u;
-
-    while(0 != N) {
-        N = N >> 1;
-        maxValuedBit = maxValuedBit << 1;
-    }
-
-    return maxValuedBit;
-}
-
 /**
  * @brief Default constructor
  */
-template<class T, class Allocator>
-Vector<T, Allocator>::Vector() noexcept
-: sz(0), cap(0), data(nullptr)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+Vector<T, Allocator, GrowthPolicy, InlineCapacity>::Vector() noexcept
+: sz(0), cap(InlineCapacity), data(inlineBuffer())
 { /* Empty constructor */ }
 
 /**
@@ -210,9 +384,9 @@ Vector<T, Allocator>::Vector() noexcept
  * @param   alloc   Allocator object
  * @note    Container will use this allocator object to manage memory operations.
  */
-template<class T, class Allocator>
-Vector<T, Allocator>::Vector(const allocator_type& alloc)
-: sz(0), cap(0), data(nullptr), allocator(alloc)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+Vector<T, Allocator, GrowthPolicy, InlineCapacity>::Vector(const allocator_type& alloc)
+: sz(0), cap(InlineCapacity), data(inlineBuffer()), allocator(alloc)
 { /* Empty constructor */ }
 
 /**
@@ -221,21 +395,22 @@ Vector<T, Allocator>::Vector(const allocator_type& alloc)
  * @param   alloc           Allocator object
  * @note    Container will use this allocator object to manage memory operations.
  */
-template<class T, class Allocator>
-Vector<T, Allocator>::Vector(const size_type numOfElements, const allocator_type& alloc)
-: sz(0), cap(nextPowerOf2(numOfElements)), data(nullptr), allocator(alloc)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+Vector<T, Allocator, GrowthPolicy, InlineCapacity>::Vector(const size_type numOfElements, const allocator_type& alloc)
+: sz(0), cap(recommendCapacity(0, numOfElements)), data(inlineBuffer()), allocator(alloc)
 {
     try{
-        // Allocate space for incoming elements
+        // Allocate space for incoming elements unless the inline buffer is enough
         // Construction will take place at each element insertion
-        data = std::allocator_traits<Allocator>::allocate(allocator, cap);
+        if(cap > InlineCapacity)
+            data = std::allocator_traits<Allocator>::allocate(allocator, cap);
 
         // Construct the elements at predetermined locations
         for(; sz < numOfElements; ++sz)
             std::allocator_traits<Allocator>::construct(allocator, data + sz);
     }catch(...){
         destroyRange(begin(), end());
-        destroyPointer(data);
+        destroyPointer(data, cap);
 
         throw;
     }
@@ -248,21 +423,22 @@ Vector<T, Allocator>::Vector(const size_type numOfElements, const allocator_type
  * @param   alloc           Allocator object
  * @note    Container will use this allocator object to manage memory operations.
  */
-template<class T, class Allocator>
-Vector<T, Allocator>::Vector(const size_type numOfElements, const_reference fillValue, const allocator_type& alloc)
-: sz(0), cap(nextPowerOf2(sz)), data(nullptr), allocator(alloc)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+Vector<T, Allocator, GrowthPolicy, InlineCapacity>::Vector(const size_type numOfElements, const_reference fillValue, const allocator_type& alloc)
+: sz(0), cap(recommendCapacity(0, numOfElements)), data(inlineBuffer()), allocator(alloc)
 {
     try{
-        // Allocate space for incoming elements
+        // Allocate space for incoming elements unless the inline buffer is enough
         // Construction will take place at each element insertion
-        data = std::allocator_traits<Allocator>::allocate(allocator, cap);
+        if(cap > InlineCapacity)
+            data = std::allocator_traits<Allocator>::allocate(allocator, cap);
 
         // Construct the elements at predetermined locations
         for(; sz < numOfElements; ++sz)
             std::allocator_traits<Allocator>::construct(allocator, data + sz, fillValue);
     }catch(...){
         destroyRange(begin(), end());
-        destroyPointer(data);
+        destroyPointer(data, cap);
 
         throw;
     }
@@ -275,27 +451,27 @@ Vector<T, Allocator>::Vector(const size_type numOfElements, const_reference fill
  * @param   alloc   Allocator object
  * @note    Container will use this allocator object to manage memory operations.
  */
-template<class T, class Allocator>
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
 template<class InputIterator>
-Vector<T, Allocator>::Vector(InputIterator first, InputIterator last, const allocator_type& alloc)
-: sz(0), data(nullptr), allocator(alloc)
+Vector<T, Allocator, GrowthPolicy, InlineCapacity>::Vector(InputIterator first, InputIterator last, const allocator_type& alloc)
+: sz(0), data(inlineBuffer()), allocator(alloc)
 {
-    const difference_type numOfElements = std::distance(first, last);
+    const size_type numOfElements = size_type(std::distance(first, last));
 
-    cap     = nextPowerOf2(numOfElements);
-    copyRangeForward(first, last, data);
+    cap     = recommendCapacity(0, numOfElements);
 
     try{
-        // Allocate space for incoming elements
+        // Allocate space for incoming elements unless the inline buffer is enough
         // Construction will take place at each element insertion
-        data = std::allocator_traits<Allocator>::allocate(allocator, cap);
+        if(cap > InlineCapacity)
+            data = std::allocator_traits<Allocator>::allocate(allocator, cap);
 
         // Copy construct the elements at predetermined locations
         for(; sz < numOfElements; ++sz)
             std::allocator_traits<Allocator>::construct(allocator, data + sz, *(first + sz));
     }catch(...){
         destroyRange(begin(), end());
-        destroyPointer(data);
+        destroyPointer(data, cap);
 
         throw;
     }
@@ -305,14 +481,15 @@ Vector<T, Allocator>::Vector(InputIterator first, InputIterator last, const allo
  * @brief   Copy constructor
  * @param   copyVector  Vector to be copied from
  */
-template<class T, class Allocator>
-Vector<T, Allocator>::Vector(const Vector& copyVector)
-: sz(0), cap(copyVector.capacity()), data(nullptr), allocator(copyVector.allocator)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+Vector<T, Allocator, GrowthPolicy, InlineCapacity>::Vector(const Vector& copyVector)
+: sz(0), cap(copyVector.capacity()), data(inlineBuffer()),
+  allocator(std::allocator_traits<Allocator>::select_on_container_copy_construction(copyVector.allocator))
 {
     try{
-        // Allocate space for incoming elements
+        // Allocate space for incoming elements unless the inline buffer is enough
         // Construction will take place at each element insertion
-        if(cap > 0)
+        if(cap > InlineCapacity)
             data = std::allocator_traits<Allocator>::allocate(allocator, cap);
 
         // Copy construct the elements at predetermined locations
@@ -320,7 +497,7 @@ Vector<T, Allocator>::Vector(const Vector& copyVector)
             std::allocator_traits<Allocator>::construct(allocator, data + sz, copyVector[sz]);
     }catch(...){
         destroyRange(begin(), end());
-        destroyPointer(data);
+        destroyPointer(data, cap);
 
         throw;
     }
@@ -333,14 +510,14 @@ Vector<T, Allocator>::Vector(const Vector& copyVector)
  * @param   alloc       Allocator object
  * @note    Container will use this allocator object to manage memory operations.
  */
-template<class T, class Allocator>
-Vector<T, Allocator>::Vector(const Vector& copyVector, const allocator_type& alloc)
-: sz(0), cap(copyVector.capacity()), data(nullptr), allocator(alloc)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+Vector<T, Allocator, GrowthPolicy, InlineCapacity>::Vector(const Vector& copyVector, const allocator_type& alloc)
+: sz(0), cap(copyVector.capacity()), data(inlineBuffer()), allocator(alloc)
 {
     try {
-        // Allocate space for incoming elements
+        // Allocate space for incoming elements unless the inline buffer is enough
         // Construction will take place at each element insertion
-        if(cap > 0)
+        if(cap > InlineCapacity)
             data = std::allocator_traits<Allocator>::allocate(allocator, cap);
 
         // Copy construct the elements at predetermined locations
@@ -348,7 +525,7 @@ Vector<T, Allocator>::Vector(const Vector& copyVector, const allocator_type& all
             std::allocator_traits<Allocator>::construct(allocator, data + sz, copyVector[sz]);
     }catch(...){
         destroyRange(begin(), end());
-        destroyPointer(data);
+        destroyPointer(data, cap);
 
         throw;
     }
@@ -357,14 +534,14 @@ Vector<T, Allocator>::Vector(const Vector& copyVector, const allocator_type& all
 /**
  * @brief Move constructor
  * @param moveVector Vector to be used for resource stealing
+ * @note  The allocator is moved together with the content.
+ * @note  Inline elements cannot be stolen, they are relocated one by one.
  */
-template<class T, class Allocator>
-Vector<T, Allocator>::Vector(Vector&& moveVector) noexcept(std::is_nothrow_swappable_v<T*>)
-: sz(moveVector.size()), cap(moveVector.capacity()), data(moveVector.data)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+Vector<T, Allocator, GrowthPolicy, InlineCapacity>::Vector(Vector&& moveVector) noexcept(isInlineRelocationNothrow())
+: sz(0), cap(InlineCapacity), data(inlineBuffer()), allocator(std::move(moveVector.allocator))
 {
-    moveVector.sz   = 0;
-    moveVector.cap  = 0;
-    moveVector.data = nullptr;  // Source stolen
+    stealContent(moveVector);
 }
 
 /**
@@ -372,14 +549,36 @@ Vector<T, Allocator>::Vector(Vector&& moveVector) noexcept(std::is_nothrow_swapp
  * @param   moveVector  Vector to be used for resource stealing
  * @param   alloc       Allocator object
  * @note    Container will use this allocator object to manage memory operations.
+ * @note    Resources are stolen only if the allocators are equal, elements are moved one by one otherwise.
+ * @note    Inline elements cannot be stolen, they are relocated one by one.
  */
-template<class T, class Allocator>
-Vector<T, Allocator>::Vector(Vector&& moveVector, const allocator_type& alloc) noexcept(std::is_nothrow_swappable_v<T*>)
-: sz(moveVector.size()), cap(moveVector.capacity()), data(moveVector.data), allocator(alloc)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+Vector<T, Allocator, GrowthPolicy, InlineCapacity>::Vector(Vector&& moveVector, const allocator_type& alloc) noexcept(std::allocator_traits<Allocator>::is_always_equal::value && isInlineRelocationNothrow())
+: allocator(alloc)
 {
-    moveVector.sz   = 0;
-    moveVector.cap  = 0;
-    moveVector.data = nullptr;  // Source stolen
+    if(allocator == moveVector.allocator)
+    {
+        stealContent(moveVector);
+    }
+    else    // The storage belongs to the other allocator
+    {
+        try {
+            reserve(moveVector.size());
+
+            // Move construct the elements at predetermined locations
+            for(; sz < moveVector.size(); ++sz)
+                std::allocator_traits<Allocator>::construct(allocator, data + sz, std::move(moveVector[sz]));
+        }catch(...){
+            destroyRange(begin(), end());
+            destroyPointer(data, cap);
+
+            throw;  // Propagate exception
+        }
+
+        CONTAINER_STATS_RECORD(Vector, bytesMoved, sz * sizeof(T));
+
+        moveVector.clear();
+    }
 }
 
 /**
@@ -388,14 +587,14 @@ Vector<T, Allocator>::Vector(Vector&& moveVector, const allocator_type& alloc) n
  * @param   alloc                   Allocator object
  * @note    Container will use this allocator object to manage memory operations.
  */
-template<class T, class Allocator>
-Vector<T, Allocator>::Vector(std::initializer_list<value_type> initializerList, const allocator_type& alloc)
-: sz(0), cap(nextPowerOf2(initializerList.size())), data(nullptr), allocator(alloc)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+Vector<T, Allocator, GrowthPolicy, InlineCapacity>::Vector(std::initializer_list<value_type> initializerList, const allocator_type& alloc)
+: sz(0), cap(recommendCapacity(0, initializerList.size())), data(inlineBuffer()), allocator(alloc)
 {
     try{
-        // Allocate space for incoming elements
+        // Allocate space for incoming elements unless the inline buffer is enough
         // Construction will take place at each element insertion
-        if(cap > 0)
+        if(cap > InlineCapacity)
             data = std::allocator_traits<Allocator>::allocate(allocator, cap);
 
         // Copy construct the elements at predetermined locations
@@ -403,7 +602,7 @@ Vector<T, Allocator>::Vector(std::initializer_list<value_type> initializerList,
             std::allocator_traits<Allocator>::construct(allocator, data + sz, *(initializerList.begin() + sz));
     }catch(...){
         destroyRange(begin(), end());
-        destroyPointer(data);
+        destroyPointer(data, cap);
 
         throw;
     }
@@ -413,11 +612,11 @@ Vector<T, Allocator>::Vector(std::initializer_list<value_type> initializerList,
  * @brief   Destructor
  * @note    Calls the destructors of each element individually
  */
-template<class T, class Allocator>
-Vector<T, Allocator>::~Vector() noexcept(std::is_nothrow_destructible_v<T>)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+Vector<T, Allocator, GrowthPolicy, InlineCapacity>::~Vector() noexcept(std::is_nothrow_destructible_v<T>)
 {
     destroyRange(begin(), end());
-    destroyPointer(data);
+    destroyPointer(data, cap);
 
     sz      = 0;
     cap     = 0;
@@ -429,13 +628,32 @@ Vector<T, Allocator>::~Vector() noexcept(std::is_nothrow_destructible_v<T>)
  * @param   copyVector Vector to be copied from
  * @return  lvalue reference to the left vector to support cascaded calls
  * @note    The elements of the left vector will be destroyed
+ * @note    The allocator is replaced only if it propagates on copy assignment.
  */
-template<class T, class Allocator>
-Vector<T, Allocator>& Vector<T, Allocator>::operator=(const Vector& copyVector)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+Vector<T, Allocator, GrowthPolicy, InlineCapacity>& Vector<T, Allocator, GrowthPolicy, InlineCapacity>::operator=(const Vector& copyVector)
 {
     if(this != &copyVector) // Check self assignment
+    {
+        if constexpr(std::allocator_traits<Allocator>::propagate_on_container_copy_assignment::value)
+        {
+            if(allocator != copyVector.allocator)   // Memory owned by the current allocator must be returned to it
+            {
+                clear();
+                destroyPointer(data, cap);
+
+                data    = inlineBuffer();
+                cap     = InlineCapacity;
+            }
+
+            allocator = copyVector.allocator;
+        }
+
         assign(copyVector.begin(), copyVector.end());
 
+        CONTAINER_STATS_RECORD(Vector, bytesCopied, copyVector.size() * sizeof(T));
+    }
+
     return *this;
 }
 
@@ -444,16 +662,37 @@ Vector<T, Allocator>& Vector<T, Allocator>::operator=(const Vector& copyVector)
  * @param   moveVector Vector to be used for resource swapping
  * @return  lvalue reference to the left vector to support cascaded calls
  * @note    The elements of the left vector will be destroyed
- * @note    The resource of the right vector will be stolen
+ * @note    The resource of the right vector will be stolen if the allocator propagates on move assignment or is equal,
+ *          the elements are moved one by one otherwise.
+ * @note    Inline elements cannot be stolen, they are relocated one by one.
  */
-template<class T, class Allocator>
-Vector<T, Allocator>& Vector<T, Allocator>::operator=(Vector&& moveVector) noexcept(std::is_nothrow_destructible_v<T> && std::is_nothrow_swappable_v<T*>)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+Vector<T, Allocator, GrowthPolicy, InlineCapacity>& Vector<T, Allocator, GrowthPolicy, InlineCapacity>::operator=(Vector&& moveVector) noexcept(std::is_nothrow_destructible_v<T> && isStealingAlwaysPossible() && isInlineRelocationNothrow())
 {
     if(this == &moveVector)     // Check self assignment
         return *this;
 
-    clear();            // Clear own content
-    swap(moveVector);   // Steal resources of move(right) vector
+    constexpr bool propagate = std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value;
+
+    if(propagate || (allocator == moveVector.allocator))
+    {
+        // Release own resource with the current allocator before replacing it
+        clear();
+        destroyPointer(data, cap);
+
+        data    = inlineBuffer();
+        cap     = InlineCapacity;
+
+        if constexpr(propagate)
+            allocator = std::move(moveVector.allocator);
+
+        stealContent(moveVector);
+    }
+    else    // The storage belongs to the other allocator
+    {
+        assign(std::make_move_iterator(moveVector.begin()), std::make_move_iterator(moveVector.end()));
+        moveVector.clear();
+    }
 
     return *this;
 }
@@ -463,8 +702,8 @@ Vector<T, Allocator>& Vector<T, Allocator>::operator=(Vector&& moveVector) noexc
  * @param   rightVector Vector on the right side of comparison operator
  * @return  true if vectors are equal
  */
-template<class T, class Allocator>
-bool Vector<T, Allocator>::operator==(const Vector& rightVector) const
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+bool Vector<T, Allocator, GrowthPolicy, InlineCapacity>::operator==(const Vector& rightVector) const
 {
     if(this == &rightVector)            // Self comparison
         return true;
@@ -472,11 +711,7 @@ bool Vector<T, Allocator>::operator==(const Vector& rightVector) const
     if(size() != rightVector.size())    // Size must match
         return false;
 
-    for(size_type index = 0; index < sz; ++index)
-        if(data[index] != rightVector[index])
-            return false;
-
-    return true;
+    return SimdKernels::equal(data, rightVector.data, sz);  // Vectorized for arithmetic types
 }
 
 /**
@@ -485,8 +720,8 @@ bool Vector<T, Allocator>::operator==(const Vector& rightVector) const
  * @return  lvalue reference to the left vector to support cascaded calls
  * @note    The elements of the left vector will be destroyed
  */
-template<class T, class Allocator>
-Vector<T, Allocator>& Vector<T, Allocator>::operator=(std::initializer_list<value_type> initializerList)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+Vector<T, Allocator, GrowthPolicy, InlineCapacity>& Vector<T, Allocator, GrowthPolicy, InlineCapacity>::operator=(std::initializer_list<value_type> initializerList)
 {
     assign(initializerList);
 
@@ -499,8 +734,8 @@ Vector<T, Allocator>& Vector<T, Allocator>::operator=(std::initializer_list<valu
  * @return  lvalue reference to the element at index
  * @throws  std::out_of_range if the index is bigger than the size
  */
-template<class T, class Allocator>
-T& Vector<T, Allocator>::at(const size_type index)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+T& Vector<T, Allocator, GrowthPolicy, InlineCapacity>::at(const size_type index)
 {
     if(index < sz)
         return data[index];
@@ -514,8 +749,8 @@ T& Vector<T, Allocator>::at(const size_type index)
  * @return  const lvalue reference to the element at index
  * @throws  std::out_of_range if the index is bigger than the size
  */
-template<class T, class Allocator>
-const T& Vector<T, Allocator>::at(const size_type index) const
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+const T& Vector<T, Allocator, GrowthPolicy, InlineCapacity>::at(const size_type index) const
 {
     if(index < sz)
         return data[index];
@@ -528,17 +763,18 @@ const T& Vector<T, Allocator>::at(const size_type index) const
  * @param   first   Source start point
  * @param   last    Source end point
  */
-template<class T, class Allocator>
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
 template<class InputIterator>
-void Vector<T, Allocator>::assign(InputIterator first, InputIterator last)
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::assign(InputIterator first, InputIterator last)
 {
-    const difference_type numberOfElements = std::distance(first, last);
+    const size_type numberOfElements = size_type(std::distance(first, last));
 
     size_type copied = 0;
 
     if(numberOfElements > capacity())  // Is a bigger space needed?
     {
-        value_type* newData = std::allocator_traits<Allocator>::allocate(allocator, nextPowerOf2(numberOfElements));;   // Grow
+        const size_type newCap = recommendCapacity(cap, numberOfElements);
+        value_type* newData = std::allocator_traits<Allocator>::allocate(allocator, newCap);   // Grow
 
         try {
             // Copy construct assigned elements
@@ -549,17 +785,20 @@ void Vector<T, Allocator>::assign(InputIterator first, InputIterator last)
             for( ; copied > 0; --copied)
                 std::allocator_traits<Allocator>::destroy(allocator, newData + copied - 1);
 
-            destroyPointer(newData);
+            destroyPointer(newData, newCap);
 
             throw;  // Propagate exception
         }
 
         // Destroy previous elements and resource
         destroyRange(begin(), end());
-        destroyPointer(data);
+        destroyPointer(data, cap);
+
+        if(nullptr != data)     // The first allocation is not a reallocation
+            CONTAINER_STATS_RECORD(Vector, reallocations, 1);
 
         data    = newData;
-        cap     = nextPowerOf2(numberOfElements);
+        cap     = newCap;
     }
     else    // Reallocation not needed
     {
@@ -592,14 +831,15 @@ void Vector<T, Allocator>::assign(InputIterator first, InputIterator last)
  * @param   fillValue           Assignment value
  * @throws  std::logic_error    If zero elements wanted to be assigned
  */
-template<class T, class Allocator>
-void Vector<T, Allocator>::assign(size_type numberOfElements, const_reference fillValue)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::assign(size_type numberOfElements, const_reference fillValue)
 {
     size_type copied = 0;
 
     if(numberOfElements > capacity())  // Is a bigger space needed?
     {
-        value_type* newData = std::allocator_traits<Allocator>::allocate(allocator, nextPowerOf2(numberOfElements));;   // Grow
+        const size_type newCap = recommendCapacity(cap, numberOfElements);
+        value_type* newData = std::allocator_traits<Allocator>::allocate(allocator, newCap);   // Grow
 
         try {
             // Copy construct assigned elements
@@ -610,17 +850,20 @@ void Vector<T, Allocator>::assign(size_type numberOfElements, const_reference fi
             for( ; copied > 0; --copied)
                 std::allocator_traits<Allocator>::destroy(allocator, newData + copied - 1);
 
-            destroyPointer(newData);
+            destroyPointer(newData, newCap);
 
             throw;  // Propagate exception
         }
 
         // Destroy previous elements and resource
         destroyRange(begin(), end());
-        destroyPointer(data);
+        destroyPointer(data, cap);
+
+        if(nullptr != data)     // The first allocation is not a reallocation
+            CONTAINER_STATS_RECORD(Vector, reallocations, 1);
 
         data    = newData;
-        cap     = nextPowerOf2(numberOfElements);
+        cap     = newCap;
     }
     else    // Reallocation not needed
     {
@@ -651,14 +894,15 @@ void Vector<T, Allocator>::assign(size_type numberOfElements, const_reference fi
  * @brief Initializer list assignment
  * @param initializerList   Source list
  */
-template<class T, class Allocator>
-void Vector<T, Allocator>::assign(std::initializer_list<T> initializerList)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::assign(std::initializer_list<T> initializerList)
 {
     size_type copied = 0;
 
     if(initializerList.size() > capacity())  // Is a bigger space needed?
     {
-        value_type* newData = std::allocator_traits<Allocator>::allocate(allocator, nextPowerOf2(initializerList.size()));;   // Grow
+        const size_type newCap = recommendCapacity(cap, initializerList.size());
+        value_type* newData = std::allocator_traits<Allocator>::allocate(allocator, newCap);   // Grow
 
         try {
             // Copy construct assigned elements
@@ -669,17 +913,20 @@ void Vector<T, Allocator>::assign(std::initializer_list<T> initializerList)
             for( ; copied > 0; --copied)
                 std::allocator_traits<Allocator>::destroy(allocator, newData + copied - 1);
 
-            destroyPointer(newData);
+            destroyPointer(newData, newCap);
 
             throw;  // Propagate exception
         }
 
         // Destroy previous elements and resource
         destroyRange(begin(), end());
-        destroyPointer(data);
+        destroyPointer(data, cap);
+
+        if(nullptr != data)     // The first allocation is not a reallocation
+            CONTAINER_STATS_RECORD(Vector, reallocations, 1);
 
         data    = newData;
-        cap     = nextPowerOf2(initializerList.size());
+        cap     = newCap;
     }
     else    // Reallocation not needed
     {
@@ -710,42 +957,31 @@ void Vector<T, Allocator>::assign(std::initializer_list<T> initializerList)
  * @brief   Adds a new element at the end of the vector, after its current last element.
  * @param   value   Value to be copied to the new element.
  */
-template<class T, class Allocator>
-void Vector<T, Allocator>::push_back(const_reference value)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::push_back(const_reference value)
 {
-    if(size() == capacity())    // Size is about to surpass the capacity
-    {
-        value_type* newData = grow(nextPowerOf2(cap), true);   // Grow and copy the current content
-
-        // Destroy old content
-        destroyRange(begin(), end());
-        destroyPointer(data);
-
-        data    = newData;
-        cap     = nextPowerOf2(cap);
-    }
+    emplace_back(value);    // Construct element at the back by copying
 
-    // Copy construct new element with the incoming one
-    std::allocator_traits<Allocator>::construct(allocator, data + sz, value);
-
-    sz++;   // Size will not be incremented in case of a previous exception
+    CONTAINER_STATS_RECORD(Vector, bytesCopied, sizeof(T));
 }
 
 /**
  * @brief   Adds a new element at the end of the vector, after its current last element.
  * @param   value   Value to be moved to the new element.
  */
-template<class T, class Allocator>
-void Vector<T, Allocator>::push_back(value_type&& value)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::push_back(value_type&& value)
 {
     emplace_back(std::move(value)); // Construct element at the back by moving
+
+    CONTAINER_STATS_RECORD(Vector, bytesMoved, sizeof(T));
 }
 
 /**
  * @brief   Removes the last element in the vector by destroying it.
  */
-template<class T, class Allocator>
-void Vector<T, Allocator>::pop_back() noexcept(std::is_nothrow_destructible_v<T>)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::pop_back() noexcept(std::is_nothrow_destructible_v<T>)
 {
     if(size() > 0)
     {
@@ -761,96 +997,68 @@ void Vector<T, Allocator>::pop_back() noexcept(std::is_nothrow_destructible_v<T>
  * @param   last    Iterator specifying the ending point of elements.   (excluded)
  * @return  An iterator that points to the first of the newly inserted elements.
  * @throws  std::invalid_argument   If the given position does not rely inside the container.
- * @throws  std::logic_error        If the iterators are in a wrong order
+ * @note    The source range must not belong to the container itself.
  */
-template<class T, class Allocator>
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
 template <class InputIterator>
-T* Vector<T, Allocator>::insert(iterator position, InputIterator first, InputIterator last)
+T* Vector<T, Allocator, GrowthPolicy, InlineCapacity>::insert(iterator position, InputIterator first, InputIterator last)
 {
     if((position < begin()) || (position > end()))
         throw(std::invalid_argument("Position must rely inside the container!"));
 
-    const difference_type numberOfElements    = std::distance(first, last);
-    const difference_type positionAsIndex     = std::distance(begin(), position);
+    const size_type numberOfElements    = size_type(std::distance(first, last));
+    const size_type positionAsIndex     = size_type(std::distance(begin(), position));
+    size_type constructed               = 0;
 
-    if(size() + numberOfElements > capacity())    // Is bigger space needed?
-    {
-        value_type* newData = nullptr;
-        size_type copied = 0, constructed = 0;
+    if(0 == numberOfElements)   // Nothing to insert
+        return position;
 
-        // Reallocation and construction of the new element
-        newData = std::allocator_traits<Allocator>::allocate(allocator, nextPowerOf2(size() + numberOfElements));
+    // A bigger space is needed or the current content cannot be shifted without the risk of losing it
+    if((size() + numberOfElements > capacity()) || !isShiftingNothrow())
+    {
+        const size_type newCap  = (size() + numberOfElements > capacity()) ? recommendCapacity(cap, size() + numberOfElements) : cap;
+        value_type* newData     = std::allocator_traits<Allocator>::allocate(allocator, newCap);
 
         try{
-            // Construct the new elements
+            // Construct the new elements first, the current content stays untouched if any of them throws
             for( ; (constructed < numberOfElements) && (first != last); ++constructed)
                 std::allocator_traits<Allocator>::construct(allocator, newData + positionAsIndex + constructed, *(first++));
 
-            // Copy the elements on the left side of the requested position
-            for( ; copied < positionAsIndex; ++copied)
-                std::allocator_traits<Allocator>::construct(allocator, newData + copied, *(data + copied));
-
-            // Copy the elements on the right side of the requested position
-            for( ; copied < sz; ++copied)
-                std::allocator_traits<Allocator>::construct(allocator, newData + copied + numberOfElements, *(data + copied));
-
-            // Destroy old content
-            destroyRange(begin(), end());
-            destroyPointer(data);
-
-            // Replace data pointer and capacity
-            data    = newData;
-            cap     = nextPowerOf2(size() + numberOfElements);
-            sz      += numberOfElements;
+            // Relocate the current content around the new elements
+            relocateContent(newData, positionAsIndex, numberOfElements);
         }catch(...){
             // Destruct the new elements
             for( ; constructed > 0; --constructed)
                 std::allocator_traits<Allocator>::destroy(allocator, newData + positionAsIndex + constructed - 1);
 
-            // Destruct items copied to the right side of the requested position
-            for( ; copied > positionAsIndex; --copied)
-                std::allocator_traits<Allocator>::destroy(allocator, newData + copied + numberOfElements - 1);
-
-            // Destruct items copied to the left side of the requested position
-            for( ; copied != 0; --copied)
-                std::allocator_traits<Allocator>::destroy(allocator, newData + copied - 1);
-
-            destroyPointer(newData);
+            destroyPointer(newData, newCap);
 
             throw;  // Propagate the exception
         }
+
+        // Replace data pointer and capacity
+        replaceStorage(newData, newCap);
+        sz += numberOfElements;
     }
     else
     {
-        /* If there wasn't a reallocation, then move constructing the elements
-         * that will locate after the current size is enough. The remaining
-         * ones should only be copy assigned(right shifted). The area located
-         * after the current size is a raw space. */
-        if(numberOfElements <= (size() - positionAsIndex))
-        {
-            moveRangeForward(end() - numberOfElements, end(), end());
+        // Shift right the elements after the requested position
+        openGap(positionAsIndex, numberOfElements);
 
-            /* Moving the element outside of the current size increments the size by one.
-             * Size should be incremented before assignment process as it is vulnerable against exceptions. */
-            const size_type prevSize = sz;
-            sz += numberOfElements;
+        try{
+            // Construct the new elements inside the gap
+            for( ; (constructed < numberOfElements) && (first != last); ++constructed)
+                std::allocator_traits<Allocator>::construct(allocator, data + positionAsIndex + constructed, *(first++));
+        }catch(...){
+            // Destruct the new elements
+            for( ; constructed > 0; --constructed)
+                std::allocator_traits<Allocator>::destroy(allocator, data + positionAsIndex + constructed - 1);
 
-            /* The remaining ones will not be located after the current size.
-             * Hence, we can just copy assign them */
-            assignRangeForward(begin() + positionAsIndex, begin() + prevSize - numberOfElements, begin() + positionAsIndex + numberOfElements);
-        }
-        else
-        {
-            moveRangeForward(begin() + positionAsIndex, end(), end() + (numberOfElements - (size() - positionAsIndex)));
+            // Shift back the elements after the requested position
+            closeGap(positionAsIndex, numberOfElements);
 
-            // Moving the element outside of the current size increments the size by one.
-            sz += numberOfElements;
+            throw;  // Propagate the exception
         }
-
-        // Construct new elements
-        size_type constructed = 0;
-        for( ; (constructed < numberOfElements) && (first != last); ++constructed)
-            *(data + positionAsIndex + constructed) = *(first++);
     }
 
     return (data + positionAsIndex);  // Data pointer may be changed
@@ -863,98 +1071,69 @@ T* Vector<T, Allocator>::insert(iterator position, InputIterator first, InputIte
  * @param   value               Value to be copied to the inserted element
  * @return  An iterator that points to the first of the newly inserted elements.
  * @throws  std::invalid_argument   If the given position does not rely inside the container.
- * @throws  std::invalid_argument   If the number of elements to be inserted is equal to zero.
  */
-template<class T, class Allocator>
-T* Vector<T, Allocator>::insert(iterator position, size_type numberOfElements, const_reference value)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+T* Vector<T, Allocator, GrowthPolicy, InlineCapacity>::insert(iterator position, size_type numberOfElements, const_reference value)
 {
     if((position < begin()) || (position > end()))
         throw(std::invalid_argument("Position must rely inside the container!"));
 
     const size_type positionAsIndex = size_type(std::distance(begin(), position));
+    size_type constructed           = 0;
 
-    if(size() + numberOfElements > capacity())    // Is bigger space needed?
-    {
-        value_type* newData = nullptr;
-        size_type copied = 0, constructed = 0;
+    if(0 == numberOfElements)   // Nothing to insert
+        return position;
 
-        // Reallocation and construction of the new element
-        newData = std::allocator_traits<Allocator>::allocate(allocator, nextPowerOf2(size() + numberOfElements));
+    // A bigger space is needed or the current content cannot be shifted without the risk of losing it
+    if((size() + numberOfElements > capacity()) || !isShiftingNothrow())
+    {
+        const size_type newCap  = (size() + numberOfElements > capacity()) ? recommendCapacity(cap, size() + numberOfElements) : cap;
+        value_type* newData     = std::allocator_traits<Allocator>::allocate(allocator, newCap);
 
         try{
-            // Construct the new elements
+            // Construct the new elements first, the value may refer to an element of the current content
             for( ; constructed < numberOfElements; ++constructed)
                 std::allocator_traits<Allocator>::construct(allocator, newData + positionAsIndex + constructed, value);
 
-            // Copy the elements on the left side of the requested position
-            for( ; copied < positionAsIndex; ++copied)
-                std::allocator_traits<Allocator>::construct(allocator, newData + copied, *(data + copied));
-
-            // Copy the elements on the right side of the requested position
-            for( ; copied < sz; ++copied)
-                std::allocator_traits<Allocator>::construct(allocator, newData + copied + numberOfElements, *(data + copied));
-
-            // Destroy old content
-            destroyRange(begin(), end());
-            destroyPointer(data);
-
-            // Replace data pointer and capacity
-            data    = newData;
-            cap     = nextPowerOf2(size() + numberOfElements);
-            sz += numberOfElements;
+            // Relocate the current content around the new elements
+            relocateContent(newData, positionAsIndex, numberOfElements);
         }catch(...){
             // Destruct the new elements
             for( ; constructed > 0; --constructed)
                 std::allocator_traits<Allocator>::destroy(allocator, newData + positionAsIndex + constructed - 1);
 
-            // Destruct items copied to the right side of the requested position
-            for( ; copied > positionAsIndex; --copied)
-                std::allocator_traits<Allocator>::destroy(allocator, newData + copied + numberOfElements - 1);
-
-            // Destruct items copied to the left side of the requested position
-            for( ; copied != 0; --copied)
-                std::allocator_traits<Allocator>::destroy(allocator, newData + copied - 1);
-
-            destroyPointer(newData);
+            destroyPointer(newData, newCap);
 
             throw;  // Propagate the exception
         }
+
+        // Replace data pointer and capacity
+        replaceStorage(newData, newCap);
+        sz += numberOfElements;
     }
     else
     {
         /* The new element may already be an element of the current Vector
-         * Thus, we shall create a copy of it. */
+         * Thus, we shall create a copy of it before shifting the elements. */
         value_type temp(value);
 
-        /* If there wasn't a reallocation, then move constructing the elements
-         * that will locate after the current size is enough. The remaining
-         * ones should only be copy assigned(right shifted). The area located
-         * after the current size is a raw space. */
-        if(numberOfElements <= (size() - positionAsIndex))
-        {
-            moveRangeForward(end() - numberOfElements, end(), end());
+        // Shift right the elements after the requested position
+        openGap(positionAsIndex, numberOfElements);
 
-            /* Moving the element outside of the current size increments the size by one.
-             * Size should be incremented before assignment process as it is vulnerable against exceptions. */
-            const size_type prevSize = sz;
-            sz += numberOfElements;
+        try{
+            // Construct the new elements inside the gap
+            for( ; constructed < numberOfElements; ++constructed)
+                std::allocator_traits<Allocator>::construct(allocator, data + positionAsIndex + constructed, temp);
+        }catch(...){
+            // Destruct the new elements
+            for( ; constructed > 0; --constructed)
+                std::allocator_traits<Allocator>::destroy(allocator, data + positionAsIndex + constructed - 1);
 
-            /* The remaining ones will not be located after the current size.
-             * Hence, we can just copy assign them */
-            assignRangeForward(begin() + positionAsIndex, begin() + prevSize - numberOfElements, begin() + positionAsIndex + numberOfElements);
-        }
-        else
-        {
-            moveRangeForward(begin() + positionAsIndex, end(), end() + (numberOfElements - (size() - positionAsIndex)));
+            // Shift back the elements after the requested position
+            closeGap(positionAsIndex, numberOfElements);
 
-            // Moving the element outside of the current size increments the size by one.
-            sz += numberOfElements;
+            throw;  // Propagate the exception
         }
-
-        // Construct new elements
-        size_type constructed = 0;
-        for( ; constructed < numberOfElements; ++constructed)
-            *(data + positionAsIndex + constructed) = std::move(temp);
     }
 
     return (data + positionAsIndex);  // Data pointer may be changed
@@ -967,94 +1146,10 @@ T* Vector<T, Allocator>::insert(iterator position, size_type numberOfElements, c
  * @return  An iterator that points to the newly inserted element.
  * @throws  std::invalid_argument   If the given position does not rely inside the container.
  */
-template<class T, class Allocator>
-T* Vector<T, Allocator>::insert(iterator position, const_reference value)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+T* Vector<T, Allocator, GrowthPolicy, InlineCapacity>::insert(iterator position, const_reference value)
 {
-    if((position < begin()) || (position > end()))
-        throw(std::invalid_argument("Position must rely inside the container!"));
-
-    if(position == end())
-    {
-        push_back(value);
-
-        return (end() - 1);     // end() may be changed
-    }
-
-    const size_type positionAsIndex = size_type(std::distance(begin(), position));
-
-    if(size() == capacity())    // Is bigger space needed?
-    {
-        value_type* newData = nullptr;
-        size_type numOfCopied = 0, constructed = 0;
-
-        // Reallocation and construction of the new element
-        newData = std::allocator_traits<Allocator>::allocate(allocator, nextPowerOf2(cap));
-
-        try{
-            // Construct the new element
-            std::allocator_traits<Allocator>::construct(allocator, newData + positionAsIndex, value);
-            ++constructed;
-
-            // Copy the elements on the left side of the requested position
-            for( ; numOfCopied < positionAsIndex; ++numOfCopied)
-                std::allocator_traits<Allocator>::construct(allocator, newData + numOfCopied, *(data + numOfCopied));
-
-            // Copy the elements on the right side of the requested position
-            for( ; numOfCopied < sz; ++numOfCopied)
-                std::allocator_traits<Allocator>::construct(allocator, newData + numOfCopied + 1, *(data + numOfCopied));
-
-            // Destroy old content
-            destroyRange(begin(), end());
-            destroyPointer(data);
-
-            // Replace data pointer and capacity
-            data    = newData;
-            cap     = nextPowerOf2(cap);
-            ++sz;
-        }catch(...){
-            // Destruct the new element
-            if(0 != constructed)
-                std::allocator_traits<Allocator>::destroy(allocator, newData + positionAsIndex);
-
-            // Destruct items copied to the right side of the requested position
-            for( ; numOfCopied > positionAsIndex; --numOfCopied)
-                std::allocator_traits<Allocator>::destroy(allocator, newData + numOfCopied);
-
-            // Destruct items copied to the left side of the requested position
-            for( ; numOfCopied != 0; --numOfCopied)
-                std::allocator_traits<Allocator>::destroy(allocator, newData + numOfCopied - 1);
-
-            destroyPointer(newData);
-
-            throw;  // Propagate the exception
-        }
-    }
-    else
-    {
-        /* The new element may already be an element of the current Vector
-         * Thus, we shall create a copy of it. */
-        value_type temp(value);
-
-        /* If there wasn't a reallocation, then move constructing the elements
-         * that will locate after the current size is enough. The remaining
-         * ones should only be copy assigned(right shifted). The area located
-         * after the current size is a raw space. */
-        moveRangeForward(end() - 1, end(), end());
-
-        /* Moving the element outside of the current size increments the size by one.
-         * Size should be incremented before assignment process as it is vulnerable against exceptions. */
-        ++sz;
-
-        /* The remaining ones will not be located after the current size.
-         * Hence, we can just copy assign them */
-        assignRangeBackward(position, end() - 2, position + 1);
-
-        /* The new element will also be located inside the currently used space,
-         * so it can also be copy assigned */
-        *(data + positionAsIndex) = std::move(temp);
-    }
-
-    return (data + positionAsIndex);  // Data pointer may be changed
+    return emplace(position, value);    // Construct the new element by copying
 }
 
 /**
@@ -1064,90 +1159,10 @@ T* Vector<T, Allocator>::insert(iterator position, const_reference value)
  * @return  An iterator that points to the newly inserted element.
  * @throws  std::invalid_argument   If the given position does not rely inside the container.
  */
-template<class T, class Allocator>
-T* Vector<T, Allocator>::insert(iterator position, value_type&& value)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+T* Vector<T, Allocator, GrowthPolicy, InlineCapacity>::insert(iterator position, value_type&& value)
 {
-    if((position < begin()) || (position > end()))
-        throw(std::invalid_argument("Position must rely inside the container!"));
-
-    if(position == end())
-    {
-        push_back(std::move(value));
-
-        return (end() - 1);     // end() may be changed
-    }
-
-    const size_type positionAsIndex = size_type(std::distance(begin(), position));
-
-    if(size() == capacity())    // Is bigger space needed?
-    {
-        value_type* newData = nullptr;
-        size_type numOfCopied = 0, constructed = 0;
-
-        // Reallocation and construction of new element
-        newData = std::allocator_traits<Allocator>::allocate(allocator, nextPowerOf2(cap));
-
-        try{
-            // Construct the new element
-            std::allocator_traits<Allocator>::construct(allocator, newData + positionAsIndex, std::move(value));
-            ++constructed;
-
-            // Copy the elements on the left side of the requested position
-            for( ; numOfCopied < positionAsIndex; ++numOfCopied)
-                std::allocator_traits<Allocator>::construct(allocator, newData + numOfCopied, *(data + numOfCopied));
-
-            // Copy the elements on the right side of the requested position
-            for( ; numOfCopied < sz; ++numOfCopied)
-                std::allocator_traits<Allocator>::construct(allocator, newData + numOfCopied + 1, *(data + numOfCopied));
-
-            // Destroy old content
-            destroyRange(begin(), end());
-            destroyPointer(data);
-
-            // Replace data pointer and capacity
-            data    = newData;
-            cap     = nextPowerOf2(cap);
-            ++sz;
-        }catch(...){
-            // Destruct new element
-            if(0 != constructed)
-                std::allocator_traits<Allocator>::destroy(allocator, newData + positionAsIndex);
-
-            // Destruct items copied to the right side of the requested position
-            for( ; numOfCopied > positionAsIndex; --numOfCopied)
-                std::allocator_traits<Allocator>::destroy(allocator, newData + numOfCopied);
-
-            // Destruct items copied to the left side of the requested position
-            for( ; numOfCopied != 0; --numOfCopied)
-                std::allocator_traits<Allocator>::destroy(allocator, newData + numOfCopied - 1);
-
-            destroyPointer(newData);
-
-            throw;  // Propagate the exception
-        }
-    }
-    else
-    {
-        /* If there wasn't a reallocation, then move constructing the elements
-         * that will locate after the current size is enough. The remaining
-         * ones should only be copy assigned(right shifted). The area located
-         * after the current size is a raw space. */
-        moveRangeForward(end() - 1, end(), end());
-
-        /* Moving the element outside of the current size increments the size by one.
-         * Size should be incremented before assignment process as it is vulnerable against exceptions. */
-        ++sz;
-
-        /* The remaining ones will not be located after the current size.
-         * Hence, we can just copy assign them */
-        assignRangeBackward(position, end() - 2, position + 1);
-
-        /* The new element will also be located inside the currently used space,
-         * so it can also be copy assigned */
-        *(data + positionAsIndex) = std::move(value);
-    }
-
-    return (data + positionAsIndex);  // Data pointer may be changed
+    return emplace(position, std::move(value)); // Construct the new element by moving
 }
 
 /**
@@ -1157,8 +1172,8 @@ T* Vector<T, Allocator>::insert(iterator position, value_type&& value)
  * @return  An iterator that points to the newly inserted element.
  * @throws  std::invalid_argument   If the given position does not rely inside the container.
  */
-template<class T, class Allocator>
-T* Vector<T, Allocator>::insert(iterator position, std::initializer_list<value_type> initializerList)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+T* Vector<T, Allocator, GrowthPolicy, InlineCapacity>::insert(iterator position, std::initializer_list<value_type> initializerList)
 {
     if((position < begin()) || (position > end()))
         throw(std::invalid_argument("Position must rely inside the container!"));
@@ -1172,8 +1187,8 @@ T* Vector<T, Allocator>::insert(iterator position, std::initializer_list<value_t
  * @return  An iterator pointing to the element that follows the erased element.
  * @throws  std::invalid_argument   If the given position does not rely inside the container.
  */
-template<class T, class Allocator>
-T* Vector<T, Allocator>::erase(iterator position)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+T* Vector<T, Allocator, GrowthPolicy, InlineCapacity>::erase(iterator position)
 {
     if((position < begin()) || (position >= end()))
         throw(std::invalid_argument("Position must rely inside the container!"));
@@ -1200,8 +1215,8 @@ T* Vector<T, Allocator>::erase(iterator position)
  * @throws  std::invalid_argument   If the given positions does not rely inside the container.
  * @throws  std::invalid_argument   If the given positions doesn't have valid order.
  */
-template<class T, class Allocator>
-T* Vector<T, Allocator>::erase(iterator first, iterator last)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+T* Vector<T, Allocator, GrowthPolicy, InlineCapacity>::erase(iterator first, iterator last)
 {
     if((first < begin()) || (last > end()))
         throw(std::invalid_argument("Iterators must rely inside the container!"));
@@ -1218,16 +1233,121 @@ T* Vector<T, Allocator>::erase(iterator first, iterator last)
     return first;
 }
 
+/**
+ * @brief   Erases all elements for which the predicate returns true
+ * @param   pred    Unary predicate taking a constant reference to an element
+ * @return  Number of erased elements
+ * @note    The kept elements are compacted in a single pass and the tail is destroyed once,
+ *          instead of shifting the tail for each erased element.
+ * @note    Trivially copyable elements are copied without branching on the result of the predicate.
+ * @note    If the predicate throws, the elements examined until then are erased and the others are kept.
+ */
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+template<class Predicate>
+std::size_t Vector<T, Allocator, GrowthPolicy, InlineCapacity>::erase_if(Predicate pred)
+{
+    size_type readIdx = 0;
+
+    // Elements preceding the first erased one stay in place
+    while((readIdx < sz) && !pred(static_cast<const_reference>(data[readIdx])))
+        ++readIdx;
+
+    size_type writeIdx = readIdx;
+
+    try {
+        for( ; readIdx < sz; ++readIdx)
+        {
+            if constexpr(std::is_trivially_copyable_v<T>)
+            {
+                const bool isKept = !pred(static_cast<const_reference>(data[readIdx]));
+
+                data[writeIdx] = data[readIdx];
+                writeIdx += size_type(isKept);
+            }
+            else if(!pred(static_cast<const_reference>(data[readIdx])))
+            {
+                data[writeIdx] = std::move(data[readIdx]);
+                ++writeIdx;
+            }
+        }
+    }
+    catch(...) {
+        // Keep the unexamined elements by closing the gap of the erased ones
+        assignRangeForward(std::make_move_iterator(begin() + readIdx), std::make_move_iterator(end()), begin() + writeIdx);
+        writeIdx += (sz - readIdx);
+
+        destroyRange(begin() + writeIdx, end());
+        sz = writeIdx;
+
+        throw;  // Propagate exception
+    }
+
+    const size_type erasedCount = sz - writeIdx;
+
+    destroyRange(begin() + writeIdx, end());
+    sz = writeIdx;
+
+    return erasedCount;
+}
+
+/**
+ * @brief   Erases all elements which are equal to the given value
+ * @param   value   Value to be erased, must not refer to an element of this vector unless it is trivially copyable
+ * @return  Number of erased elements
+ * @note    Elements of the vectorizable types(e.g. integers) are compacted by the vectorized kernel, see SimdKernels.h.
+ */
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+std::size_t Vector<T, Allocator, GrowthPolicy, InlineCapacity>::remove_all(const_reference value)
+{
+    if constexpr(SimdKernels::is_vectorizable_v<T>)
+    {
+        const size_type keptCount   = SimdKernels::removeEqual(data, sz, value);
+        const size_type erasedCount = sz - keptCount;
+
+        destroyRange(begin() + keptCount, end());
+        sz = keptCount;
+
+        return erasedCount;
+    }
+    else if constexpr(std::is_trivially_copyable_v<T>)
+    {
+        const value_type key = value;   // The referred element may be overwritten
+
+        return erase_if([&key](const_reference element) { return (element == key); });
+    }
+    else
+        return erase_if([&value](const_reference element) { return (element == value); });
+}
+
 /**
  * @brief   Swaps the contents of two vectors
  * @param   swapVector  Vector to be swapped with
+ * @note    Allocators are swapped only if they propagate on swap, otherwise they must compare equal.
+ * @note    Inline elements cannot be swapped by pointers, they are relocated one by one.
  */
-template<class T, class Allocator>
-void Vector<T, Allocator>::swap(Vector& swapVector) noexcept(std::is_nothrow_swappable_v<T*>)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::swap(Vector& swapVector) noexcept(isInlineRelocationNothrow())
 {
     if(this == &swapVector) // Check self swap
         return;
 
+    if constexpr(std::allocator_traits<Allocator>::propagate_on_container_swap::value)
+    {
+        using std::swap;
+        swap(allocator, swapVector.allocator);
+    }
+
+    if(is_inline() || swapVector.is_inline())
+    {
+        Vector temp(swapVector.allocator);
+
+        temp.stealContent(swapVector);
+        swapVector.stealContent(*this);
+        stealContent(temp);
+
+        return;
+    }
+
     value_type* tempData;
     size_type tempSzCap;
 
@@ -1249,82 +1369,72 @@ void Vector<T, Allocator>::swap(Vector& swapVector) noexcept(std::is_nothrow_swa
  * @param   position    Position in the vector where the new elements are inserted.
  * @param   args        Arguments to be used when constructing the new element
  * @return  An iterator that points to the newly inserted element.
+ * @throws  std::invalid_argument   If the given position does not rely inside the container.
  */
-template<class T, class Allocator>
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
 template <class... Args>
-T* Vector<T, Allocator>::emplace(iterator position, Args&&... args)
+T* Vector<T, Allocator, GrowthPolicy, InlineCapacity>::emplace(iterator position, Args&&... args)
 {
     if((position < begin()) || (position > end()))
         throw(std::invalid_argument("Position must rely inside the container!"));
 
     const size_type positionAsIndex = size_type(std::distance(begin(), position));
 
-    if(size() == capacity())    // Is bigger space needed?
+    // A bigger space is needed or the elements after the position cannot be shifted without the risk of losing them
+    if((size() == capacity()) || ((position != end()) && !isShiftingNothrow()))
     {
-        value_type* newData = nullptr;
-        size_type numOfCopied = 0, constructed = 0;
-
-        // Reallocation and construction of the new element
-        newData = std::allocator_traits<Allocator>::allocate(allocator, nextPowerOf2(cap));
+        const size_type newCap  = (size() == capacity()) ? recommendCapacity(cap, size() + 1) : cap;
+        value_type* newData     = std::allocator_traits<Allocator>::allocate(allocator, newCap);
 
         try{
-            // Construct the new element
+            // Construct the new element first as the arguments may refer to the current content
             std::allocator_traits<Allocator>::construct(allocator, newData + positionAsIndex, std::forward<Args>(args)...);
-            ++constructed;
-
-            // Copy the elements on the left side of the requested position
-            for( ; numOfCopied < positionAsIndex; ++numOfCopied)
-                std::allocator_traits<Allocator>::construct(allocator, newData + numOfCopied, *(data + numOfCopied));
-
-            // Copy the elements on the right side of the requested position
-            for( ; numOfCopied < sz; ++numOfCopied)
-                std::allocator_traits<Allocator>::construct(allocator, newData + numOfCopied + 1, *(data + numOfCopied));
+        }catch(...){
+            destroyPointer(newData, newCap);
 
-            // Destroy old content
-            destroyRange(begin(), end());
-            destroyPointer(data);
+            throw;  // Propagate the exception
+        }
 
-            // Replace data pointer and capacity
-            data    = newData;
-            cap     = nextPowerOf2(cap);
-            ++sz;
+        try{
+            // Relocate the current content around the new element
+            relocateContent(newData, positionAsIndex, 1);
         }catch(...){
             // Destruct the new element
-            if(0 != constructed)
-                std::allocator_traits<Allocator>::destroy(allocator, newData + positionAsIndex);
-
-            // Destruct items copied to the right side of the requested position
-            for( ; numOfCopied > positionAsIndex; --numOfCopied)
-                std::allocator_traits<Allocator>::destroy(allocator, newData + numOfCopied);
+            std::allocator_traits<Allocator>::destroy(allocator, newData + positionAsIndex);
 
-            // Destruct items copied to the left side of the requested position
-            for( ; numOfCopied != 0; --numOfCopied)
-                std::allocator_traits<Allocator>::destroy(allocator, newData + numOfCopied - 1);
-
-            destroyPointer(newData);
+            destroyPointer(newData, newCap);
 
             throw;  // Propagate the exception
         }
+
+        // Replace data pointer and capacity
+        replaceStorage(newData, newCap);
+        ++sz;
     }
-    else
+    else if(position == end())
     {
-        /* If there wasn't a reallocation, then move constructing the elements
-         * that will locate after the current size is enough. The remaining
-         * ones should only be copy assigned(right shifted). The area located
-         * after the current size is a raw space. */
-        moveRangeForward(end() - 1, end(), end());
-
-        /* Moving the element outside of the current size increments the size by one.
-         * Size should be incremented before assignment process as it is vulnerable against exceptions. */
+        // The area located after the current size is a raw space
+        std::allocator_traits<Allocator>::construct(allocator, data + sz, std::forward<Args>(args)...);
         ++sz;
+    }
+    else
+    {
+        /* The arguments may refer to an element which is about to be shifted.
+         * Thus, the new element shall be constructed before opening the gap. */
+        value_type temp(std::forward<Args>(args)...);
+
+        // Shift right the elements after the requested position
+        openGap(positionAsIndex, 1);
 
-        /* The remaining ones will not be located after the current size.
-         * Hence, we can just copy assign them */
-        assignRangeBackward(position, end() - 2, position + 1);
+        try{
+            // Construct the new element inside the gap
+            std::allocator_traits<Allocator>::construct(allocator, data + positionAsIndex, std::move(temp));
+        }catch(...){
+            // Shift back the elements after the requested position
+            closeGap(positionAsIndex, 1);
 
-        /* The new element will also be located inside the currently used space,
-         * so it can also be copy assigned */
-        std::allocator_traits<Allocator>::construct(allocator, position, std::forward<Args>(args)...);
+            throw;  // Propagate the exception
+        }
     }
 
     return (data + positionAsIndex);  // Data may be changed
@@ -1334,34 +1444,134 @@ T* Vector<T, Allocator>::emplace(iterator position, Args&&... args)
  * @brief   Constructs and inserts element at the end of the container.
  * @param   args    Arguments to be used when constructing the new element
  */
-template<class T, class Allocator>
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
 template <class... Args>
-void Vector<T, Allocator>::emplace_back(Args&&... args)
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::emplace_back(Args&&... args)
 {
     if(size() == capacity())    // Size is about to surpass the capacity
     {
-        value_type* newData = grow(nextPowerOf2(cap), true);   // Grow and copy the current content
-
-        // Destroy old content
-        destroyRange(begin(), end());
-        destroyPointer(data);
+        emplace(end(), std::forward<Args>(args)...);    // Reallocate and construct the new element
 
-        data    = newData;
-        cap     = nextPowerOf2(cap);
+        return;
     }
 
-    // Copy construct new element with the incoming one
+    // Construct new element with the incoming arguments
     std::allocator_traits<Allocator>::construct(allocator, data + sz, std::forward<Args>(args)...);
 
     ++sz;   // Size will not be incremented in case of a previous exception
 }
 
+/**
+ * @brief   Appends a range of elements at the end of the container.
+ * @param   first   Iterator specifying the starting point of elements.
+ * @param   last    Iterator specifying the ending point of elements.   (excluded)
+ * @note    The capacity is checked once for the whole range, the container is reallocated at most once.
+ * @note    Trivially copyable elements coming from a contiguous range are copied in bulk.
+ * @note    The source range may belong to the container itself.
+ */
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+template<class InputIterator>
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::append(InputIterator first, InputIterator last)
+{
+    const size_type numberOfElements = size_type(std::distance(first, last));
+
+    if(0 == numberOfElements)
+        return;
+
+    if(size() + numberOfElements > capacity())    // Is bigger space needed?
+    {
+        const size_type newCap  = recommendCapacity(cap, size() + numberOfElements);
+        value_type* newData     = std::allocator_traits<Allocator>::allocate(allocator, newCap);
+
+        try{
+            // Copy the new elements first as the source range may refer to the current content
+            copyRangeForward(first, last, newData + sz);
+        }catch(...){
+            destroyPointer(newData, newCap);
+
+            throw;  // Propagate the exception
+        }
+
+        try{
+            // Relocate the current content in front of the new elements
+            relocateContent(newData);
+        }catch(...){
+            destroyRange(newData + sz, newData + sz + numberOfElements);
+            destroyPointer(newData, newCap);
+
+            throw;  // Propagate the exception
+        }
+
+        replaceStorage(newData, newCap);
+    }
+    else
+    {
+        // The area located after the current size is a raw space, it cannot overlap with the source
+        copyRangeForward(first, last, data + sz);
+    }
+
+    sz += numberOfElements;
+}
+
+/**
+ * @brief   Resizes the container without initializing the additional elements.
+ * @param   newSize Requested size.
+ * @note    The additional elements have indeterminate values, they shall be written before being read.
+ * @note    Only available for trivial types as their construction and destruction can be skipped.
+ */
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::resize_uninitialized(const size_type newSize)
+{
+    static_assert(std::is_trivial_v<T>, "Uninitialized resize is only available for trivial types!");
+
+    if(newSize > capacity())    // Is reallocation needed?
+    {
+        const size_type newCap  = recommendCapacity(cap, newSize);
+        value_type* newData     = grow(newCap, true);   // Grow and relocate the current content
+
+        replaceStorage(newData, newCap);
+    }
+
+    sz = newSize;
+}
+
+/**
+ * @brief   Resizes the container to at most given number of elements and lets the operation write the content.
+ * @param   maxSize Maximum number of elements the operation can write
+ * @param   op      Operation to be called with the data pointer and the maximum size, returns the final size
+ * @throws  std::length_error   If the returned size is bigger than the maximum size
+ * @note    The elements after the current size have indeterminate values when the operation is called.
+ * @note    The container remains in its previous size if the operation throws.
+ * @note    Only available for trivial types as their construction and destruction can be skipped.
+ */
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+template<class Operation>
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::resize_and_overwrite(const size_type maxSize, Operation op)
+{
+    static_assert(std::is_trivial_v<T>, "Overwriting resize is only available for trivial types!");
+
+    if(maxSize > capacity())    // Is reallocation needed?
+    {
+        const size_type newCap  = recommendCapacity(cap, maxSize);
+        value_type* newData     = grow(newCap, true);   // Grow and relocate the current content
+
+        replaceStorage(newData, newCap);
+    }
+
+    const size_type newSize = size_type(op(data, maxSize));
+
+    if(newSize > maxSize)
+        throw std::length_error("Operation cannot write more than the maximum size!");
+
+    sz = newSize;
+}
+
 /**
  * @brief   Resizes the container so that it contains given number of elements.
  * @param   newSize Requested size.
  */
-template<class T, class Allocator>
-void Vector<T, Allocator>::resize(const size_type newSize)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::resize(const size_type newSize)
 {
     if(0 == newSize)
     {
@@ -1379,7 +1589,7 @@ void Vector<T, Allocator>::resize(const size_type newSize)
     {
         size_type constructed = 0;
 
-        if(newSize < capacity())    // Is reallocation needed?
+        if(newSize <= capacity())   // Is reallocation needed?
         {
             try {
                 // Default construct the additional elements
@@ -1395,32 +1605,27 @@ void Vector<T, Allocator>::resize(const size_type newSize)
         }
         else    // Reallocation needed
         {
-            value_type* newData = grow(newSize, true);  // Grow and preserve the content
+            const size_type newCap  = recommendCapacity(cap, newSize);
+            value_type* newData     = std::allocator_traits<Allocator>::allocate(allocator, newCap);
 
             try {
                 // Default construct the additional elements
                 for( ; constructed < (newSize - sz); ++constructed)
                     std::allocator_traits<Allocator>::construct(allocator, newData + sz + constructed);
+
+                // Relocate the current content in front of the additional elements
+                relocateContent(newData);
             }catch(...){
                 // Destruct all new elements and preserve the last state
                 for( ; constructed > 0; --constructed)
-                    std::allocator_traits<Allocator>::destroy(allocator, newData + size() + constructed - 1);
+                    std::allocator_traits<Allocator>::destroy(allocator, newData + sz + constructed - 1);
 
-                // Destroy copied elements
-                for(size_type index = 0; index < size(); ++index)
-                    std::allocator_traits<Allocator>::destroy(allocator, newData + index);
-
-                destroyPointer(newData);
+                destroyPointer(newData, newCap);
 
                 throw; // Propagate exception
             }
 
-            // Destroy old content
-            destroyRange(begin(), end());
-            destroyPointer(data);
-
-            data    = newData;
-            cap     = newSize;
+            replaceStorage(newData, newCap);
         }
     }
 
@@ -1432,8 +1637,8 @@ void Vector<T, Allocator>::resize(const size_type newSize)
  * @param   newSize     Requested size.
  * @param   fillValue   Value to be copied into newly added elements.
  */
-template<class T, class Allocator>
-void Vector<T, Allocator>::resize(const size_type newSize, const_reference fillValue)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::resize(const size_type newSize, const_reference fillValue)
 {
     if(0 == newSize)
     {
@@ -1451,10 +1656,10 @@ void Vector<T, Allocator>::resize(const size_type newSize, const_reference fillV
     {
         size_type constructed = 0;
 
-        if(newSize < capacity())    // Is reallocation needed?
+        if(newSize <= capacity())   // Is reallocation needed?
         {
             try {
-                // Default construct the additional elements
+                // Copy construct the additional elements
                 for( ; constructed < (newSize - sz); ++constructed)
                     std::allocator_traits<Allocator>::construct(allocator, data + sz + constructed, fillValue);
             }catch(...){
@@ -1467,32 +1672,27 @@ void Vector<T, Allocator>::resize(const size_type newSize, const_reference fillV
         }
         else    // Reallocation needed
         {
-            value_type* newData = grow(newSize, true);  // Grow and preserve the content
+            const size_type newCap  = recommendCapacity(cap, newSize);
+            value_type* newData     = std::allocator_traits<Allocator>::allocate(allocator, newCap);
 
             try {
-                // Default construct the additional elements
+                // Copy construct the additional elements, the fill value may refer to the current content
                 for( ; constructed < (newSize - sz); ++constructed)
                     std::allocator_traits<Allocator>::construct(allocator, newData + sz + constructed, fillValue);
+
+                // Relocate the current content in front of the additional elements
+                relocateContent(newData);
             }catch(...){
                 // Destruct all new elements and preserve the last state
                 for( ; constructed > 0; --constructed)
                     std::allocator_traits<Allocator>::destroy(allocator, newData + size() + constructed - 1);
 
-                // Destroy copied elements
-                for(size_type index = 0; index < size(); ++index)
-                    std::allocator_traits<Allocator>::destroy(allocator, newData + index);
-
-                destroyPointer(newData);
+                destroyPointer(newData, newCap);
 
                 throw; // Propagate exception
             }
 
-            // Destroy old content
-            destroyRange(begin(), end());
-            destroyPointer(data);
-
-            data    = newData;
-            cap     = newSize;
+            replaceStorage(newData, newCap);
         }
     }
 
@@ -1503,52 +1703,49 @@ void Vector<T, Allocator>::resize(const size_type newSize, const_reference fillV
  * @brief   Requests that the vector capacity be at least enough to contain requested number of elements.
  * @param   reservationSize     Minimum capacity for the vector.
  */
-template<class T, class Allocator>
-void Vector<T, Allocator>::reserve(const size_type reservationSize)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::reserve(const size_type reservationSize)
 {
     if(reservationSize <= capacity())
         return;
 
-    value_type* newData = grow(reservationSize, true);
+    value_type* newData = grow(reservationSize, true);  // Grow and relocate the current content
 
-    destroyRange(begin(), end());
-    destroyPointer(data);
-    data    = newData;
-    cap     = reservationSize;
+    replaceStorage(newData, reservationSize);
 }
 
 /**
  * @brief   Requests the container to reduce its capacity to fit its size
  * @note    Caueses reallocation if the current size is not equal to the current capacity.
+ * @note    Content is moved back to the inline buffer if it fits.
  */
-template<class T, class Allocator>
-void Vector<T, Allocator>::shrink_to_fit()
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::shrink_to_fit()
 {
-    if(size() == capacity())
+    if((size() == capacity()) || is_inline())   // Inline buffer cannot be shrunk
         return;
 
-    value_type* newData = std::allocator_traits<Allocator>::allocate(allocator, size());
-    size_type copied    = 0;
+    if(empty()) // No need to allocate an empty space
+    {
+        destroyPointer(data, cap);
 
-    try{
-        // Copy construct current elements
-        for( ; copied < sz; ++copied)
-            std::allocator_traits<Allocator>::construct(allocator, newData + copied, *(data + copied));
-    }catch(...){
-        // Destruct copied elements
-        for( ; 0 < copied; --copied)
-            std::allocator_traits<Allocator>::destroy(allocator, newData + copied - 1);
+        data    = inlineBuffer();
+        cap     = InlineCapacity;
+
+        return;
+    }
 
-        destroyPointer(newData);
+    if(size() <= InlineCapacity)
+    {
+        relocateContent(inlineBuffer());
+        replaceStorage(inlineBuffer(), InlineCapacity);
 
-        throw; // Propagate exception
+        return;
     }
 
-    destroyRange(begin(), end());
-    destroyPointer(data);
+    value_type* newData = grow(size(), true);   // Relocate the current content to a smaller space
 
-    data = newData;
-    cap = size();
+    replaceStorage(newData, size());
 }
 
 /**
@@ -1558,9 +1755,9 @@ void Vector<T, Allocator>::shrink_to_fit()
  * @param   destination     Starting point of destination range
  * @note    Do not use if the ranges overlaps each other
  */
-template<class T, class Allocator>
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
 template<class InputIterator>
-void Vector<T, Allocator>::assignRangeForward(InputIterator from, InputIterator to, iterator destination)
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::assignRangeForward(InputIterator from, InputIterator to, iterator destination)
 {
     for( ; from != to; ++from, ++destination)
         *destination = *from;
@@ -1573,9 +1770,9 @@ void Vector<T, Allocator>::assignRangeForward(InputIterator from, InputIterator
  * @param   destination     Starting point of destination range
  * @note    Use if the ranges overlaps each other
  */
-template<class T, class Allocator>
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
 template<class InputIterator>
-void Vector<T, Allocator>::assignRangeBackward(InputIterator from, InputIterator to, iterator destination)
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::assignRangeBackward(InputIterator from, InputIterator to, iterator destination)
 {
     /* Backward assigning will help to prevent corruption of data
      * when two ranges overlap each other. */
@@ -1592,10 +1789,12 @@ void Vector<T, Allocator>::assignRangeBackward(InputIterator from, InputIterator
  * @param   destination     Starting point of destination range
  * @note    Do not use if the ranges overlaps each other
  */
-template<class T, class Allocator>
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
 template<class InputIterator>
-void Vector<T, Allocator>::moveRangeForward(InputIterator from, InputIterator to, iterator destination)
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::moveRangeForward(InputIterator from, InputIterator to, iterator destination)
 {
+    CONTAINER_STATS_RECORD(Vector, bytesMoved, size_type(std::distance(from, to)) * sizeof(T));
+
     for( ; from != to; ++from, ++destination)
         std::allocator_traits<Allocator>::construct(allocator, destination, std::move(*from));
 }
@@ -1604,15 +1803,41 @@ void Vector<T, Allocator>::moveRangeForward(InputIterator from, InputIterator to
  * @brief   Helper method for copying ranges in a forward order.
  * @param   from            Starting point of source range
  * @param   to              Ending point of source range(excluded)
- * @param   destination     Starting point of destination range
+ * @param   destination     Starting point of uninitialized destination range
  * @note    Do not use if the ranges overlaps each other
+ * @note    Trivially copyable elements are copied in bulk if the source is a contiguous range of the same type.
+ * @note    The destination range is left uninitialized in case of an exception.
  */
-template<class T, class Allocator>
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
 template<class InputIterator>
-void Vector<T, Allocator>::copyRangeForward(InputIterator from, InputIterator to, iterator destination)
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::copyRangeForward(InputIterator from, InputIterator to, iterator destination)
 {
-    for( ; from != to; ++from, ++destination)
-        std::allocator_traits<Allocator>::construct(allocator, destination, *from);
+    // Raw pointers are the only contiguous iterators that can be detected before C++20
+    constexpr bool isContiguousSource = std::is_pointer_v<InputIterator> &&
+                                        std::is_same_v<std::remove_cv_t<std::remove_pointer_t<InputIterator>>, T>;
+
+    if constexpr(isContiguousSource && std::is_trivially_copyable_v<T>)
+    {
+        if(from != to)  // Null pointers shall not be passed to std::memcpy
+            std::memcpy(static_cast<void*>(destination), static_cast<const void*>(from), size_type(to - from) * sizeof(T));
+
+        CONTAINER_STATS_RECORD(Vector, bytesCopied, size_type(to - from) * sizeof(T));
+    }
+    else
+    {
+        iterator current = destination;
+
+        try {
+            for( ; from != to; ++from, ++current)
+                std::allocator_traits<Allocator>::construct(allocator, current, *from);
+        }catch(...){
+            destroyRange(destination, current);     // Destruct copied elements
+
+            throw;  // Propagate exception
+        }
+
+        CONTAINER_STATS_RECORD(Vector, bytesCopied, size_type(current - destination) * sizeof(T));
+    }
 }
 
 /**
@@ -1621,8 +1846,8 @@ void Vector<T, Allocator>::copyRangeForward(InputIterator from, InputIterator to
  * @param   to      Ending point of destination range(excluded)
  * @param   value   Value to be copy assigned to the elements in the destination range.
  */
-template<class T, class Allocator>
-void Vector<T, Allocator>::copyRangeForward(iterator from, iterator to, const_reference value)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::copyRangeForward(iterator from, iterator to, const_reference value)
 {
     for( ; from != to; ++from)
         std::allocator_traits<Allocator>::construct(allocator, from, value);
@@ -1635,9 +1860,9 @@ void Vector<T, Allocator>::copyRangeForward(iterator from, iterator to, const_re
  * @param   destination     Starting point of destination range
  * @note    Use if the ranges overlaps each other
  */
-template<class T, class Allocator>
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
 template<class InputIterator>
-void Vector<T, Allocator>::copyRangeBackward(InputIterator from, InputIterator to, iterator destination)
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::copyRangeBackward(InputIterator from, InputIterator to, iterator destination)
 {
     /* Backward copying will help to prevent corruption of data
      * when two ranges overlap each other. */
@@ -1648,18 +1873,37 @@ void Vector<T, Allocator>::copyRangeBackward(InputIterator from, InputIterator t
 }
 
 /**
- * @brief   Grows the size of the vector either by copying the content or not
+ * @brief   Determines the capacity of the next allocation via the growth policy
+ * @param   currentCap  Current capacity of the container
+ * @param   requiredCap Minimum capacity to hold the elements
+ * @return  Capacity recommended by the growth policy
+ */
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+typename Vector<T, Allocator, GrowthPolicy, InlineCapacity>::size_type Vector<T, Allocator, GrowthPolicy, InlineCapacity>::recommendCapacity(size_type currentCap, size_type requiredCap) noexcept
+{
+    if(requiredCap <= InlineCapacity)   // The capacity never goes below the inline buffer
+        return InlineCapacity;
+
+    const size_type newCap = GrowthPolicy::nextCapacity(currentCap, requiredCap, sizeof(T));
+
+    return (newCap < requiredCap) ? requiredCap : newCap;   // Never trust the policy for the minimum
+}
+
+/**
+ * @brief   Allocates a new space and relocates the content into it if requested
  * @param   newCap      Requested capacity
- * @param   copy        Copy the content or not
+ * @param   copy        Relocate the content or not
  * @param   gapIndex    Starting index of the gap if needed
  * @param   gapSize     Size of the requested gap
- * @throw   std::invalid_argument   If the requested capacity is smaller than potential capacity
+ * @return  Address of the new space
+ * @throw   std::invalid_argument   If the requested capacity is smaller than the needed capacity
  * @throw   std::invalid_argument   If the gap index is outside of the container
+ * @note    replaceStorage(..) must be called with the new space if the content is relocated.
  */
-template<class T, class Allocator>
-T* Vector<T, Allocator>::grow(size_type newCap, bool copy, size_type gapIndex, size_type gapSize)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+T* Vector<T, Allocator, GrowthPolicy, InlineCapacity>::grow(size_type newCap, bool copy, size_type gapIndex, size_type gapSize)
 {
-    if(newCap < cap + gapSize)
+    if(newCap < size() + gapSize)
         throw std::invalid_argument("Cannot grow to a smaller capacity!");
 
     if(gapIndex > size())
@@ -1668,58 +1912,199 @@ T* Vector<T, Allocator>::grow(size_type newCap, bool copy, size_type gapIndex, s
     // Allocate new space
     value_type* newData = std::allocator_traits<Allocator>::allocate(allocator, newCap);
 
-    if(true == copy)    // If copying the old items is needed
+    if(true == copy)    // If relocating the old items is needed
     {
-        size_type copied = 0;
+        try {
+            relocateContent(newData, gapIndex, gapSize);
+        }catch(...){
+            destroyPointer(newData, newCap);
 
-        if(gapSize > 0) // Is a gap needed?
-        {
-            try {
-                // Copy construct items on the left side of the gap
-                for( ; copied < gapIndex; ++copied)
-                    std::allocator_traits<Allocator>::construct(allocator, newData + copied, *(data + copied));
+            throw;  // Propagate exception
+        }
+    }
 
-                // Copy construct items on the right side of the gap
-                for( ; copied < sz; ++copied)
-                    std::allocator_traits<Allocator>::construct(allocator, newData + copied + gapSize, *(data + copied));
+    return newData;
+}
 
-            }catch(...){
-                // Destruct items on the right side of the gap
-                for( ; copied > gapIndex; --copied)
-                    std::allocator_traits<Allocator>::destroy(allocator, newData + copied + gapSize - 1);
+/**
+ * @brief   Relocates the current content into a new space by leaving a gap if requested
+ * @param   newData     Uninitialized space, large enough to contain the content and the gap
+ * @param   gapIndex    Starting index of the gap
+ * @param   gapSize     Size of the requested gap
+ * @note    The new space is left uninitialized in case of an exception.
+ * @note    replaceStorage(..) must be called afterwards to release the old content.
+ */
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::relocateContent(iterator newData, size_type gapIndex, size_type gapSize)
+{
+    // Relocate items on the left side of the gap
+    relocateRange(begin(), begin() + gapIndex, newData);
 
-                // Destruct items on the left side of the gap
-                for( ; copied > 0; --copied)
-                    std::allocator_traits<Allocator>::destroy(allocator, newData + copied - 1);
+    try {
+        // Relocate items on the right side of the gap
+        relocateRange(begin() + gapIndex, end(), newData + gapIndex + gapSize);
+    }catch(...){
+        // Destruct items on the left side of the gap
+        destroyRange(newData, newData + gapIndex);
 
-                destroyPointer(newData);
+        throw;  // Propagate exception
+    }
+}
 
-                throw;  // Propagate exception
-            }
+/**
+ * @brief   Helper method for relocating ranges to an uninitialized space.
+ * @param   from            Starting point of source range
+ * @param   to              Ending point of source range(excluded)
+ * @param   destination     Starting point of destination range
+ * @note    Do not use if the ranges overlaps each other
+ * @note    Trivially relocatable elements are copied in bulk. Other elements are
+ *          moved if their move constructor cannot throw, copied otherwise.
+ */
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::relocateRange(iterator from, iterator to, iterator destination)
+{
+    if constexpr(is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>)
+        CONTAINER_STATS_RECORD(Vector, bytesMoved, size_type(to - from) * sizeof(T));
+    else    // move_if_noexcept(..) falls back to copying
+        CONTAINER_STATS_RECORD(Vector, bytesCopied, size_type(to - from) * sizeof(T));
+
+    if constexpr(is_trivially_relocatable_v<T>)
+    {
+        if(from != to)  // Null pointers shall not be passed to std::memcpy
+            std::memcpy(static_cast<void*>(destination), static_cast<const void*>(from), size_type(to - from) * sizeof(T));
+    }
+    else
+    {
+        iterator current = destination;
+
+        try {
+            for( ; from != to; ++from, ++current)
+                std::allocator_traits<Allocator>::construct(allocator, current, std::move_if_noexcept(*from));
+        }catch(...){
+            destroyRange(destination, current);     // Destruct relocated elements
+
+            throw;  // Propagate exception
         }
-        else
+    }
+}
+
+/**
+ * @brief   Releases the current space and replaces it with a new one holding the relocated content
+ * @param   newData     New space filled via relocateContent(..)
+ * @param   newCap      Capacity of the new space
+ */
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::replaceStorage(iterator newData, size_type newCap)
+{
+    // Lifetime of trivially relocated elements has already been transferred to the new space
+    if constexpr(!is_trivially_relocatable_v<T>)
+        destroyRange(begin(), end());
+
+    destroyPointer(data, cap);
+
+    if(nullptr != data)     // The first allocation is not a reallocation
+        CONTAINER_STATS_RECORD(Vector, reallocations, 1);
+
+    data    = newData;
+    cap     = newCap;
+}
+
+/**
+ * @brief   Opens an uninitialized gap by shifting right the elements after the given index
+ * @param   gapIndex    Starting index of the gap
+ * @param   gapSize     Size of the gap
+ * @note    The capacity must be enough to contain the gap. The size is incremented by the gap size.
+ * @note    Called only if isShiftingNothrow(), otherwise the insertions copy into a new space to keep the elements intact.
+ */
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::openGap(size_type gapIndex, size_type gapSize) noexcept
+{
+    if(0 == gapSize)    // Elements would be relocated onto themselves
+        return;
+
+    if constexpr(is_trivially_relocatable_v<T>)
+    {
+        if(gapIndex != sz)  // Overlapping ranges are handled by std::memmove
+            std::memmove(static_cast<void*>(data + gapIndex + gapSize), static_cast<const void*>(data + gapIndex), (sz - gapIndex) * sizeof(T));
+    }
+    else
+    {
+        /* Relocate backwards, so that each destination is either outside of the
+         * current size or has already been vacated by a previously relocated one. */
+        for(size_type index = sz; index > gapIndex; --index)
         {
-            try {
-                // Copy construct elements at new space
-                for( ; copied < sz; ++copied)
-                    std::allocator_traits<Allocator>::construct(allocator, newData + copied, *(data + copied));
-            }catch(...){
-                // Destruct copied elements
-                for( ; copied > 0; --copied)
-                    std::allocator_traits<Allocator>::destroy(allocator, newData + copied - 1);
+            std::allocator_traits<Allocator>::construct(allocator, data + index - 1 + gapSize, std::move_if_noexcept(*(data + index - 1)));
+            std::allocator_traits<Allocator>::destroy(allocator, data + index - 1);
+        }
+    }
 
-                destroyPointer(newData);
+    sz += gapSize;
+}
 
-                throw;  // Propagate exception
-            }
+/**
+ * @brief   Closes an uninitialized gap by shifting left the elements after it
+ * @param   gapIndex    Starting index of the gap
+ * @param   gapSize     Size of the gap
+ * @note    The size is decremented by the gap size.
+ * @note    Called only if isShiftingNothrow(), see openGap(..).
+ */
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::closeGap(size_type gapIndex, size_type gapSize) noexcept
+{
+    if(0 == gapSize)    // Elements would be relocated onto themselves
+        return;
+
+    if constexpr(is_trivially_relocatable_v<T>)
+    {
+        if(gapIndex + gapSize != sz)    // Overlapping ranges are handled by std::memmove
+            std::memmove(static_cast<void*>(data + gapIndex), static_cast<const void*>(data + gapIndex + gapSize), (sz - gapIndex - gapSize) * sizeof(T));
+    }
+    else
+    {
+        /* Relocate forwards, so that each destination has already
+         * been vacated either by the gap or a previously relocated one. */
+        for(size_type index = gapIndex + gapSize; index < sz; ++index)
+        {
+            std::allocator_traits<Allocator>::construct(allocator, data + index - gapSize, std::move_if_noexcept(*(data + index)));
+            std::allocator_traits<Allocator>::destroy(allocator, data + index);
         }
     }
 
-    return newData;
+    sz -= gapSize;
 }
 
-template<class T, class Allocator>
-void Vector<T, Allocator>::destroyRange(iterator from, iterator to)
+/**
+ * @brief   Takes over the content of the source vector, whose storage can be used by the allocator of this vector
+ * @param   source  Vector to be taken over, left empty with its inline buffer
+ * @note    Must be called when this vector has no elements and uses its inline buffer(if any).
+ * @note    Heap spaces are stolen, inline elements are relocated one by one.
+ */
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::stealContent(Vector& source)
+{
+    if(source.is_inline())
+    {
+        relocateRange(source.begin(), source.end(), data);
+
+        // Lifetime of trivially relocated elements has already been transferred
+        if constexpr(!is_trivially_relocatable_v<T>)
+            source.destroyRange(source.begin(), source.end());
+    }
+    else
+    {
+        data    = source.data;
+        cap     = source.cap;
+
+        source.data = source.inlineBuffer();  // Source stolen
+        source.cap  = InlineCapacity;
+    }
+
+    sz          = source.sz;
+    source.sz   = 0;
+}
+
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::destroyRange(iterator from, iterator to)
 {
     /* The operator delete[] wouldn't work appropriately as we
      * used the placement new operator and constructed each element
@@ -1728,16 +2113,20 @@ void Vector<T, Allocator>::destroyRange(iterator from, iterator to)
         std::allocator_traits<Allocator>::destroy(allocator, from);
 }
 
-template<class T, class Allocator>
-void Vector<T, Allocator>::destroyPointer(iterator ptr)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+void Vector<T, Allocator, GrowthPolicy, InlineCapacity>::destroyPointer(iterator ptr, size_type allocatedSize)
 {
+    // Inline buffer is a part of the object, nothing is allocated without it
+    if(ptr == inlineBuffer())
+        return;
+
     /* The allocated space will not be used anymore.
      * We shall release the resource for further usage. */
-    std::allocator_traits<Allocator>::deallocate(allocator, ptr, sz);
+    std::allocator_traits<Allocator>::deallocate(allocator, ptr, allocatedSize);
 }
 
-template<class T, class Allocator>
-std::ostream& operator<<(std::ostream& stream, const Vector<T, Allocator>& vector)
+template<class T, class Allocator, class GrowthPolicy, std::size_t InlineCapacity>
+std::ostream& operator<<(std::ostream& stream, const Vector<T, Allocator, GrowthPolicy, InlineCapacity>& vector)
 {
     for(const T& element : vector)
         stream << element << " ";
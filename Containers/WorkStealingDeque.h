@@ -0,0 +1,231 @@
+/**
+ * @file        WorkStealingDeque.h
+ * @details     A lock-free Chase-Lev work-stealing deque.
+ *              The owner thread pushes and pops at the bottom, any other thread can steal from the top.
+ *              The circular buffer grows on demand, the owner never blocks.
+ * @author      Caglayan DOKME, caglayandokme@gmail.com
+ * @date        October 14, 2026 -> First release
+ *
+ *  @note       Feel free to contact for questions, bugs or any other thing.
+ *  @copyright  No copyright.
+ */
+
+/*** Recursive inclusion preventer ***/
+#pragma once
+
+/*** Libraries ***/
+#include <atomic>               // std::atomic, std::atomic_thread_fence
+#include <cstddef>              // std::size_t, std::ptrdiff_t
+#include <memory>               // std::unique_ptr
+#include <type_traits>          // std::is_trivially_copyable_v
+
+/*** Special definitions ***/
+// If the C++ version is greater or equal to 2017xx
+#if __cplusplus >= 201703l
+#define NODISCARD [[nodiscard]]
+#else
+#define NODISCARD
+#endif
+
+/*** Container Class ***/
+/* Follows "Correct and Efficient Work-Stealing for Weak Memory Models"(Le, Pop, Cohen, Nardelli).
+ * Elements are copied in and out of atomic slots, so they must be trivially copyable(e.g. pointers to tasks).
+ * Replaced buffers are kept until the destruction, as a thief may still be reading from them. */
+template<class T, std::size_t INITIAL_CAPACITY = 64>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable_v<T>, "Elements must be trivially copyable!");
+    static_assert((INITIAL_CAPACITY != 0) && ((INITIAL_CAPACITY & (INITIAL_CAPACITY - 1)) == 0), "Initial capacity must be a power of 2!");
+
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+public:
+    using value_type    = T;
+    using size_type     = std::size_t;
+
+    /*** Constructors and Destructor ***/
+    WorkStealingDeque();
+    WorkStealingDeque(const WorkStealingDeque&) = delete;   // Shared with the thieves, cannot be copied
+    WorkStealingDeque(WorkStealingDeque&&) = delete;        // Shared with the thieves, cannot be moved
+    ~WorkStealingDeque();
+
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+    /*** Owner Operations ***/
+    void push(const value_type value);
+    NODISCARD bool pop(value_type& destination);
+
+    /*** Thief Operations ***/
+    NODISCARD bool steal(value_type& destination);
+
+    /*** Status Checkers ***/
+    // Results are only snapshots when other threads are active
+    NODISCARD size_type size() const noexcept;
+    NODISCARD bool empty() const noexcept { return (0 == size()); }
+
+private:
+    struct Buffer {
+        explicit Buffer(const std::size_t capacity, Buffer* previous)
+        : capacity(capacity), slots(new std::atomic<T>[capacity]), previous(previous)
+        { /* No operation */ }
+
+        NODISCARD T load(const std::ptrdiff_t index) const noexcept             { return slots[std::size_t(index) & (capacity - 1)].load(std::memory_order_relaxed); }
+        void store(const std::ptrdiff_t index, const T value) noexcept          { slots[std::size_t(index) & (capacity - 1)].store(value, std::memory_order_relaxed); }
+
+        const std::size_t               capacity;
+        std::unique_ptr<std::atomic<T>[]> slots;
+        Buffer* const                   previous;   // Replaced buffer, released at the destruction
+    };
+
+    NODISCARD Buffer* grow(Buffer* current, const std::ptrdiff_t topIdx, const std::ptrdiff_t bottomIdx);
+
+    /*** Members ***/
+    alignas(CACHE_LINE_SIZE) std::atomic<std::ptrdiff_t>    top{0};     // Moved by the thieves and by the owner for the last element
+    alignas(CACHE_LINE_SIZE) std::atomic<std::ptrdiff_t>    bottom{0};  // Moved only by the owner
+    std::atomic<Buffer*>                                    buffer{nullptr};
+};
+
+/**
+ * @brief   Default constructor, allocates the initial buffer
+ */
+template<class T, std::size_t INITIAL_CAPACITY>
+WorkStealingDeque<T, INITIAL_CAPACITY>::WorkStealingDeque()
+{
+    buffer.store(new Buffer(INITIAL_CAPACITY, nullptr), std::memory_order_relaxed);
+}
+
+/**
+ * @brief   Destructor, releases the current and the replaced buffers
+ * @note    No other thread may access the deque during the destruction.
+ */
+template<class T, std::size_t INITIAL_CAPACITY>
+WorkStealingDeque<T, INITIAL_CAPACITY>::~WorkStealingDeque()
+{
+    Buffer* current = buffer.load(std::memory_order_relaxed);
+
+    while(nullptr != current)
+    {
+        Buffer* previous = current->previous;
+
+        delete current;
+        current = previous;
+    }
+}
+
+/**
+ * @brief   Pushes an element to the bottom
+ * @param   value   Element to be pushed
+ * @note    Must be called only by the owner thread.
+ */
+template<class T, std::size_t INITIAL_CAPACITY>
+void WorkStealingDeque<T, INITIAL_CAPACITY>::push(const value_type value)
+{
+    const std::ptrdiff_t bottomIdx  = bottom.load(std::memory_order_relaxed);
+    const std::ptrdiff_t topIdx     = top.load(std::memory_order_acquire);
+    Buffer* current                 = buffer.load(std::memory_order_relaxed);
+
+    if((bottomIdx - topIdx) > std::ptrdiff_t(current->capacity - 1))
+        current = grow(current, topIdx, bottomIdx);
+
+    current->store(bottomIdx, value);
+
+    // Publishes the element to the thieves
+    bottom.store(bottomIdx + 1, std::memory_order_release);
+}
+
+/**
+ * @brief   Pops the most recently pushed element
+ * @param   destination Reference to the destination
+ * @return  true    If an element was popped
+ * @note    Must be called only by the owner thread.
+ */
+template<class T, std::size_t INITIAL_CAPACITY>
+bool WorkStealingDeque<T, INITIAL_CAPACITY>::pop(value_type& destination)
+{
+    const std::ptrdiff_t bottomIdx  = bottom.load(std::memory_order_relaxed) - 1;
+    Buffer* current                 = buffer.load(std::memory_order_relaxed);
+
+    // Reserve the bottom element before checking the thieves
+    bottom.store(bottomIdx, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    std::ptrdiff_t topIdx = top.load(std::memory_order_relaxed);
+
+    if(topIdx > bottomIdx)  // Empty
+    {
+        bottom.store(bottomIdx + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    destination = current->load(bottomIdx);
+
+    if(topIdx == bottomIdx) // Last element, race against the thieves
+    {
+        const bool won = top.compare_exchange_strong(topIdx, topIdx + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+
+        bottom.store(bottomIdx + 1, std::memory_order_relaxed);
+        return won;
+    }
+
+    return true;
+}
+
+/**
+ * @brief   Steals the least recently pushed element
+ * @param   destination Reference to the destination
+ * @return  true    If an element was stolen
+ *          false   If the deque was empty or another thread won the element
+ */
+template<class T, std::size_t INITIAL_CAPACITY>
+bool WorkStealingDeque<T, INITIAL_CAPACITY>::steal(value_type& destination)
+{
+    std::ptrdiff_t topIdx = top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const std::ptrdiff_t bottomIdx = bottom.load(std::memory_order_acquire);
+
+    if(topIdx >= bottomIdx)
+        return false;
+
+    const value_type value = buffer.load(std::memory_order_acquire)->load(topIdx);
+
+    if(!top.compare_exchange_strong(topIdx, topIdx + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        return false;
+
+    destination = value;
+
+    return true;
+}
+
+/**
+ * @brief   Returns the number of elements
+ * @return  Number of elements at the moment of the call
+ */
+template<class T, std::size_t INITIAL_CAPACITY>
+std::size_t WorkStealingDeque<T, INITIAL_CAPACITY>::size() const noexcept
+{
+    const std::ptrdiff_t bottomIdx  = bottom.load(std::memory_order_relaxed);
+    const std::ptrdiff_t topIdx     = top.load(std::memory_order_relaxed);
+
+    return (bottomIdx > topIdx) ? std::size_t(bottomIdx - topIdx) : 0;
+}
+
+/**
+ * @brief   Replaces the buffer with one of double capacity
+ * @param   current     Current buffer
+ * @param   topIdx      Top index seen by the owner
+ * @param   bottomIdx   Bottom index
+ * @return  Address of the new buffer
+ * @note    Elements keep their indexes, so that the concurrent thieves are not disturbed.
+ */
+template<class T, std::size_t INITIAL_CAPACITY>
+typename WorkStealingDeque<T, INITIAL_CAPACITY>::Buffer* WorkStealingDeque<T, INITIAL_CAPACITY>::grow(Buffer* current, const std::ptrdiff_t topIdx, const std::ptrdiff_t bottomIdx)
+{
+    Buffer* grown = new Buffer(current->capacity * 2, current);
+
+    for(std::ptrdiff_t index = topIdx; index < bottomIdx; ++index)
+        grown->store(index, current->load(index));
+
+    buffer.store(grown, std::memory_order_release);
+
+    return grown;
+}
@@ -14,7 +14,7 @@ template<typename ContainerType, typename LambdaType>
 void Function(ContainerType& container, LambdaType lambda)
 {
     /*  Iterate over the given container and call the lambda expression with the current element. */
-    for(auto element : container)
+    for(const auto& element : container)
         if(lambda(element) == true)
             cout << element << endl;
 }
@@ -6,6 +6,7 @@
 #include <iterator>
 #include <string>
 #include <vector>
+#include "Containers/TextWriter.h"    // TextWriter, TextWriterIterator batching the output
 
 using namespace std;
 
@@ -39,6 +40,19 @@ int main(int argc, char const *argv[])
         errorLog = errorMessage;
     cout << endl;
 
+    /*  Each assignment above goes through the stream separately. A TextWriterIterator
+     *  has the same ergonomics, but the elements are rendered into the buffer of a
+     *  TextWriter and handed to the stream in large blocks. */
+    cout << "Printing integers with a batching iterator: ";
+    {
+        TextWriter writer(cout);
+
+        copy(array, array + 5, TextWriterIterator<int>(writer, " "));
+        writer << '\n' << "Printing errors with the same writer: ";
+        writer.writeAll(errors, ", ");  // Whole containers can be written at once
+    }   // Remaining text is written when the writer is destroyed
+    cout << endl;
+
     cout << "Program ended!" << endl;
 
     return 0;
@@ -4,37 +4,7 @@
 
 /** Libraries **/
 #include <iostream>
-
-// Class for storing matrixes
-template<class DataType, std::size_t ROW, std::size_t COLUMN>
-class Matrix {
-    static_assert(ROW       != 0, "Row size cannot be 0!");
-    static_assert(COLUMN    != 0, "Column size cannot be 0!");
-
-public:
-    Matrix() = default;
-
-    // Parenthesis overloaded
-    DataType& operator()(const std::size_t row, const std::size_t column)
-    {
-        if((row >= ROW) || (column >= COLUMN))
-            throw ("Index out-of-range error!");
-
-        return data[row][column];
-    }
-
-    // Parenthesis overloaded
-    const DataType& operator()(const std::size_t row, const std::size_t column) const
-    {
-        if((row >= ROW) || (column >= COLUMN))
-            throw ("Index out-of-range error!");
-
-        return data[row][column];
-    }
-
-private:
-    DataType data[ROW][COLUMN];
-};
+#include "Containers/MatrixContainer.h"     // Matrix, overloads the parenthesis operator for checked access
 
 int main() 
 {
@@ -1,83 +1,203 @@
 // Example usage of policy based design pattern for communication policies in device drivers
 // Date:        November 11, 2021
+//              October 14, 2026 -> Policies stored inline and dispatched statically, the virtual base class removed.
+//                               -> Batched scatter/gather transfers over lock-free TX/RX queues with completion callbacks.
 // Author:      Caglayan DOKME, caglayandokme@gmail.com
 
 /** Libraries **/
 #include <iostream>
 #include <stdint.h>
+#include <cstddef>
+#include <initializer_list>
+#include <string>
 #include <utility>
+#include "Containers/SpscQueueContainer.h"	// SpscQueue, lock-free ring buffer with batch push and pop
 
-// Base abstract class for communication
-class CommDevice {
-public:
-	CommDevice() 			{ std::cout << "Communication device created!" << std::endl; }
-	virtual ~CommDevice() 	{ std::cout << "Communication device destroyed!" << std::endl; }
-
-	virtual void send() = 0;
-	virtual void receive() = 0;
+// Non-owning view of a contiguous sequence, a minimal std::span for C++17
+template<class T>
+struct Span {
+	T*			data;
+	std::size_t	size;
 };
 
-// Policy of UART
-class Uart : public CommDevice {
+/* A communication policy is any class providing the members below, no common base class is needed.
+ * The driver knows the policy type at compile time, so the calls are resolved statically and can be inlined.
+ *
+ *	static constexpr const char* NAME;									Name of the bus
+ *	static constexpr std::size_t BURST_SIZE;							Largest transfer the hardware takes at once(e.g. FIFO depth)
+ *	void transmit(const uint8_t* bytes, std::size_t count);				Transfers up to BURST_SIZE bytes
+ *	std::size_t collect(uint8_t* destination, std::size_t capacity);	Reads the received bytes, returns their number
+ */
+
+// Policy of UART, the transmitted bytes are looped back to the receiver
+class Uart {
 public:
-	Uart() 	{ std::cout << "UART initialized." 	<< std::endl; }
-	~Uart() { std::cout << "UART destroyed!" 	<< std::endl; }
+	static constexpr const char*	NAME		= "UART";
+	static constexpr std::size_t	BURST_SIZE	= 16;	// Hardware FIFO depth
+
+	Uart() 	{ std::cout << "UART initialized.\n"; }
 
-	void send() 	final { std::cout << "Sending over UART."   << std::endl; }
-	void receive() 	final { std::cout << "Receiving over UART." << std::endl; }
+	void transmit(const uint8_t* bytes, std::size_t count)			{ wire.push_n(bytes, count); ++bursts; }
+	std::size_t collect(uint8_t* destination, std::size_t capacity)	{ return wire.pop_n(destination, capacity); }
+
+	std::size_t bursts = 0;		// Number of hardware transfers
+
+private:
+	SpscQueue<uint8_t, 256> wire;	// Simulated loopback line
 };
 
-// Policy of SPI
-class Spi : public CommDevice {
+// Policy of SPI, the transmitted bytes are looped back to the receiver
+class Spi {
 public:
-	Spi() 	{ std::cout << "SPI initialized." 	<< std::endl; }
-	~Spi() 	{ std::cout << "SPI destroyed!" 	<< std::endl; }
+	static constexpr const char*	NAME		= "SPI";
+	static constexpr std::size_t	BURST_SIZE	= 64;	// DMA transfer size
+
+	Spi() 	{ std::cout << "SPI initialized.\n"; }
+
+	void transmit(const uint8_t* bytes, std::size_t count)			{ wire.push_n(bytes, count); ++bursts; }
+	std::size_t collect(uint8_t* destination, std::size_t capacity)	{ return wire.pop_n(destination, capacity); }
+
+	std::size_t bursts = 0;		// Number of hardware transfers
+
+private:
+	SpscQueue<uint8_t, 256> wire;	// Simulated loopback line
+};
 
-	void send() 	final { std::cout << "Sending over SPI." 	<< std::endl; }
-	void receive() 	final { std::cout << "Receiving over SPI." 	<< std::endl; }
+// Called by poll() once all bytes of a send request are handed to the hardware
+struct Completion {
+	void (*callback)(void* context, std::size_t bytes) = nullptr;
+	void* context = nullptr;
 };
 
-// External device driver class with template communication policy
-template<class CommPolicy>
+/* External device driver class with template communication policy.
+ * The policy is a member, no heap allocation or virtual dispatch is involved.
+ * send(..) and receive(..) only touch the queues, poll() moves the bytes between the queues and the hardware in bursts.
+ * Every queue has a single producer and a single consumer, so a thread may send while another polls without any lock. */
+template<class CommPolicy, std::size_t QUEUE_CAPACITY = 1024>
 class ExternalDevice {
 public:
-    // Constructor
-	ExternalDevice(std::string&& deviceName) : name(std::move(deviceName))
+	// Constructor, the arguments are forwarded to the policy
+	template<class... PolicyArgs>
+	explicit ExternalDevice(std::string deviceName, PolicyArgs&&... policyArgs)
+	: name(std::move(deviceName)), commDevice(std::forward<PolicyArgs>(policyArgs)...)
 	{
-		std::cout << name << ": Device driver created." << std::endl;
-		std::cout << name << ": Applying the communication policy." 	<< std::endl;
+		std::cout << name << ": Device driver created over " << CommPolicy::NAME << ".\n";
+	}
 
-		commDevice = new CommPolicy;
+	// Destructor
+	~ExternalDevice()
+	{
+		std::cout << name << ": Device driver destroyed.\n";
+	}
 
-		if(nullptr == commDevice)
-			std::cout << name << ": Communication policy failed." << std::endl;
+	/** Member methods **/
+	// Queues the bytes of a single buffer, returns the number of queued bytes
+	std::size_t send(Span<const uint8_t> bytes, Completion onSent = Completion())
+	{
+		return send({bytes}, onSent);
 	}
 
-    // Destructor
-	~ExternalDevice()
+	// Queues the bytes of the buffers in order(gather), returns the number of queued bytes
+	std::size_t send(std::initializer_list<Span<const uint8_t>> buffers, Completion onSent = Completion())
 	{
-		delete commDevice;
+		// The completion is recorded first, a request without a completion slot is not queued
+		if((nullptr != onSent.callback) && (completions.size() == completions.capacity()))
+			return 0;
+
+		std::size_t queuedBytes = 0;
+
+		for(const Span<const uint8_t>& buffer : buffers)
+		{
+			const std::size_t pushed = txQueue.push_n(buffer.data, buffer.size);
+
+			queuedBytes += pushed;
+
+			if(pushed != buffer.size)	// Queue is full
+				break;
+		}
+
+		sentTotal += queuedBytes;
+
+		if(nullptr != onSent.callback)
+			completions.push(PendingCompletion{onSent, sentTotal, queuedBytes});
+
+		return queuedBytes;
+	}
 
-		std::cout << name << ": Device driver destroyed." << std::endl;
+	// Takes the received bytes into a single buffer, returns the number of bytes taken
+	std::size_t receive(Span<uint8_t> destination)
+	{
+		return receive({destination});
 	}
 
-    /** Member methods **/
-	void sendData()
+	// Takes the received bytes into the buffers in order(scatter), returns the number of bytes taken
+	std::size_t receive(std::initializer_list<Span<uint8_t>> buffers)
 	{
-		std::cout << name << ": Sending data.." << std::endl;
-		commDevice->send();
+		std::size_t takenBytes = 0;
+
+		for(const Span<uint8_t>& buffer : buffers)
+		{
+			const std::size_t popped = rxQueue.pop_n(buffer.data, buffer.size);
+
+			takenBytes += popped;
+
+			if(popped != buffer.size)	// Queue is empty
+				break;
+		}
+
+		return takenBytes;
 	}
 
-	void receiveData()
+	// Transmits the queued bytes and collects the received ones in bursts, then calls the completed callbacks
+	void poll()
 	{
-		std::cout << name << ": Receiving data.." << std::endl;
-		commDevice->receive();
+		uint8_t burst[CommPolicy::BURST_SIZE];
+
+		// Both directions are served in turns, so that the hardware buffers are emptied while transmitting
+		for(bool isBusy = true; isBusy; )
+		{
+			const std::size_t transmitted = txQueue.pop_n(burst, CommPolicy::BURST_SIZE);
+
+			if(0 != transmitted)
+			{
+				commDevice.transmit(burst, transmitted);
+				transmittedTotal += transmitted;
+			}
+
+			const std::size_t collected = commDevice.collect(burst, CommPolicy::BURST_SIZE);
+
+			droppedBytes += collected - rxQueue.push_n(burst, collected);	// Bytes not fitting into the queue are lost
+			isBusy = (0 != transmitted) || (0 != collected);
+		}
+
+		while(!completions.empty() && (completions.front().lastByte <= transmittedTotal))
+		{
+			const PendingCompletion completed = completions.front();
+
+			completions.pop();
+			completed.completion.callback(completed.completion.context, completed.bytes);
+		}
 	}
 
+	CommPolicy& policy() 	{ return commDevice; }
+	std::size_t dropped() const 	{ return droppedBytes; }
+
 private:
-    /** Members **/
+	struct PendingCompletion {
+		Completion	completion;
+		std::size_t	lastByte;	// Completed once this many bytes are transmitted
+		std::size_t	bytes;		// Number of bytes of the request
+	};
+
+	/** Members **/
 	std::string name;
-	CommPolicy* commDevice{nullptr};
+	CommPolicy commDevice;		// Stored inline, dispatched statically
+	SpscQueue<uint8_t, QUEUE_CAPACITY>	txQueue;		// Producer: send(..), Consumer: poll()
+	SpscQueue<uint8_t, QUEUE_CAPACITY>	rxQueue;		// Producer: poll(), Consumer: receive(..)
+	SpscQueue<PendingCompletion, 64>	completions;	// Producer: send(..), Consumer: poll()
+	std::size_t sentTotal			= 0;	// Bytes queued by send(..) since the creation
+	std::size_t transmittedTotal	= 0;	// Bytes handed to the policy since the creation
+	std::size_t droppedBytes		= 0;	// Received bytes lost due to a full queue
 };
 
 int main() {
@@ -85,19 +205,53 @@ int main() {
 	ExternalDevice<Spi>     device1("Device 1");
 	ExternalDevice<Uart>    device2("Device 2");
 
-	std::cout << std::endl;
+	std::cout << '\n';
+
+    // Sending data to devices, a header and a payload are gathered into a single request
+	const uint8_t header[]	= {0xA5, 0x5A};
+	const uint8_t payload[]	= "Batched transfer over the bus";
+
+	auto reportSent = [](void* context, std::size_t bytes) {
+		std::cout << static_cast<const char*>(context) << ": " << bytes << " bytes sent.\n";
+	};
+
+	char name1[] = "Device 1";
+	char name2[] = "Device 2";
+
+	for(int message = 0; message < 10; ++message)
+	{
+		device1.send({Span<const uint8_t>{header, sizeof(header)}, Span<const uint8_t>{payload, sizeof(payload)}});
+		device2.send({Span<const uint8_t>{header, sizeof(header)}, Span<const uint8_t>{payload, sizeof(payload)}});
+	}
+
+	device1.send(Span<const uint8_t>{header, sizeof(header)}, Completion{reportSent, name1});
+	device2.send(Span<const uint8_t>{header, sizeof(header)}, Completion{reportSent, name2});
+
+	device1.poll();
+	device2.poll();
+
+	std::cout << '\n';
+
+    // Receiving data from devices, the header and the payload are scattered into separate buffers
+	uint8_t receivedHeader[2];
+	uint8_t receivedPayload[sizeof(payload)];
+
+	auto receiveAll = [&](auto& device, const char* deviceName) {
+		std::size_t messages = 0;
+
+		while(device.receive({Span<uint8_t>{receivedHeader, sizeof(receivedHeader)}, Span<uint8_t>{receivedPayload, sizeof(receivedPayload)}}) == sizeof(receivedHeader) + sizeof(receivedPayload))
+			++messages;
 
-    // Sending data to devices
-	device1.sendData();
-	device2.sendData();
+		std::cout << deviceName << ": " << messages << " messages received, payload: " << reinterpret_cast<const char*>(receivedPayload) << '\n';
+	};
 
-	std::cout << std::endl;
+	receiveAll(device1, name1);
+	receiveAll(device2, name2);
 
-    // Receiving data from devices
-	device1.receiveData();
-	device2.receiveData();
+	std::cout << "Device 1: " << device1.policy().bursts << " " << Spi::NAME  << " bursts, " << device1.dropped() << " bytes dropped.\n";
+	std::cout << "Device 2: " << device2.policy().bursts << " " << Uart::NAME << " bursts, " << device2.dropped() << " bytes dropped.\n";
 
-	std::cout << std::endl;
+	std::cout << '\n';
 
 	std::cout << "Program finished." << std::endl << std::endl;
 